@@ -0,0 +1,409 @@
+// ============================================================================
+// Hedge Edge Account Table
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <set>
+
+#include "HedgeEdgeAccounts.h"
+#include "HedgeEdgeFixed.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeJson.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    // Volume of a position or deal object: exact steps when the EA sent them,
+    // otherwise the decimal lots of older EAs
+    int64_t VolumeUnits(std::string_view object)
+    {
+        int64_t steps = JsonInt(object, "volumeSteps", -1);
+        int64_t stepUnits = JsonInt(object, "lotStepE8", 0);
+        if (steps >= 0 && stepUnits > 0) return steps * stepUnits;
+        if (JsonHas(object, "volumeLots")) return LotsToUnits(JsonDouble(object, "volumeLots"));
+        return LotsToUnits(JsonDouble(object, "volume"));
+    }
+
+    int Side(std::string_view text)
+    {
+        return text == "SELL" ? -1 : 1;
+    }
+
+    void UpdateDrawdown(AccountState& account)
+    {
+        if (account.equity > account.peakEquity) account.peakEquity = account.equity;
+        account.drawdown = account.peakEquity - account.equity;
+        account.drawdownPct = account.peakEquity > 0.0 ? account.drawdown / account.peakEquity * 100.0 : 0.0;
+        if (account.drawdownPct > account.maxDrawdownPct) account.maxDrawdownPct = account.drawdownPct;
+    }
+
+    // Balance / equity / margin figures; `pnlKey` is "floatingPnL" in full
+    // states and "profit" in heartbeats
+    void ApplyFigures(AccountState& account, std::string_view object, std::string_view pnlKey)
+    {
+        account.balance = JsonDouble(object, "balance", account.balance);
+        account.equity = JsonDouble(object, "equity", account.equity);
+        account.margin = JsonDouble(object, "margin", account.margin);
+        account.freeMargin = JsonDouble(object, "freeMargin", account.freeMargin);
+        account.floatingPnL = JsonDouble(object, pnlKey, account.floatingPnL);
+        account.paused = JsonBool(object, "isPaused", account.paused);
+        account.licensed = JsonBool(object, "isLicenseValid", account.licensed);
+        UpdateDrawdown(account);
+    }
+
+    // Full state: figures, identity and the complete position list
+    void ApplyFullState(AccountState& account, std::string_view object)
+    {
+        ApplyFigures(account, object, "floatingPnL");
+
+        std::string broker = JsonString(object, "broker");
+        if (!broker.empty()) account.broker = broker;
+        std::string server = JsonString(object, "server");
+        if (!server.empty()) account.server = server;
+        std::string currency = JsonString(object, "currency");
+        if (!currency.empty()) account.currency = currency;
+
+        std::string_view positions;
+        if (!JsonMember(object, "positions", positions)) return;
+
+        account.positions.clear();
+        JsonForEach(positions, [&](std::string_view item)
+        {
+            AccountPosition position;
+            position.ticket = static_cast<uint64_t>(JsonInt(item, "id"));
+            if (position.ticket == 0) return;
+            position.symbol = JsonString(item, "symbol");
+            position.side = Side(JsonStringView(item, "side"));
+            position.volumeUnits = VolumeUnits(item);
+            position.entryPrice = JsonDouble(item, "entryPrice");
+            position.profit = JsonDouble(item, "profit");
+            account.positions[position.ticket] = position;
+        });
+        account.positionCount = static_cast<int>(account.positions.size());
+    }
+
+    void ApplyDeal(AccountState& account, std::string_view data, bool opened)
+    {
+        uint64_t ticket = static_cast<uint64_t>(JsonInt(data, "position"));
+        if (ticket == 0) return;
+        int64_t units = VolumeUnits(data);
+
+        auto it = account.positions.find(ticket);
+        if (opened)
+        {
+            if (it == account.positions.end())
+            {
+                AccountPosition position;
+                position.ticket = ticket;
+                position.symbol = JsonString(data, "symbol");
+                position.side = Side(JsonStringView(data, "type"));
+                position.volumeUnits = units;
+                position.entryPrice = JsonDouble(data, "price");
+                account.positions[ticket] = position;
+            }
+            else
+            {
+                it->second.volumeUnits += units;
+            }
+        }
+        else if (it != account.positions.end())
+        {
+            // Partial closes leave the rest open
+            it->second.volumeUnits -= units;
+            if (it->second.volumeUnits <= 0) account.positions.erase(it);
+        }
+        account.positionCount = static_cast<int>(account.positions.size());
+    }
+
+    const char* Status(const AccountState& account, uint64_t nowUs, uint64_t staleUs)
+    {
+        if (!account.connected) return "disconnected";
+        if (staleUs > 0 && nowUs > account.lastUpdateUs && nowUs - account.lastUpdateUs > staleUs) return "stale";
+        return "live";
+    }
+
+    void AppendLots(std::string& out, int64_t units)
+    {
+        AppendFixed(out, UnitsToLots(units), 2);
+    }
+
+    void AppendAccount(std::string& out, const AccountState& account, uint64_t nowUs, uint64_t staleUs)
+    {
+        out += "{\"accountId\":";
+        AppendJsonString(out, account.accountId);
+        out += ",\"broker\":";
+        AppendJsonString(out, account.broker);
+        out += ",\"server\":";
+        AppendJsonString(out, account.server);
+        out += ",\"currency\":";
+        AppendJsonString(out, account.currency);
+        out += ",\"source\":";
+        AppendJsonString(out, account.source);
+        out += ",\"status\":\"";
+        out += Status(account, nowUs, staleUs);
+        out += "\",\"balance\":";
+        AppendFixed(out, account.balance, 2);
+        out += ",\"equity\":";
+        AppendFixed(out, account.equity, 2);
+        out += ",\"margin\":";
+        AppendFixed(out, account.margin, 2);
+        out += ",\"freeMargin\":";
+        AppendFixed(out, account.freeMargin, 2);
+        out += ",\"floatingPnL\":";
+        AppendFixed(out, account.floatingPnL, 2);
+        out += ",\"peakEquity\":";
+        AppendFixed(out, account.peakEquity, 2);
+        out += ",\"drawdown\":";
+        AppendFixed(out, account.drawdown, 2);
+        out += ",\"drawdownPct\":";
+        AppendFixed(out, account.drawdownPct, 2);
+        out += ",\"maxDrawdownPct\":";
+        AppendFixed(out, account.maxDrawdownPct, 2);
+        out += ",\"isPaused\":";
+        out += account.paused ? "true" : "false";
+        out += ",\"isLicenseValid\":";
+        out += account.licensed ? "true" : "false";
+        out += ",\"positionCount\":";
+        AppendInt(out, account.positionCount);
+        out += ",\"lastEventIndex\":";
+        AppendInt(out, account.lastEventIndex);
+        out += ",\"ageMs\":";
+        AppendUInt(out, nowUs > account.lastUpdateUs ? (nowUs - account.lastUpdateUs) / 1000 : 0);
+        out += ",\"events\":";
+        AppendUInt(out, account.events);
+        out += ",\"snapshots\":";
+        AppendUInt(out, account.snapshots);
+    }
+
+} // namespace
+
+// ============================================================================
+// AccountTable
+// ============================================================================
+
+bool AccountTable::Apply(std::string_view topic, std::string_view json, uint64_t nowUs,
+                         const std::string& source)
+{
+    std::string accountId = JsonString(json, "accountId");
+    if (accountId.empty() || (topic != "EVENT" && topic != "SNAPSHOT"))
+    {
+        m_ignored++;
+        return false;
+    }
+
+    AccountState& account = m_accounts[accountId];
+    if (account.accountId.empty()) account.accountId = accountId;
+    account.source = source;
+    account.lastUpdateUs = nowUs;
+    m_applied++;
+
+    if (topic == "SNAPSHOT")
+    {
+        account.connected = true;
+        account.snapshots++;
+        account.lastEventIndex = JsonInt(json, "snapshotIndex", account.lastEventIndex);
+        ApplyFullState(account, json);
+        return true;
+    }
+
+    account.events++;
+    account.lastEventIndex = JsonInt(json, "eventIndex", account.lastEventIndex);
+
+    std::string_view type = JsonStringView(json, "type");
+    std::string_view data;
+    JsonMember(json, "data", data);
+
+    if (type == "DISCONNECTED")
+    {
+        account.connected = false;
+        return true;
+    }
+
+    account.connected = true;
+    if (type == "CONNECTED" || type == "ACCOUNT_UPDATE")
+    {
+        ApplyFullState(account, data);
+    }
+    else if (type == "HEARTBEAT")
+    {
+        ApplyFigures(account, data, "profit");
+        account.positionCount = static_cast<int>(JsonInt(data, "positionCount", account.positionCount));
+    }
+    else if (type == "POSITION_OPENED" || type == "POSITION_CLOSED")
+    {
+        ApplyDeal(account, data, type == "POSITION_OPENED");
+    }
+    // POSITION_REVERSED / POSITION_MODIFIED: the ACCOUNT_UPDATE that follows
+    // every trade burst carries the resulting positions
+    return true;
+}
+
+const AccountState* AccountTable::Find(const std::string& accountId) const
+{
+    auto it = m_accounts.find(accountId);
+    return it != m_accounts.end() ? &it->second : nullptr;
+}
+
+std::string AccountTable::SummaryJson(uint64_t nowUs, uint64_t staleUs) const
+{
+    size_t live = 0, stale = 0, disconnected = 0, positions = 0;
+    double balance = 0.0, equity = 0.0, floatingPnL = 0.0, margin = 0.0, maxDrawdownPct = 0.0;
+    const AccountState* worst = nullptr;
+
+    for (const auto& entry : m_accounts)
+    {
+        const AccountState& account = entry.second;
+        std::string_view status = Status(account, nowUs, staleUs);
+        if (status == "live") live++;
+        else if (status == "stale") stale++;
+        else disconnected++;
+
+        balance += account.balance;
+        equity += account.equity;
+        floatingPnL += account.floatingPnL;
+        margin += account.margin;
+        positions += static_cast<size_t>(account.positionCount);
+        if (!worst || account.drawdownPct > worst->drawdownPct) worst = &account;
+        if (account.maxDrawdownPct > maxDrawdownPct) maxDrawdownPct = account.maxDrawdownPct;
+    }
+
+    std::string json = "{\"accounts\":";
+    AppendUInt(json, m_accounts.size());
+    json += ",\"live\":";
+    AppendUInt(json, live);
+    json += ",\"stale\":";
+    AppendUInt(json, stale);
+    json += ",\"disconnected\":";
+    AppendUInt(json, disconnected);
+    json += ",\"balance\":";
+    AppendFixed(json, balance, 2);
+    json += ",\"equity\":";
+    AppendFixed(json, equity, 2);
+    json += ",\"floatingPnL\":";
+    AppendFixed(json, floatingPnL, 2);
+    json += ",\"margin\":";
+    AppendFixed(json, margin, 2);
+    json += ",\"positions\":";
+    AppendUInt(json, positions);
+    json += ",\"maxDrawdownPct\":";
+    AppendFixed(json, maxDrawdownPct, 2);
+    json += ",\"worstAccount\":";
+    if (worst)
+    {
+        json += "{\"accountId\":";
+        AppendJsonString(json, worst->accountId);
+        json += ",\"drawdownPct\":";
+        AppendFixed(json, worst->drawdownPct, 2);
+        json += "}";
+    }
+    else
+    {
+        json += "null";
+    }
+    json += "}";
+    return json;
+}
+
+std::string AccountTable::AccountsJson(uint64_t nowUs, uint64_t staleUs) const
+{
+    std::string json = "[";
+    for (const auto& entry : m_accounts)
+    {
+        if (json.size() > 1) json += ",";
+        AppendAccount(json, entry.second, nowUs, staleUs);
+        json += "}";
+    }
+    json += "]";
+    return json;
+}
+
+std::string AccountTable::AccountJson(const std::string& accountId, uint64_t nowUs, uint64_t staleUs) const
+{
+    const AccountState* account = Find(accountId);
+    if (!account) return std::string();
+
+    std::string json;
+    AppendAccount(json, *account, nowUs, staleUs);
+    json += ",\"positions\":[";
+    bool first = true;
+    for (const auto& entry : account->positions)
+    {
+        const AccountPosition& position = entry.second;
+        if (!first) json += ",";
+        first = false;
+        json += "{\"id\":\"";
+        AppendUInt(json, position.ticket);
+        json += "\",\"symbol\":";
+        AppendJsonString(json, position.symbol);
+        json += ",\"side\":\"";
+        json += position.side < 0 ? "SELL" : "BUY";
+        json += "\",\"volumeLots\":";
+        AppendLots(json, position.volumeUnits);
+        json += ",\"volumeE8\":";
+        AppendInt(json, position.volumeUnits);
+        json += ",\"entryPrice\":";
+        AppendFixed(json, position.entryPrice, 5);
+        json += ",\"profit\":";
+        AppendFixed(json, position.profit, 2);
+        json += "}";
+    }
+    json += "]}";
+    return json;
+}
+
+std::string AccountTable::ExposureJson() const
+{
+    struct Exposure
+    {
+        int64_t net = 0;
+        int64_t gross = 0;
+        size_t  positions = 0;
+        std::set<std::string> accounts;
+    };
+
+    std::map<std::string, Exposure> symbols;
+    for (const auto& entry : m_accounts)
+    {
+        for (const auto& item : entry.second.positions)
+        {
+            const AccountPosition& position = item.second;
+            Exposure& exposure = symbols[position.symbol];
+            exposure.net += position.side * position.volumeUnits;
+            exposure.gross += position.volumeUnits;
+            exposure.positions++;
+            exposure.accounts.insert(entry.first);
+        }
+    }
+
+    std::string json = "[";
+    for (const auto& entry : symbols)
+    {
+        const Exposure& exposure = entry.second;
+        if (json.size() > 1) json += ",";
+        json += "{\"symbol\":";
+        AppendJsonString(json, entry.first);
+        json += ",\"netLots\":";
+        AppendLots(json, exposure.net);
+        json += ",\"grossLots\":";
+        AppendLots(json, exposure.gross);
+        json += ",\"netE8\":";
+        AppendInt(json, exposure.net);
+        json += ",\"grossE8\":";
+        AppendInt(json, exposure.gross);
+        json += ",\"accounts\":";
+        AppendUInt(json, exposure.accounts.size());
+        json += ",\"positions\":";
+        AppendUInt(json, exposure.positions);
+        json += "}";
+    }
+    json += "]";
+    return json;
+}
+
+} // namespace hedgeedge
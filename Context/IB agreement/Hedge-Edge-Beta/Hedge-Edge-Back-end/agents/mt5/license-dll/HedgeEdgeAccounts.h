@@ -0,0 +1,110 @@
+// ============================================================================
+// Hedge Edge Account Table
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// In-memory state of many master accounts, fed with the EVENT and SNAPSHOT
+// messages their EAs publish. Snapshots, CONNECTED and ACCOUNT_UPDATE carry
+// the full state and replace what is held; heartbeats refresh the account
+// figures; POSITION_OPENED / POSITION_CLOSED adjust the position list in
+// between. Equity peaks are tracked per account for drawdown.
+//
+// Volumes are held in 1e-8 lot units (HedgeEdgeFixed.h), so exposure sums
+// across accounts are exact.
+//
+// Not synchronized: owned by the thread that receives the messages.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_ACCOUNTS_H
+#define HEDGE_EDGE_ACCOUNTS_H
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace hedgeedge {
+
+struct AccountPosition
+{
+    uint64_t    ticket = 0;
+    std::string symbol;
+    int         side = 1;                   // +1 BUY, -1 SELL
+    int64_t     volumeUnits = 0;            // 1e-8 lots
+    double      entryPrice = 0.0;
+    double      profit = 0.0;
+};
+
+struct AccountState
+{
+    std::string accountId;
+    std::string broker;
+    std::string server;
+    std::string currency;
+    std::string source;                     // Endpoint the account arrived on
+
+    double      balance = 0.0;
+    double      equity = 0.0;
+    double      margin = 0.0;
+    double      freeMargin = 0.0;
+    double      floatingPnL = 0.0;
+
+    double      peakEquity = 0.0;           // Highest equity seen by this process
+    double      drawdown = 0.0;             // peakEquity - equity
+    double      drawdownPct = 0.0;
+    double      maxDrawdownPct = 0.0;
+
+    bool        paused = false;
+    bool        licensed = true;
+    bool        connected = true;           // False after DISCONNECTED
+    int         positionCount = 0;          // As last reported by the master
+
+    std::map<uint64_t, AccountPosition> positions;
+
+    int64_t     lastEventIndex = -1;
+    uint64_t    lastUpdateUs = 0;           // NowMicros() of the last message
+    uint64_t    events = 0;
+    uint64_t    snapshots = 0;
+};
+
+class AccountTable
+{
+public:
+    // Apply one message ("EVENT" or "SNAPSHOT"). Returns false if it carries
+    // no account or is not understood.
+    bool Apply(std::string_view topic, std::string_view json, uint64_t nowUs, const std::string& source);
+
+    size_t Size() const { return m_accounts.size(); }
+    const AccountState* Find(const std::string& accountId) const;
+
+    // Accounts without a message for `staleUs` are reported as "stale"
+
+    // {"accounts":N,"live":N,"stale":N,"disconnected":N,"balance":..,"equity":..,
+    //  "floatingPnL":..,"margin":..,"positions":N,"maxDrawdownPct":..,"worstAccount":".."}
+    std::string SummaryJson(uint64_t nowUs, uint64_t staleUs) const;
+
+    // [{account fields}, ...] without positions
+    std::string AccountsJson(uint64_t nowUs, uint64_t staleUs) const;
+
+    // {account fields,"positions":[...]}, empty if the account is unknown
+    std::string AccountJson(const std::string& accountId, uint64_t nowUs, uint64_t staleUs) const;
+
+    // [{"symbol":"..","netLots":..,"grossLots":..,"netE8":N,"grossE8":N,"accounts":N,"positions":N}, ...]
+    std::string ExposureJson() const;
+
+    uint64_t Applied() const { return m_applied; }
+    uint64_t Ignored() const { return m_ignored; }
+
+private:
+    std::map<std::string, AccountState> m_accounts;
+    uint64_t m_applied = 0;
+    uint64_t m_ignored = 0;
+};
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_ACCOUNTS_H
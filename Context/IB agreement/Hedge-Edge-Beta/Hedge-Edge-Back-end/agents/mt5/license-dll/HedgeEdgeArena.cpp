@@ -0,0 +1,155 @@
+// ============================================================================
+// Hedge Edge Scratch Arena
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "HedgeEdgeArena.h"
+#include "HedgeEdgeFormat.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    inline char* BlockData(void* block, size_t headerSize)
+    {
+        return static_cast<char*>(block) + headerSize;
+    }
+
+    inline char* AlignUp(char* pointer, size_t alignment)
+    {
+        uintptr_t value = reinterpret_cast<uintptr_t>(pointer);
+        return pointer + ((alignment - value % alignment) % alignment);
+    }
+
+} // namespace
+
+// ============================================================================
+// Arena
+// ============================================================================
+
+Arena::Arena(size_t initialBytes)
+{
+    if (initialBytes == 0) return;
+    m_head = NewBlock(initialBytes);
+    m_cursor = BlockData(m_head, sizeof(Block));
+    m_end = m_cursor + initialBytes;
+}
+
+Arena::~Arena()
+{
+    FreeBlocks(m_head);
+}
+
+Arena::Block* Arena::NewBlock(size_t size)
+{
+    Block* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+    block->next = nullptr;
+    block->size = size;
+    m_stats.heapAllocations++;
+    m_stats.capacity += size;
+    return block;
+}
+
+void Arena::FreeBlocks(Block* block)
+{
+    while (block)
+    {
+        Block* next = block->next;
+        m_stats.capacity -= block->size;
+        ::operator delete(block);
+        block = next;
+    }
+}
+
+void* Arena::Allocate(size_t bytes, size_t alignment)
+{
+    if (alignment == 0) alignment = 1;
+    m_stats.allocations++;
+    m_stats.bytes += bytes;
+
+    char* pointer = m_head ? AlignUp(m_cursor, alignment) : nullptr;
+    if (!m_head || bytes > static_cast<size_t>(m_end - pointer))
+    {
+        // Keep the old block until Reset: earlier allocations still point into it
+        size_t size = std::max(bytes + alignment, m_head ? m_head->size * 2 : ARENA_DEFAULT_BYTES);
+        Block* block = NewBlock(size);
+        block->next = m_head;
+        m_head = block;
+        m_cursor = BlockData(block, sizeof(Block));
+        m_end = m_cursor + size;
+        pointer = AlignUp(m_cursor, alignment);
+    }
+
+    m_used += static_cast<size_t>(pointer + bytes - m_cursor);
+    m_cursor = pointer + bytes;
+    if (m_used > m_stats.highWater) m_stats.highWater = m_used;
+    return pointer;
+}
+
+std::string_view Arena::Copy(const char* text, size_t length)
+{
+    char* copy = static_cast<char*>(Allocate(length, 1));
+    if (length) std::memcpy(copy, text, length);
+    return std::string_view(copy, length);
+}
+
+void Arena::Reset()
+{
+    if (m_depth > 0) return;
+    m_stats.resets++;
+
+    if (m_head && m_head->next)
+    {
+        // Grown during this cycle: one block that holds the whole cycle next time
+        size_t size = m_stats.highWater + m_stats.highWater / 4;
+        FreeBlocks(m_head);
+        m_head = NewBlock(size);
+    }
+
+    m_used = 0;
+    if (m_head)
+    {
+        m_cursor = BlockData(m_head, sizeof(Block));
+        m_end = m_cursor + m_head->size;
+    }
+}
+
+ArenaStats Arena::Stats() const
+{
+    return m_stats;
+}
+
+std::string Arena::StatsJson() const
+{
+    std::string json = "{\"allocations\":";
+    AppendUInt(json, m_stats.allocations);
+    json += ",\"bytes\":";
+    AppendUInt(json, m_stats.bytes);
+    json += ",\"resets\":";
+    AppendUInt(json, m_stats.resets);
+    json += ",\"heapAllocations\":";
+    AppendUInt(json, m_stats.heapAllocations);
+    json += ",\"capacity\":";
+    AppendUInt(json, m_stats.capacity);
+    json += ",\"highWater\":";
+    AppendUInt(json, m_stats.highWater);
+    json += "}";
+    return json;
+}
+
+Arena& ThreadArena()
+{
+    thread_local Arena arena;
+    return arena;
+}
+
+} // namespace hedgeedge
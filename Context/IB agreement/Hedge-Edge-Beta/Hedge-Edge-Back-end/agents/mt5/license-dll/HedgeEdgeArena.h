@@ -0,0 +1,142 @@
+// ============================================================================
+// Hedge Edge Scratch Arena
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Bump allocator for per-message scratch memory (batch frames, unpacked
+// events, heartbeat text). Allocation is a pointer increment; nothing is
+// freed individually. Reset() releases everything at once, at the end of a
+// message or batch.
+//
+// When a cycle overflows the current block, Reset() replaces the chain with
+// one block sized to the high-water mark, so after warm-up an arena serves
+// every message from a single block and never touches the general heap.
+// Inside the terminal process that keeps the EA thread off the heap the
+// terminal itself is contending on.
+//
+// Not synchronized: one arena per thread (ThreadArena) or per object that
+// is already serialized by its own lock.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_ARENA_H
+#define HEDGE_EDGE_ARENA_H
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace hedgeedge {
+
+constexpr size_t ARENA_DEFAULT_BYTES = 16 * 1024;
+
+struct ArenaStats
+{
+    uint64_t allocations = 0;       // Served from the arena
+    uint64_t bytes = 0;             // Requested through Allocate
+    uint64_t resets = 0;
+    uint64_t heapAllocations = 0;   // Blocks taken from the general heap
+    size_t   capacity = 0;          // Bytes currently reserved
+    size_t   highWater = 0;         // Most bytes in use during one cycle
+};
+
+class Arena
+{
+public:
+    explicit Arena(size_t initialBytes = ARENA_DEFAULT_BYTES);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Never returns nullptr (throws std::bad_alloc like operator new)
+    void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    // Copy of `text` living in the arena
+    std::string_view Copy(const char* text, size_t length);
+
+    // Release every allocation (no-op inside a nested ArenaScope)
+    void Reset();
+
+    ArenaStats Stats() const;
+
+    // {"allocations":..,"bytes":..,"resets":..,"heapAllocations":..,"capacity":..,"highWater":..}
+    std::string StatsJson() const;
+
+private:
+    friend class ArenaScope;
+
+    struct Block
+    {
+        Block* next;
+        size_t size;
+    };
+
+    Block* NewBlock(size_t size);
+    void   FreeBlocks(Block* block);
+
+    Block*     m_head = nullptr;     // Current block; older blocks follow
+    char*      m_cursor = nullptr;
+    char*      m_end = nullptr;
+    size_t     m_used = 0;           // In the current cycle, across blocks
+    int        m_depth = 0;
+    ArenaStats m_stats;
+};
+
+// Arena of the calling thread, created on first use
+Arena& ThreadArena();
+
+// Resets the arena when the outermost scope ends
+class ArenaScope
+{
+public:
+    explicit ArenaScope(Arena& arena) : m_arena(arena) { m_arena.m_depth++; }
+    ~ArenaScope()
+    {
+        if (--m_arena.m_depth == 0) m_arena.Reset();
+    }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    Arena& m_arena;
+};
+
+// STL allocator over an arena; deallocate is a no-op
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : m_arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.GetArena()) {}
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T*, size_t) noexcept {}
+
+    Arena* GetArena() const noexcept { return m_arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_arena == other.GetArena(); }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return m_arena != other.GetArena(); }
+
+private:
+    Arena* m_arena;
+};
+
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_ARENA_H
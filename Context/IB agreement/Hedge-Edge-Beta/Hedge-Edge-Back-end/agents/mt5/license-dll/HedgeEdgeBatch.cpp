@@ -0,0 +1,205 @@
+// ============================================================================
+// Hedge Edge Event Batching
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgeFormat.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const char DATA_KEY[] = ",\"data\":";
+
+    // Index one past the JSON value (object/array) starting at `pos`, or npos
+    size_t MatchBracket(std::string_view text, size_t pos)
+    {
+        int depth = 0;
+        bool inString = false;
+        for (size_t i = pos; i < text.size(); i++)
+        {
+            char c = text[i];
+            if (inString)
+            {
+                if (c == '\\') i++;
+                else if (c == '"') inString = false;
+                continue;
+            }
+            if (c == '"') inString = true;
+            else if (c == '{' || c == '[') depth++;
+            else if (c == '}' || c == ']')
+            {
+                if (--depth == 0) return i + 1;
+            }
+        }
+        return std::string_view::npos;
+    }
+
+    inline char* Put(char* out, std::string_view text)
+    {
+        if (!text.empty()) std::memcpy(out, text.data(), text.size());
+        return out + text.size();
+    }
+
+} // namespace
+
+// ============================================================================
+// EventBatch
+// ============================================================================
+
+void EventBatch::Add(const char* event, size_t length)
+{
+    // Drop the first ",<envelope>" without building a search string
+    const char* end = event + length;
+    const char* cut = end;
+    if (!m_envelope.empty())
+    {
+        for (const char* p = event; (p = std::search(p, end, m_envelope.begin(), m_envelope.end())) != end; p++)
+        {
+            if (p > event && p[-1] == ',') { cut = p - 1; break; }
+        }
+    }
+
+    if (m_count) m_events += ',';
+    if (cut == end)
+    {
+        m_events.append(event, length);
+    }
+    else
+    {
+        m_events.append(event, cut);
+        m_events.append(cut + 1 + m_envelope.size(), end);
+    }
+    m_count++;
+}
+
+std::string_view EventBatch::Take(Arena& arena)
+{
+    static const char HEAD[] = "{\"type\":\"BATCH\",\"count\":";
+    static const char ENVELOPE[] = ",\"envelope\":{";
+    static const char EVENTS[] = "},\"events\":[";
+
+    char count[FORMAT_INT_CHARS];
+    size_t countLength = FormatUInt(count, m_count);
+
+    size_t size = sizeof(HEAD) - 1 + countLength + sizeof(ENVELOPE) - 1 + m_envelope.size() +
+                  sizeof(EVENTS) - 1 + m_events.size() + 2;
+    char* frame = static_cast<char*>(arena.Allocate(size, 1));
+    char* p = Put(frame, HEAD);
+    p = Put(p, std::string_view(count, countLength));
+    p = Put(p, ENVELOPE);
+    p = Put(p, m_envelope);
+    p = Put(p, EVENTS);
+    p = Put(p, m_events);
+    p = Put(p, "]}");
+
+    m_events.clear();
+    m_count = 0;
+    return std::string_view(frame, static_cast<size_t>(p - frame));
+}
+
+bool UnpackBatch(const char* data, size_t length, Arena& arena, std::vector<std::string_view>& events)
+{
+    events.clear();
+    std::string_view text(data, length);
+
+    std::string_view envelope;
+    size_t envelopeKey = text.find("\"envelope\":{");
+    if (envelopeKey != std::string_view::npos)
+    {
+        size_t open = envelopeKey + std::strlen("\"envelope\":");
+        size_t close = MatchBracket(text, open);
+        if (close == std::string_view::npos) return false;
+        envelope = text.substr(open + 1, close - open - 2);
+    }
+
+    size_t eventsKey = text.find("\"events\":[");
+    if (eventsKey == std::string_view::npos) return false;
+    size_t pos = eventsKey + std::strlen("\"events\":[");
+
+    while (pos < text.size())
+    {
+        char c = text[pos];
+        if (c == ']') return true;
+        if (c == ',' || c == ' ') { pos++; continue; }
+        if (c != '{') return false;
+
+        size_t end = MatchBracket(text, pos);
+        if (end == std::string_view::npos) return false;
+
+        std::string_view event = text.substr(pos, end - pos);
+        pos = end;
+        if (envelope.empty())
+        {
+            events.push_back(arena.Copy(event.data(), event.size()));
+            continue;
+        }
+
+        // Back where the publisher had it: just before the top-level "data"
+        size_t dataPos = event.find(DATA_KEY);
+        bool separator = dataPos != std::string_view::npos || event.size() > 2;
+        size_t size = event.size() + envelope.size() + (separator ? 1 : 0);
+        char* copy = static_cast<char*>(arena.Allocate(size, 1));
+        char* p = copy;
+        if (dataPos != std::string_view::npos)
+        {
+            p = Put(p, event.substr(0, dataPos));
+            p = Put(p, ",");
+            p = Put(p, envelope);
+            p = Put(p, event.substr(dataPos));
+        }
+        else
+        {
+            p = Put(p, "{");
+            p = Put(p, envelope);
+            if (separator) p = Put(p, ",");
+            p = Put(p, event.substr(1));
+        }
+        events.push_back(std::string_view(copy, static_cast<size_t>(p - copy)));
+    }
+    return false;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall BatchUnpack(const char* batch, int batchLen, char* outEvents, int outLen)
+{
+    if (!batch || batchLen <= 0 || !outEvents || outLen <= 0) return -5;
+
+    // Called for every batch the EA receives: scratch stays on this thread
+    thread_local std::vector<std::string_view> events;
+    hedgeedge::Arena& arena = hedgeedge::ThreadArena();
+    hedgeedge::ArenaScope scope(arena);
+    if (!hedgeedge::UnpackBatch(batch, static_cast<size_t>(batchLen), arena, events)) return -4;
+
+    size_t needed = 1;
+    for (std::string_view event : events) needed += event.size() + 1;
+    if (needed > static_cast<size_t>(outLen)) return -5;
+
+    char* out = outEvents;
+    for (std::string_view event : events)
+    {
+        std::memcpy(out, event.data(), event.size());
+        out += event.size();
+        *out++ = '\n';
+    }
+    *out = '\0';
+    return static_cast<int>(events.size());
+}
+
+} // extern "C"
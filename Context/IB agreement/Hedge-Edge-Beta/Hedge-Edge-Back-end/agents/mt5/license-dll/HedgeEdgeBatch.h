@@ -0,0 +1,85 @@
+// ============================================================================
+// Hedge Edge Event Batching
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Coalesces master events produced in a burst (e.g. "close all") into one
+// "EVENT.B" frame. The envelope fields every event repeats (platform,
+// accountId, role) are sent once:
+//
+//   {"type":"BATCH","count":2,
+//    "envelope":{"platform":"MT5","accountId":"123","role":"master"},
+//    "events":[{"type":"POSITION_CLOSED","eventIndex":7,...,"data":{...}},
+//              {"type":"POSITION_CLOSED","eventIndex":8,...,"data":{...}}]}
+//
+// UnpackBatch restores each event byte-for-byte as it would have been
+// published on its own. Frames and unpacked events are built in a scratch
+// arena (HedgeEdgeArena.h), so neither side allocates per event.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_BATCH_H
+#define HEDGE_EDGE_BATCH_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "HedgeEdgeArena.h"
+
+namespace hedgeedge {
+
+constexpr char BATCH_TOPIC_SUFFIX[] = ".B";
+
+class EventBatch
+{
+public:
+    // Envelope text as it appears inside each event, without braces:
+    // "platform":"MT5","accountId":"123","role":"master"
+    void SetEnvelope(const std::string& envelope) { m_envelope = envelope; }
+
+    // Append one full event JSON object (envelope is stripped)
+    void Add(const char* event, size_t length);
+
+    size_t Count() const { return m_count; }
+    size_t Bytes() const { return m_events.size(); }
+
+    // Build the batch frame in `arena` and start a new batch
+    std::string_view Take(Arena& arena);
+
+private:
+    std::string m_envelope;
+    std::string m_events;   // Comma-separated event objects
+    size_t      m_count = 0;
+};
+
+// Split a batch frame into full event JSON objects, stored in `arena`
+// (valid until its next reset). Returns false if the frame is malformed.
+bool UnpackBatch(const char* data, size_t length, Arena& arena, std::vector<std::string_view>& events);
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Unpack an "EVENT.B" batch into newline-separated event JSON objects.
+ *
+ * @param batch      Batch payload (UTF-8 JSON, without the topic prefix)
+ * @param batchLen   Payload length in bytes
+ * @param outEvents  Buffer receiving the events, one per line (null-terminated)
+ * @param outLen     Size of the output buffer
+ *
+ * @return Number of events (>=0), -4 if malformed, -5 if the buffer is too small
+ */
+HEDGEEDGE_API int __stdcall BatchUnpack(const char* batch, int batchLen, char* outEvents, int outLen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_BATCH_H
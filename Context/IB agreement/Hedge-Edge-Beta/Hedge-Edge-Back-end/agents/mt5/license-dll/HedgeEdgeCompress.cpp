@@ -0,0 +1,428 @@
+// ============================================================================
+// Hedge Edge Message Compression
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <cstring>
+#include <mutex>
+
+#include "HedgeEdgeCompress.h"
+#include "HedgeEdgePlatform.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Runtime Bindings
+// ============================================================================
+
+namespace {
+
+    struct ZstdApi
+    {
+        size_t   (*compressBound)(size_t);
+        unsigned (*isError)(size_t);
+        const char* (*getErrorName)(size_t);
+        void*    (*createCCtx)();
+        size_t   (*freeCCtx)(void*);
+        void*    (*createDCtx)();
+        size_t   (*freeDCtx)(void*);
+        void*    (*createCDict)(const void*, size_t, int);
+        size_t   (*freeCDict)(void*);
+        void*    (*createDDict)(const void*, size_t);
+        size_t   (*freeDDict)(void*);
+        size_t   (*compressCCtx)(void*, void*, size_t, const void*, size_t, int);
+        size_t   (*compressUsingCDict)(void*, void*, size_t, const void*, size_t, const void*);
+        size_t   (*decompressDCtx)(void*, void*, size_t, const void*, size_t);
+        size_t   (*decompressUsingDDict)(void*, void*, size_t, const void*, size_t, const void*);
+        size_t   (*trainFromBuffer)(void*, size_t, const void*, const size_t*, unsigned);
+        unsigned (*dictIsError)(size_t);
+        const char* (*dictGetErrorName)(size_t);
+    };
+
+    struct Lz4Api
+    {
+        int   (*compressBound)(int);
+        void* (*createStream)();
+        int   (*freeStream)(void*);
+        int   (*loadDict)(void*, const char*, int);
+        void  (*resetStreamFast)(void*);                 // optional (lz4 >= 1.9)
+        void  (*attachDictionary)(void*, const void*);   // optional (lz4 >= 1.9)
+        int   (*compressFastContinue)(void*, const char*, char*, int, int, int);
+        int   (*compressFast)(const char*, char*, int, int, int);
+        int   (*decompressSafe)(const char*, char*, int, int);
+        int   (*decompressSafeUsingDict)(const char*, char*, int, int, const char*, int);
+    };
+
+    ZstdApi g_zstd = {};
+    Lz4Api  g_lz4 = {};
+    bool    g_zstdLoaded = false;
+    bool    g_lz4Loaded = false;
+    std::once_flag g_zstdOnce;
+    std::once_flag g_lz4Once;
+
+    template <typename T>
+    bool Bind(void* library, const char* name, T& slot)
+    {
+        slot = reinterpret_cast<T>(LibrarySymbol(library, name));
+        return slot != nullptr;
+    }
+
+    void LoadZstd()
+    {
+#ifdef _WIN32
+        void* library = LoadSharedLibrary({ "libzstd.dll", "zstd.dll" });
+#elif defined(__APPLE__)
+        void* library = LoadSharedLibrary({ "libzstd.1.dylib", "libzstd.dylib" });
+#else
+        void* library = LoadSharedLibrary({ "libzstd.so.1", "libzstd.so" });
+#endif
+        if (!library) return;
+
+        g_zstdLoaded =
+            Bind(library, "ZSTD_compressBound", g_zstd.compressBound) &&
+            Bind(library, "ZSTD_isError", g_zstd.isError) &&
+            Bind(library, "ZSTD_getErrorName", g_zstd.getErrorName) &&
+            Bind(library, "ZSTD_createCCtx", g_zstd.createCCtx) &&
+            Bind(library, "ZSTD_freeCCtx", g_zstd.freeCCtx) &&
+            Bind(library, "ZSTD_createDCtx", g_zstd.createDCtx) &&
+            Bind(library, "ZSTD_freeDCtx", g_zstd.freeDCtx) &&
+            Bind(library, "ZSTD_createCDict", g_zstd.createCDict) &&
+            Bind(library, "ZSTD_freeCDict", g_zstd.freeCDict) &&
+            Bind(library, "ZSTD_createDDict", g_zstd.createDDict) &&
+            Bind(library, "ZSTD_freeDDict", g_zstd.freeDDict) &&
+            Bind(library, "ZSTD_compressCCtx", g_zstd.compressCCtx) &&
+            Bind(library, "ZSTD_compress_usingCDict", g_zstd.compressUsingCDict) &&
+            Bind(library, "ZSTD_decompressDCtx", g_zstd.decompressDCtx) &&
+            Bind(library, "ZSTD_decompress_usingDDict", g_zstd.decompressUsingDDict) &&
+            Bind(library, "ZDICT_trainFromBuffer", g_zstd.trainFromBuffer) &&
+            Bind(library, "ZDICT_isError", g_zstd.dictIsError) &&
+            Bind(library, "ZDICT_getErrorName", g_zstd.dictGetErrorName);
+    }
+
+    void LoadLz4()
+    {
+#ifdef _WIN32
+        void* library = LoadSharedLibrary({ "liblz4.dll", "lz4.dll" });
+#elif defined(__APPLE__)
+        void* library = LoadSharedLibrary({ "liblz4.1.dylib", "liblz4.dylib" });
+#else
+        void* library = LoadSharedLibrary({ "liblz4.so.1", "liblz4.so" });
+#endif
+        if (!library) return;
+
+        g_lz4Loaded =
+            Bind(library, "LZ4_compressBound", g_lz4.compressBound) &&
+            Bind(library, "LZ4_createStream", g_lz4.createStream) &&
+            Bind(library, "LZ4_freeStream", g_lz4.freeStream) &&
+            Bind(library, "LZ4_loadDict", g_lz4.loadDict) &&
+            Bind(library, "LZ4_compress_fast_continue", g_lz4.compressFastContinue) &&
+            Bind(library, "LZ4_compress_fast", g_lz4.compressFast) &&
+            Bind(library, "LZ4_decompress_safe", g_lz4.decompressSafe) &&
+            Bind(library, "LZ4_decompress_safe_usingDict", g_lz4.decompressSafeUsingDict);
+
+        // O(1) dictionary attach; without it the dictionary is re-loaded per message
+        Bind(library, "LZ4_resetStream_fast", g_lz4.resetStreamFast);
+        Bind(library, "LZ4_attach_dictionary", g_lz4.attachDictionary);
+    }
+
+    const ZstdApi* Zstd()
+    {
+        std::call_once(g_zstdOnce, LoadZstd);
+        return g_zstdLoaded ? &g_zstd : nullptr;
+    }
+
+    const Lz4Api* Lz4()
+    {
+        std::call_once(g_lz4Once, LoadLz4);
+        return g_lz4Loaded ? &g_lz4 : nullptr;
+    }
+
+    void PutU32(char* dst, uint32_t value)
+    {
+        for (int i = 0; i < 4; i++) dst[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+
+    uint32_t GetU32(const char* src)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++) value |= static_cast<uint32_t>(static_cast<unsigned char>(src[i])) << (8 * i);
+        return value;
+    }
+
+} // namespace
+
+const char* CodecName(Codec codec)
+{
+    switch (codec)
+    {
+        case Codec::Zstd: return "zstd";
+        case Codec::Lz4:  return "lz4";
+        default:          return "none";
+    }
+}
+
+bool CodecAvailable(Codec codec)
+{
+    switch (codec)
+    {
+        case Codec::Zstd: return Zstd() != nullptr;
+        case Codec::Lz4:  return Lz4() != nullptr;
+        default:          return true;
+    }
+}
+
+uint32_t DictionaryId(const std::string& dictionary)
+{
+    if (dictionary.empty()) return 0;
+
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : dictionary)
+    {
+        hash ^= c;
+        hash *= 16777619u;
+    }
+    return hash ? hash : 1;
+}
+
+// ============================================================================
+// Compressor
+// ============================================================================
+
+struct Compressor::Impl
+{
+    Codec       codec = Codec::None;
+    int         level = 3;
+    std::string dictionary;
+    uint32_t    dictId = 0;
+
+    void* zstdCCtx = nullptr;
+    void* zstdDCtx = nullptr;
+    void* zstdCDict = nullptr;
+    void* zstdDDict = nullptr;
+
+    void* lz4Stream = nullptr;
+    void* lz4DictStream = nullptr;
+
+    ~Impl() { Release(); }
+
+    void Release()
+    {
+        if (const ZstdApi* zstd = g_zstdLoaded ? &g_zstd : nullptr)
+        {
+            if (zstdCCtx) zstd->freeCCtx(zstdCCtx);
+            if (zstdDCtx) zstd->freeDCtx(zstdDCtx);
+            if (zstdCDict) zstd->freeCDict(zstdCDict);
+            if (zstdDDict) zstd->freeDDict(zstdDDict);
+        }
+        if (const Lz4Api* lz4 = g_lz4Loaded ? &g_lz4 : nullptr)
+        {
+            if (lz4Stream) lz4->freeStream(lz4Stream);
+            if (lz4DictStream) lz4->freeStream(lz4DictStream);
+        }
+        zstdCCtx = zstdDCtx = zstdCDict = zstdDDict = nullptr;
+        lz4Stream = lz4DictStream = nullptr;
+    }
+};
+
+Compressor::Compressor()
+    : m_impl(new Impl())
+{
+}
+
+Compressor::~Compressor() = default;
+
+bool Compressor::Configure(Codec codec, const std::string& dictionary, int level)
+{
+    m_impl->Release();
+    m_impl->codec = Codec::None;
+    m_impl->dictionary = dictionary;
+    m_impl->dictId = DictionaryId(dictionary);
+    m_impl->level = level;
+
+    if (codec == Codec::Zstd)
+    {
+        const ZstdApi* zstd = Zstd();
+        if (!zstd) return false;
+
+        m_impl->zstdCCtx = zstd->createCCtx();
+        m_impl->zstdDCtx = zstd->createDCtx();
+        if (!dictionary.empty())
+        {
+            // Digested once; per-message cost is then independent of dictionary size
+            m_impl->zstdCDict = zstd->createCDict(dictionary.data(), dictionary.size(), level > 0 ? level : 3);
+            m_impl->zstdDDict = zstd->createDDict(dictionary.data(), dictionary.size());
+            if (!m_impl->zstdCDict || !m_impl->zstdDDict) return false;
+        }
+        if (!m_impl->zstdCCtx || !m_impl->zstdDCtx) return false;
+    }
+    else if (codec == Codec::Lz4)
+    {
+        const Lz4Api* lz4 = Lz4();
+        if (!lz4) return false;
+
+        m_impl->lz4Stream = lz4->createStream();
+        if (!m_impl->lz4Stream) return false;
+        if (!dictionary.empty() && lz4->attachDictionary && lz4->resetStreamFast)
+        {
+            m_impl->lz4DictStream = lz4->createStream();
+            if (!m_impl->lz4DictStream) return false;
+            lz4->loadDict(m_impl->lz4DictStream, m_impl->dictionary.data(),
+                          static_cast<int>(m_impl->dictionary.size()));
+        }
+    }
+
+    m_impl->codec = codec;
+    return true;
+}
+
+Codec Compressor::GetCodec() const
+{
+    return m_impl->codec;
+}
+
+uint32_t Compressor::DictId() const
+{
+    return m_impl->dictId;
+}
+
+bool Compressor::Compress(const char* src, size_t length, std::string& out)
+{
+    if (m_impl->codec == Codec::None || length > COMPRESSED_MAX_SIZE) return false;
+
+    size_t start = out.size();
+    char header[COMPRESSED_HEADER_SIZE] = {};
+    header[0] = static_cast<char>(m_impl->codec);
+    PutU32(header + 2, m_impl->dictId);
+    PutU32(header + 6, static_cast<uint32_t>(length));
+    out.append(header, sizeof(header));
+
+    size_t payloadStart = out.size();
+    if (m_impl->codec == Codec::Zstd)
+    {
+        const ZstdApi* zstd = &g_zstd;
+        size_t bound = zstd->compressBound(length);
+        out.resize(payloadStart + bound);
+        size_t written = m_impl->zstdCDict
+            ? zstd->compressUsingCDict(m_impl->zstdCCtx, &out[payloadStart], bound, src, length, m_impl->zstdCDict)
+            : zstd->compressCCtx(m_impl->zstdCCtx, &out[payloadStart], bound, src, length, m_impl->level);
+        if (zstd->isError(written))
+        {
+            out.resize(start);
+            return false;
+        }
+        out.resize(payloadStart + written);
+    }
+    else
+    {
+        const Lz4Api* lz4 = &g_lz4;
+        int bound = lz4->compressBound(static_cast<int>(length));
+        int acceleration = m_impl->level > 0 ? m_impl->level : 1;
+        out.resize(payloadStart + static_cast<size_t>(bound));
+        int written;
+        if (m_impl->dictionary.empty())
+        {
+            written = lz4->compressFast(src, &out[payloadStart], static_cast<int>(length), bound, acceleration);
+        }
+        else
+        {
+            if (m_impl->lz4DictStream)
+            {
+                lz4->resetStreamFast(m_impl->lz4Stream);
+                lz4->attachDictionary(m_impl->lz4Stream, m_impl->lz4DictStream);
+            }
+            else
+            {
+                lz4->loadDict(m_impl->lz4Stream, m_impl->dictionary.data(),
+                              static_cast<int>(m_impl->dictionary.size()));
+            }
+            written = lz4->compressFastContinue(m_impl->lz4Stream, src, &out[payloadStart],
+                                                static_cast<int>(length), bound, acceleration);
+        }
+        if (written <= 0)
+        {
+            out.resize(start);
+            return false;
+        }
+        out.resize(payloadStart + static_cast<size_t>(written));
+    }
+    return true;
+}
+
+bool Compressor::Decompress(const char* src, size_t length, std::string& out)
+{
+    if (length < COMPRESSED_HEADER_SIZE) return false;
+
+    Codec codec = static_cast<Codec>(static_cast<unsigned char>(src[0]));
+    uint32_t dictId = GetU32(src + 2);
+    uint32_t rawSize = GetU32(src + 6);
+    if (rawSize > COMPRESSED_MAX_SIZE) return false;
+    if (dictId != 0 && dictId != m_impl->dictId) return false;
+
+    const char* payload = src + COMPRESSED_HEADER_SIZE;
+    size_t payloadLength = length - COMPRESSED_HEADER_SIZE;
+    out.resize(rawSize);
+
+    if (codec == Codec::Zstd)
+    {
+        const ZstdApi* zstd = Zstd();
+        if (!zstd) return false;
+        if (!m_impl->zstdDCtx && !(m_impl->zstdDCtx = zstd->createDCtx())) return false;
+
+        size_t written = (dictId != 0 && m_impl->zstdDDict)
+            ? zstd->decompressUsingDDict(m_impl->zstdDCtx, &out[0], rawSize, payload, payloadLength, m_impl->zstdDDict)
+            : zstd->decompressDCtx(m_impl->zstdDCtx, &out[0], rawSize, payload, payloadLength);
+        return !zstd->isError(written) && written == rawSize;
+    }
+    if (codec == Codec::Lz4)
+    {
+        const Lz4Api* lz4 = Lz4();
+        if (!lz4) return false;
+
+        int written = dictId != 0
+            ? lz4->decompressSafeUsingDict(payload, &out[0], static_cast<int>(payloadLength),
+                                           static_cast<int>(rawSize), m_impl->dictionary.data(),
+                                           static_cast<int>(m_impl->dictionary.size()))
+            : lz4->decompressSafe(payload, &out[0], static_cast<int>(payloadLength), static_cast<int>(rawSize));
+        return written >= 0 && static_cast<uint32_t>(written) == rawSize;
+    }
+    return false;
+}
+
+// ============================================================================
+// Dictionary Training
+// ============================================================================
+
+bool TrainDictionary(const std::vector<std::string>& samples, size_t capacity,
+                     std::string& dictionary, std::string* error)
+{
+    const ZstdApi* zstd = Zstd();
+    if (!zstd)
+    {
+        if (error) *error = "zstd library not available";
+        return false;
+    }
+
+    std::string joined;
+    std::vector<size_t> sizes;
+    sizes.reserve(samples.size());
+    for (const std::string& sample : samples)
+    {
+        joined += sample;
+        sizes.push_back(sample.size());
+    }
+
+    dictionary.resize(capacity);
+    size_t written = zstd->trainFromBuffer(&dictionary[0], capacity, joined.data(), sizes.data(),
+                                           static_cast<unsigned>(sizes.size()));
+    if (zstd->dictIsError(written))
+    {
+        if (error) *error = zstd->dictGetErrorName(written);
+        dictionary.clear();
+        return false;
+    }
+    dictionary.resize(written);
+    return true;
+}
+
+} // namespace hedgeedge
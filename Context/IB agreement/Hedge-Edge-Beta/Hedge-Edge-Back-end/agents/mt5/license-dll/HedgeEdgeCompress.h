@@ -0,0 +1,88 @@
+// ============================================================================
+// Hedge Edge Message Compression
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Dictionary-based zstd / LZ4 compression for master streams crossing a WAN.
+// Hedge Edge messages are small and extremely repetitive (same keys, same
+// symbols), so a dictionary trained on recorded samples does most of the
+// work. Both libraries are bound at run time like libzmq.
+//
+// Compressed frame (after the "TOPIC.Z|" prefix on the wire):
+//   [0]     codec (1 = zstd, 2 = lz4)
+//   [1]     reserved (0)
+//   [2..5]  dictionary id (little endian, 0 = no dictionary)
+//   [6..9]  uncompressed size (little endian)
+//   [10..]  codec payload
+// ============================================================================
+
+#ifndef HEDGE_EDGE_COMPRESS_H
+#define HEDGE_EDGE_COMPRESS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hedgeedge {
+
+enum class Codec : uint8_t
+{
+    None = 0,
+    Zstd = 1,
+    Lz4  = 2,
+};
+
+constexpr size_t   COMPRESSED_HEADER_SIZE = 10;
+constexpr uint32_t COMPRESSED_MAX_SIZE    = 64u * 1024u * 1024u;
+constexpr char     COMPRESSED_TOPIC_SUFFIX[] = ".Z";
+
+// "zstd", "lz4" or "none"
+const char* CodecName(Codec codec);
+
+// True if the codec's runtime library could be loaded
+bool CodecAvailable(Codec codec);
+
+// Stable id of a dictionary (FNV-1a of its bytes, 0 for no dictionary)
+uint32_t DictionaryId(const std::string& dictionary);
+
+// ============================================================================
+// Compressor
+// ============================================================================
+// One instance per thread; contexts are reused between messages.
+
+class Compressor
+{
+public:
+    Compressor();
+    ~Compressor();
+
+    Compressor(const Compressor&) = delete;
+    Compressor& operator=(const Compressor&) = delete;
+
+    // Select codec, dictionary (may be empty) and level (zstd level / lz4
+    // acceleration). Returns false if the codec is unavailable.
+    bool Configure(Codec codec, const std::string& dictionary, int level);
+
+    Codec    GetCodec() const;
+    uint32_t DictId() const;
+
+    // Append one compressed frame for `src` to `out`
+    bool Compress(const char* src, size_t length, std::string& out);
+
+    // Decode one frame into `out` (replaced). Fails on a dictionary mismatch.
+    bool Decompress(const char* src, size_t length, std::string& out);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+// Train a zstd dictionary of at most `capacity` bytes from message samples
+bool TrainDictionary(const std::vector<std::string>& samples, size_t capacity,
+                     std::string& dictionary, std::string* error = nullptr);
+
+} // namespace hedgeedge
+
+#endif // HEDGE_EDGE_COMPRESS_H
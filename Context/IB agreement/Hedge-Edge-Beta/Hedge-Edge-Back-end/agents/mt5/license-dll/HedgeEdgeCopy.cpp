@@ -0,0 +1,335 @@
+// ============================================================================
+// Hedge Edge Copy Decisions
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "HedgeEdgeCopy.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeJson.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    // ParseVolumeUnits: exact steps first, decimal lots otherwise
+    int64_t VolumeUnits(std::string_view object, std::string_view lotsKey)
+    {
+        int64_t steps = JsonInt(object, "volumeSteps", -1);
+        int64_t stepUnits = JsonInt(object, "lotStepE8", 0);
+        if (steps >= 0 && stepUnits > 0) return steps * stepUnits;
+        return LotsToUnits(JsonDouble(object, lotsKey));
+    }
+
+    // ParsePrice: "<key>Scaled" with "digits", else the decimal "<key>"
+    double Price(std::string_view object, const std::string& key)
+    {
+        std::string scaledKey = key + "Scaled";
+        if (JsonHas(object, scaledKey) && JsonHas(object, "digits"))
+        {
+            return UnscalePrice(JsonInt(object, scaledKey), static_cast<int>(JsonInt(object, "digits")));
+        }
+        return JsonDouble(object, key);
+    }
+
+    int Side(std::string_view text)
+    {
+        return text == "SELL" ? -1 : 1;
+    }
+
+    // ParseSnapshotPositions; false without a "positions" array
+    bool ParsePositions(std::string_view object, std::vector<MasterPosition>& positions)
+    {
+        std::string_view array;
+        if (!JsonMember(object, "positions", array)) return false;
+
+        return JsonForEach(array, [&](std::string_view item)
+        {
+            MasterPosition position;
+            position.ticket = static_cast<uint64_t>(JsonInt(item, "id"));
+            if (position.ticket == 0) return;
+
+            position.symbol = JsonString(item, "symbol");
+            position.side = Side(JsonStringView(item, "side"));
+            position.volumeUnits = VolumeUnits(item, "volumeLots");
+            if (position.volumeUnits <= 0) position.volumeUnits = LotsToUnits(JsonDouble(item, "volume") / 100000.0);
+            position.stopLoss = Price(item, "stopLoss");
+            position.takeProfit = Price(item, "takeProfit");
+            positions.push_back(std::move(position));
+        });
+    }
+
+    const char* ActionName(CopyDecision::Action action)
+    {
+        switch (action)
+        {
+            case CopyDecision::Open:   return "OPEN";
+            case CopyDecision::Close:  return "CLOSE";
+            case CopyDecision::Modify: return "MODIFY";
+        }
+        return "?";
+    }
+
+} // namespace
+
+void AppendDecision(std::string& out, const CopyDecision& decision)
+{
+    out += ActionName(decision.action);
+    out += ' ';
+    AppendUInt(out, decision.masterTicket);
+    out += ' ';
+    out += decision.symbol;
+    out += decision.side > 0 ? " BUY " : " SELL ";
+    AppendInt(out, decision.volumeUnits);
+    out += ' ';
+    AppendFixed(out, decision.stopLoss, 8);
+    out += ' ';
+    AppendFixed(out, decision.takeProfit, 8);
+    if (decision.reconcile) out += " reconcile";
+}
+
+// ============================================================================
+// CopyEngine
+// ============================================================================
+
+void CopyEngine::SetSymbol(const std::string& symbol, const CopySymbol& limits)
+{
+    m_symbols[symbol] = limits;
+}
+
+int64_t CopyHedgeUnits(const CopyConfig& config, const CopySymbol& limits, int64_t masterUnits)
+{
+    int64_t maxUnits = LotsToUnits(config.maxLots);
+    if (limits.maxUnits > 0) maxUnits = std::min(maxUnits, limits.maxUnits);
+
+    if (config.fixedLots > 0.0)
+    {
+        return HedgeVolumeUnits(LotsToUnits(config.fixedLots), 1.0, limits.stepUnits, limits.minUnits, maxUnits);
+    }
+    return HedgeVolumeUnits(masterUnits, config.lotMultiplier, limits.stepUnits, limits.minUnits, maxUnits);
+}
+
+int64_t CopyEngine::HedgeUnits(const std::string& symbol, int64_t masterUnits) const
+{
+    auto found = m_symbols.find(symbol);
+    return CopyHedgeUnits(m_config, found != m_symbols.end() ? found->second : CopySymbol(), masterUnits);
+}
+
+bool CopyEngine::Parse(std::string_view topic, std::string_view json, CopySignal& signal) const
+{
+    signal.kind = CopySignal::None;
+    signal.position = MasterPosition();
+    signal.positions.clear();
+
+    if (topic == "SNAPSHOT")
+    {
+        if (!ParsePositions(json, signal.positions)) return false;
+        signal.kind = CopySignal::State;
+        return true;
+    }
+    if (topic != "EVENT") return false;
+
+    std::string_view type = JsonStringView(json, "type");
+    if (type.empty()) return false;
+
+    std::string_view data;
+    bool hasData = JsonMember(json, "data", data);
+
+    if (type == "CONNECTED" || type == "ACCOUNT_UPDATE")
+    {
+        // Reconciles only when the state carries the position list
+        if (hasData && ParsePositions(data, signal.positions)) signal.kind = CopySignal::State;
+        return true;
+    }
+
+    bool opened = type == "POSITION_OPENED";
+    bool closed = type == "POSITION_CLOSED" || type == "POSITION_REVERSED";
+    bool modified = type == "POSITION_MODIFIED";
+    if (!opened && !closed && !modified) return true;
+    if (!hasData) return false;
+
+    MasterPosition& position = signal.position;
+    position.ticket = static_cast<uint64_t>(JsonInt(data, "position"));
+    if (opened)
+    {
+        position.symbol = JsonString(data, "symbol");
+        position.side = Side(JsonStringView(data, "type"));
+        position.volumeUnits = VolumeUnits(data, "volume");
+    }
+    if (opened || modified)
+    {
+        position.stopLoss = Price(data, "stopLoss");
+        position.takeProfit = Price(data, "takeProfit");
+    }
+    signal.kind = opened ? CopySignal::Opened : (closed ? CopySignal::Closed : CopySignal::Modified);
+    return true;
+}
+
+void CopyEngine::Open(const MasterPosition& position, bool reconcile, std::vector<CopyDecision>& decisions)
+{
+    CopyDecision decision;
+    decision.action = CopyDecision::Open;
+    decision.masterTicket = position.ticket;
+    decision.symbol = position.symbol;
+    decision.side = position.side;
+    decision.stopLoss = position.stopLoss;
+    decision.takeProfit = position.takeProfit;
+    decision.reconcile = reconcile;
+
+    // Hedge mode: opposite side, the master's TP becomes the hedge's SL
+    if (m_config.invert)
+    {
+        decision.side = -decision.side;
+        std::swap(decision.stopLoss, decision.takeProfit);
+    }
+    decision.volumeUnits = HedgeUnits(position.symbol, position.volumeUnits);
+
+    Mapped& mapped = m_map[position.ticket];
+    mapped.symbol = position.symbol;
+    mapped.side = decision.side;
+    mapped.volumeUnits = decision.volumeUnits;
+
+    m_opens++;
+    decisions.push_back(std::move(decision));
+}
+
+void CopyEngine::Decide(const CopySignal& signal, std::vector<CopyDecision>& decisions)
+{
+    const MasterPosition& position = signal.position;
+    switch (signal.kind)
+    {
+        case CopySignal::None:
+            return;
+
+        case CopySignal::Opened:
+            if (m_map.count(position.ticket))
+            {
+                m_duplicates++;
+                return;
+            }
+            Open(position, false, decisions);
+            return;
+
+        case CopySignal::Closed:
+        {
+            if (!m_config.copyClose) return;
+            auto mapped = m_map.find(position.ticket);
+            if (mapped == m_map.end())
+            {
+                m_unmapped++;
+                return;
+            }
+
+            CopyDecision decision;
+            decision.action = CopyDecision::Close;
+            decision.masterTicket = position.ticket;
+            decision.symbol = mapped->second.symbol;
+            decision.side = mapped->second.side;
+            decision.volumeUnits = mapped->second.volumeUnits;
+            decisions.push_back(std::move(decision));
+            m_map.erase(mapped);
+            m_closes++;
+            return;
+        }
+
+        case CopySignal::Modified:
+        {
+            if (!m_config.copySLTP) return;
+            auto mapped = m_map.find(position.ticket);
+            if (mapped == m_map.end())
+            {
+                m_unmapped++;
+                return;
+            }
+
+            // As HE_Hedge: the master's new stops are applied unswapped
+            CopyDecision decision;
+            decision.action = CopyDecision::Modify;
+            decision.masterTicket = position.ticket;
+            decision.symbol = mapped->second.symbol;
+            decision.side = mapped->second.side;
+            decision.volumeUnits = mapped->second.volumeUnits;
+            decision.stopLoss = position.stopLoss;
+            decision.takeProfit = position.takeProfit;
+            decisions.push_back(std::move(decision));
+            m_modifies++;
+            return;
+        }
+
+        case CopySignal::State:
+            Reconcile(signal.positions, decisions);
+            return;
+    }
+}
+
+void CopyEngine::Reconcile(const std::vector<MasterPosition>& positions, std::vector<CopyDecision>& decisions)
+{
+    m_reconciles++;
+
+    std::unordered_set<uint64_t> master;
+    master.reserve(positions.size());
+    for (const MasterPosition& position : positions)
+    {
+        master.insert(position.ticket);
+        if (m_map.count(position.ticket)) continue;
+        Open(position, true, decisions);
+        m_reconcileOpens++;
+    }
+
+    if (!m_config.copyClose) return;
+
+    // Orphans in ticket order, so every run closes them in the same order
+    std::vector<uint64_t> orphans;
+    for (const auto& entry : m_map)
+    {
+        if (!master.count(entry.first)) orphans.push_back(entry.first);
+    }
+    std::sort(orphans.begin(), orphans.end());
+    for (uint64_t ticket : orphans)
+    {
+        const Mapped& mapped = m_map[ticket];
+        CopyDecision decision;
+        decision.action = CopyDecision::Close;
+        decision.masterTicket = ticket;
+        decision.symbol = mapped.symbol;
+        decision.side = mapped.side;
+        decision.volumeUnits = mapped.volumeUnits;
+        decision.reconcile = true;
+        decisions.push_back(std::move(decision));
+        m_map.erase(ticket);
+        m_reconcileCloses++;
+    }
+}
+
+std::string CopyEngine::StatsJson() const
+{
+    std::string json = "{\"mapped\":";
+    AppendUInt(json, m_map.size());
+    json += ",\"opens\":";
+    AppendUInt(json, m_opens);
+    json += ",\"closes\":";
+    AppendUInt(json, m_closes);
+    json += ",\"modifies\":";
+    AppendUInt(json, m_modifies);
+    json += ",\"duplicates\":";
+    AppendUInt(json, m_duplicates);
+    json += ",\"unmapped\":";
+    AppendUInt(json, m_unmapped);
+    json += ",\"reconciles\":";
+    AppendUInt(json, m_reconciles);
+    json += ",\"reconcileOpens\":";
+    AppendUInt(json, m_reconcileOpens);
+    json += ",\"reconcileCloses\":";
+    AppendUInt(json, m_reconcileCloses);
+    json += "}";
+    return json;
+}
+
+} // namespace hedgeedge
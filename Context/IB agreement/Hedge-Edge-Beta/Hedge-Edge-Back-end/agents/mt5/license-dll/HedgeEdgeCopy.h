@@ -0,0 +1,165 @@
+// ============================================================================
+// Hedge Edge Copy Decisions
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// The hedge's copy rules in native form, without a terminal: which master
+// events open, close or modify a hedge position, at what volume and with
+// which stops, and what a state message (CONNECTED, ACCOUNT_UPDATE,
+// SNAPSHOT) reconciles. Mirrors HE_Hedge.mq5:
+//
+//   POSITION_OPENED    open the inverted side, SL and TP swapped, volume
+//                      from HedgeVolumeUnits; a mapped ticket is a duplicate
+//   POSITION_CLOSED /  close the mapped position (if closes are copied)
+//   POSITION_REVERSED
+//   POSITION_MODIFIED  modify the mapped position (if SL/TP are copied)
+//   state messages     open unmapped master tickets, close orphans
+//
+// Every decided open is assumed to fill, so the position map follows the
+// master. The replay harness drives it with recorded streams; two runs
+// agree decision for decision unless the copy rules changed.
+//
+// Message handling is split into Parse (JSON extraction) and Decide, so
+// each can be timed on its own.
+//
+// Not synchronized: owned by one thread.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_COPY_H
+#define HEDGE_EDGE_COPY_H
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "HedgeEdgeFixed.h"
+
+namespace hedgeedge {
+
+struct CopyConfig
+{
+    bool    invert = true;                  // InpInvertTrades
+    double  lotMultiplier = 1.0;
+    double  fixedLots = 0.0;                // > 0 replaces the multiplier
+    double  maxLots = 100.0;                // InpMaxLots
+    bool    copyClose = true;               // InpCopyCloseSignals
+    bool    copySLTP = true;                // InpCopySLTP
+};
+
+// Hedge-side volume limits of a symbol, in 1e-8 lots
+struct CopySymbol
+{
+    int64_t stepUnits = LOT_UNITS_PER_LOT / 100;
+    int64_t minUnits = LOT_UNITS_PER_LOT / 100;
+    int64_t maxUnits = 0;                   // 0 = only maxLots applies
+};
+
+// Hedge volume for a master volume (CalculateLotSize): fixed lots or the
+// multiplier, floored to the step, clamped to [min, min(max, maxLots)]
+int64_t CopyHedgeUnits(const CopyConfig& config, const CopySymbol& limits, int64_t masterUnits);
+
+struct MasterPosition
+{
+    uint64_t    ticket = 0;
+    std::string symbol;
+    int         side = 1;                   // +1 BUY, -1 SELL
+    int64_t     volumeUnits = 0;
+    double      stopLoss = 0.0;
+    double      takeProfit = 0.0;
+};
+
+// One parsed message
+struct CopySignal
+{
+    enum Kind
+    {
+        None = 0,                           // Not relevant to copying
+        Opened,
+        Closed,
+        Modified,
+        State,                              // positions holds the master's book
+    };
+
+    Kind                        kind = None;
+    MasterPosition              position;   // Opened / Closed / Modified
+    std::vector<MasterPosition> positions;  // State
+};
+
+struct CopyDecision
+{
+    enum Action
+    {
+        Open = 0,
+        Close,
+        Modify,
+    };
+
+    Action      action = Open;
+    uint64_t    masterTicket = 0;
+    std::string symbol;
+    int         side = 1;                   // Hedge side
+    int64_t     volumeUnits = 0;            // Hedge volume (Open)
+    double      stopLoss = 0.0;             // Hedge stops (Open / Modify)
+    double      takeProfit = 0.0;
+    bool        reconcile = false;          // Decided by a state message
+};
+
+class CopyEngine
+{
+public:
+    explicit CopyEngine(const CopyConfig& config) : m_config(config) {}
+
+    // Hedge symbol limits (default: 0.01 step and minimum)
+    void SetSymbol(const std::string& symbol, const CopySymbol& limits);
+
+    // Extract what copying needs from a plain "EVENT" or "SNAPSHOT" message.
+    // Returns false if the message is not JSON the hedge understands.
+    bool Parse(std::string_view topic, std::string_view json, CopySignal& signal) const;
+
+    // Apply a parsed message; appends the resulting decisions
+    void Decide(const CopySignal& signal, std::vector<CopyDecision>& decisions);
+
+    size_t MappedPositions() const { return m_map.size(); }
+
+    // Hedge volume for a master volume (CalculateLotSize)
+    int64_t HedgeUnits(const std::string& symbol, int64_t masterUnits) const;
+
+    std::string StatsJson() const;
+
+private:
+    struct Mapped
+    {
+        std::string symbol;
+        int         side = 1;
+        int64_t     volumeUnits = 0;
+    };
+
+    void Open(const MasterPosition& position, bool reconcile, std::vector<CopyDecision>& decisions);
+    void Reconcile(const std::vector<MasterPosition>& positions, std::vector<CopyDecision>& decisions);
+
+    CopyConfig  m_config;
+    std::unordered_map<std::string, CopySymbol> m_symbols;
+    std::unordered_map<uint64_t, Mapped>        m_map;      // Master ticket -> hedge position
+    uint64_t    m_opens = 0;
+    uint64_t    m_closes = 0;
+    uint64_t    m_modifies = 0;
+    uint64_t    m_duplicates = 0;
+    uint64_t    m_unmapped = 0;
+    uint64_t    m_reconciles = 0;
+    uint64_t    m_reconcileOpens = 0;
+    uint64_t    m_reconcileCloses = 0;
+};
+
+// Stable text of a decision ("OPEN 123 EURUSD SELL 10000000 ..."), for
+// digests and diffs between runs
+void AppendDecision(std::string& out, const CopyDecision& decision);
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_COPY_H
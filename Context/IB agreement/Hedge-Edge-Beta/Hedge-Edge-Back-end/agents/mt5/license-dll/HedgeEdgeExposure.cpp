@@ -0,0 +1,615 @@
+// ============================================================================
+// Hedge Edge Exposure Book
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <numeric>
+
+#include "HedgeEdgeExposure.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeJson.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define HEDGEEDGE_EXPOSURE_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HEDGEEDGE_EXPOSURE_SSE2 1
+#endif
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const char* const BOOK_NAMES[EXPOSURE_BOOKS] = { "master", "hedge" };
+
+    void AppendBook(std::string& out, const BookExposure& book)
+    {
+        out += "{\"netLots\":";
+        AppendFixed(out, book.netLots, 2);
+        out += ",\"grossLots\":";
+        AppendFixed(out, book.grossLots, 2);
+        out += ",\"notional\":";
+        AppendFixed(out, book.notional, 2);
+        out += ",\"pnl\":";
+        AppendFixed(out, book.pnl, 2);
+        out += "}";
+    }
+
+} // anonymous namespace
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+double ExposureKernelScalar(const double* lots, const double* open, double* pnl, size_t count,
+                            double bid, double ask, double value)
+{
+    double total = 0.0;
+    for (size_t i = 0; i < count; i++)
+    {
+        double mark = lots[i] > 0.0 ? bid : ask;
+        pnl[i] = (mark - open[i]) * lots[i] * value;
+        total += pnl[i];
+    }
+    return total;
+}
+
+// Two accumulators per lane: the adds are the critical path, not the multiplies
+double ExposureKernel(const double* lots, const double* open, double* pnl, size_t count,
+                      double bid, double ask, double value)
+{
+    size_t i = 0;
+    double total = 0.0;
+
+#if defined(HEDGEEDGE_EXPOSURE_AVX)
+    const __m256d bidVec = _mm256_set1_pd(bid);
+    const __m256d askVec = _mm256_set1_pd(ask);
+    const __m256d valueVec = _mm256_set1_pd(value);
+    const __m256d zero = _mm256_setzero_pd();
+    __m256d acc0 = zero, acc1 = zero;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256d l0 = _mm256_loadu_pd(lots + i);
+        __m256d l1 = _mm256_loadu_pd(lots + i + 4);
+        __m256d mark0 = _mm256_blendv_pd(askVec, bidVec, _mm256_cmp_pd(l0, zero, _CMP_GT_OQ));
+        __m256d mark1 = _mm256_blendv_pd(askVec, bidVec, _mm256_cmp_pd(l1, zero, _CMP_GT_OQ));
+        __m256d p0 = _mm256_mul_pd(_mm256_mul_pd(_mm256_sub_pd(mark0, _mm256_loadu_pd(open + i)), l0), valueVec);
+        __m256d p1 = _mm256_mul_pd(_mm256_mul_pd(_mm256_sub_pd(mark1, _mm256_loadu_pd(open + i + 4)), l1), valueVec);
+        _mm256_storeu_pd(pnl + i, p0);
+        _mm256_storeu_pd(pnl + i + 4, p1);
+        acc0 = _mm256_add_pd(acc0, p0);
+        acc1 = _mm256_add_pd(acc1, p1);
+    }
+    if (i > 0)
+    {
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, _mm256_add_pd(acc0, acc1));
+        total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+#elif defined(HEDGEEDGE_EXPOSURE_SSE2)
+    const __m128d bidVec = _mm_set1_pd(bid);
+    const __m128d askVec = _mm_set1_pd(ask);
+    const __m128d valueVec = _mm_set1_pd(value);
+    const __m128d zero = _mm_setzero_pd();
+    __m128d acc0 = zero, acc1 = zero;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128d l0 = _mm_loadu_pd(lots + i);
+        __m128d l1 = _mm_loadu_pd(lots + i + 2);
+        __m128d long0 = _mm_cmpgt_pd(l0, zero);
+        __m128d long1 = _mm_cmpgt_pd(l1, zero);
+        __m128d mark0 = _mm_or_pd(_mm_and_pd(long0, bidVec), _mm_andnot_pd(long0, askVec));
+        __m128d mark1 = _mm_or_pd(_mm_and_pd(long1, bidVec), _mm_andnot_pd(long1, askVec));
+        __m128d p0 = _mm_mul_pd(_mm_mul_pd(_mm_sub_pd(mark0, _mm_loadu_pd(open + i)), l0), valueVec);
+        __m128d p1 = _mm_mul_pd(_mm_mul_pd(_mm_sub_pd(mark1, _mm_loadu_pd(open + i + 2)), l1), valueVec);
+        _mm_storeu_pd(pnl + i, p0);
+        _mm_storeu_pd(pnl + i + 2, p1);
+        acc0 = _mm_add_pd(acc0, p0);
+        acc1 = _mm_add_pd(acc1, p1);
+    }
+    if (i > 0)
+    {
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, _mm_add_pd(acc0, acc1));
+        total = lanes[0] + lanes[1];
+    }
+#endif
+
+    if (i < count)
+    {
+        total += ExposureKernelScalar(lots + i, open + i, pnl + i, count - i, bid, ask, value);
+    }
+    return total;
+}
+
+const char* ExposureKernelName()
+{
+#if defined(HEDGEEDGE_EXPOSURE_AVX)
+    return "avx";
+#elif defined(HEDGEEDGE_EXPOSURE_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+// ============================================================================
+// ExposureBook
+// ============================================================================
+
+int ExposureBook::AddSymbol(const std::string& symbol, int digits, double valuePerPrice)
+{
+    auto found = m_symbolIds.find(symbol);
+    int id;
+    if (found != m_symbolIds.end())
+    {
+        id = found->second;
+    }
+    else
+    {
+        id = static_cast<int>(m_symbols.size());
+        m_symbols.emplace_back();
+        m_symbols.back().symbol = symbol;
+        m_symbolIds.emplace(symbol, id);
+    }
+    m_symbols[id].digits = digits;
+    m_symbols[id].valuePerPrice = valuePerPrice;
+    return id;
+}
+
+bool ExposureBook::SetQuote(int symbolId, double bid, double ask)
+{
+    if (symbolId < 0 || symbolId >= static_cast<int>(m_symbols.size())) return false;
+    m_symbols[symbolId].bid = bid;
+    m_symbols[symbolId].ask = ask;
+    return true;
+}
+
+void ExposureBook::SetPrices(const double* bids, const double* asks, size_t count)
+{
+    count = std::min(count, m_symbols.size());
+    for (size_t i = 0; i < count; i++)
+    {
+        m_symbols[i].bid = bids[i];
+        m_symbols[i].ask = asks[i];
+    }
+}
+
+bool ExposureBook::Upsert(int book, uint64_t ticket, int symbolId, int side, double lots, double openPrice)
+{
+    if (book < 0 || book >= EXPOSURE_BOOKS) return false;
+    if (symbolId < 0 || symbolId >= static_cast<int>(m_symbols.size())) return false;
+    if (!(lots > 0.0) || !std::isfinite(openPrice)) return false;
+
+    uint32_t key = Key(symbolId, book);
+    double signedLots = side < 0 ? -lots : lots;
+
+    auto found = m_index[book].find(ticket);
+    if (found != m_index[book].end())
+    {
+        uint32_t slot = found->second;
+        if (m_keys[slot] != key)
+        {
+            m_keys[slot] = key;
+            m_dirty = true;
+        }
+        m_lots[slot] = signedLots;
+        m_open[slot] = openPrice;
+        m_lotsDirty = true;
+        return true;
+    }
+
+    m_index[book].emplace(ticket, static_cast<uint32_t>(m_tickets.size()));
+    m_tickets.push_back(ticket);
+    m_keys.push_back(key);
+    m_lots.push_back(signedLots);
+    m_open.push_back(openPrice);
+    m_pnl.push_back(0.0);
+    m_dirty = true;
+    return true;
+}
+
+bool ExposureBook::Remove(int book, uint64_t ticket)
+{
+    if (book < 0 || book >= EXPOSURE_BOOKS) return false;
+    auto found = m_index[book].find(ticket);
+    if (found == m_index[book].end()) return false;
+
+    uint32_t slot = found->second;
+    m_index[book].erase(found);
+    Erase(slot);
+    return true;
+}
+
+void ExposureBook::ClearBook(int book)
+{
+    if (book < 0 || book >= EXPOSURE_BOOKS || m_index[book].empty()) return;
+
+    m_index[book].clear();
+    for (size_t slot = m_tickets.size(); slot-- > 0;)
+    {
+        if (static_cast<int>(m_keys[slot] & 1u) == book) Erase(slot);
+    }
+}
+
+// Move the last slot into `slot` (its index entry, if any, follows it)
+void ExposureBook::Erase(size_t slot)
+{
+    size_t last = m_tickets.size() - 1;
+    if (slot != last)
+    {
+        m_tickets[slot] = m_tickets[last];
+        m_keys[slot] = m_keys[last];
+        m_lots[slot] = m_lots[last];
+        m_open[slot] = m_open[last];
+        m_pnl[slot] = m_pnl[last];
+
+        auto& index = m_index[m_keys[slot] & 1u];
+        auto moved = index.find(m_tickets[slot]);
+        if (moved != index.end()) moved->second = static_cast<uint32_t>(slot);
+    }
+    m_tickets.pop_back();
+    m_keys.pop_back();
+    m_lots.pop_back();
+    m_open.pop_back();
+    m_pnl.pop_back();
+    m_dirty = true;
+}
+
+// Sort the arrays by key (ticket within a key) and rebuild the runs
+void ExposureBook::Arrange()
+{
+    size_t count = m_tickets.size();
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b)
+    {
+        return m_keys[a] != m_keys[b] ? m_keys[a] < m_keys[b] : m_tickets[a] < m_tickets[b];
+    });
+
+    auto permute = [&order](auto& values)
+    {
+        auto sorted = values;
+        for (size_t i = 0; i < order.size(); i++) sorted[i] = values[order[i]];
+        values.swap(sorted);
+    };
+    permute(m_tickets);
+    permute(m_keys);
+    permute(m_lots);
+    permute(m_open);
+    permute(m_pnl);
+
+    m_runs.clear();
+    for (size_t slot = 0; slot < count; slot++)
+    {
+        m_index[m_keys[slot] & 1u][m_tickets[slot]] = static_cast<uint32_t>(slot);
+        if (m_runs.empty() || m_runs.back().key != m_keys[slot])
+        {
+            Run run;
+            run.key = m_keys[slot];
+            run.begin = static_cast<uint32_t>(slot);
+            m_runs.push_back(run);
+        }
+        m_runs.back().end = static_cast<uint32_t>(slot + 1);
+    }
+
+    m_dirty = false;
+    m_sorts++;
+    SumRuns();
+}
+
+// Long and short lots per run: they only move with the positions, not the prices
+void ExposureBook::SumRuns()
+{
+    for (Run& run : m_runs)
+    {
+        run.longLots = 0.0;
+        run.shortLots = 0.0;
+        for (uint32_t i = run.begin; i < run.end; i++)
+        {
+            if (m_lots[i] > 0.0) run.longLots += m_lots[i];
+            else                 run.shortLots -= m_lots[i];
+        }
+    }
+    m_lotsDirty = false;
+}
+
+void ExposureBook::Compute()
+{
+    uint64_t start = NowNanos();
+    if (m_dirty)          Arrange();
+    else if (m_lotsDirty) SumRuns();
+
+    for (SymbolExposure& symbol : m_symbols)
+    {
+        for (BookExposure& book : symbol.books) book = BookExposure();
+        symbol.unpriced = 0;
+    }
+
+    for (const Run& run : m_runs)
+    {
+        SymbolExposure& symbol = m_symbols[run.key >> 1];
+
+        // No quote yet: lots still add up, P&L and notional stay 0
+        double bid = symbol.bid;
+        double ask = symbol.ask;
+        double value = symbol.valuePerPrice;
+        if (!(bid > 0.0 && ask > 0.0))
+        {
+            bid = ask = value = 0.0;
+            symbol.unpriced += run.end - run.begin;
+        }
+
+        BookExposure& book = symbol.books[run.key & 1u];
+        book.netLots = run.longLots - run.shortLots;
+        book.grossLots = run.longLots + run.shortLots;
+        book.notional = (bid * run.longLots - ask * run.shortLots) * value;
+        book.pnl = ExposureKernel(m_lots.data() + run.begin, m_open.data() + run.begin,
+                                  m_pnl.data() + run.begin, run.end - run.begin, bid, ask, value);
+    }
+
+    m_computes++;
+    m_lastComputeEndNs = NowNanos();
+    m_lastComputeNs = m_lastComputeEndNs - start;
+    m_maxComputeNs = std::max(m_maxComputeNs, m_lastComputeNs);
+}
+
+bool ExposureBook::PositionPnl(int book, uint64_t ticket, double* pnl) const
+{
+    if (book < 0 || book >= EXPOSURE_BOOKS) return false;
+    auto found = m_index[book].find(ticket);
+    if (found == m_index[book].end()) return false;
+    *pnl = m_pnl[found->second];
+    return true;
+}
+
+BookExposure ExposureBook::Total(int book) const
+{
+    BookExposure total;
+    if (book < 0 || book >= EXPOSURE_BOOKS) return total;
+    for (const SymbolExposure& symbol : m_symbols)
+    {
+        const BookExposure& one = symbol.books[book];
+        total.netLots += one.netLots;
+        total.grossLots += one.grossLots;
+        total.notional += one.notional;
+        total.pnl += one.pnl;
+    }
+    return total;
+}
+
+std::string ExposureBook::Json() const
+{
+    std::string json;
+    json.reserve(256 + m_symbols.size() * 320);
+    json += "{\"symbols\":[";
+
+    bool first = true;
+    for (const SymbolExposure& symbol : m_symbols)
+    {
+        BookExposure net;
+        for (const BookExposure& book : symbol.books)
+        {
+            net.netLots += book.netLots;
+            net.grossLots += book.grossLots;
+            net.notional += book.notional;
+            net.pnl += book.pnl;
+        }
+        if (net.grossLots == 0.0) continue;
+
+        if (!first) json += ",";
+        first = false;
+        json += "{\"symbol\":";
+        AppendJsonString(json, symbol.symbol);
+        json += ",\"bid\":";
+        AppendFixed(json, symbol.bid, symbol.digits);
+        json += ",\"ask\":";
+        AppendFixed(json, symbol.ask, symbol.digits);
+        for (int book = 0; book < EXPOSURE_BOOKS; book++)
+        {
+            json += ",\"";
+            json += BOOK_NAMES[book];
+            json += "\":";
+            AppendBook(json, symbol.books[book]);
+        }
+        json += ",\"netLots\":";
+        AppendFixed(json, net.netLots, 2);
+        json += ",\"notional\":";
+        AppendFixed(json, net.notional, 2);
+        json += ",\"pnl\":";
+        AppendFixed(json, net.pnl, 2);
+        json += ",\"priced\":";
+        json += symbol.unpriced == 0 ? "true" : "false";
+        json += "}";
+    }
+
+    json += "]";
+    double pnl = 0.0;
+    for (int book = 0; book < EXPOSURE_BOOKS; book++)
+    {
+        BookExposure total = Total(book);
+        pnl += total.pnl;
+        json += ",\"";
+        json += BOOK_NAMES[book];
+        json += "\":";
+        AppendBook(json, total);
+    }
+    json += ",\"pnl\":";
+    AppendFixed(json, pnl, 2);
+    // Wall time of the last compute, from its steady-clock age
+    json += ",\"computedAtUs\":";
+    AppendUInt(json, m_computes == 0 ? 0 : WallMicros() - (NowNanos() - m_lastComputeEndNs) / 1000);
+    json += "}";
+    return json;
+}
+
+std::string ExposureBook::StatsJson() const
+{
+    std::string json = "{\"positions\":";
+    AppendUInt(json, m_tickets.size());
+    for (int book = 0; book < EXPOSURE_BOOKS; book++)
+    {
+        json += ",\"";
+        json += BOOK_NAMES[book];
+        json += "Positions\":";
+        AppendUInt(json, m_index[book].size());
+    }
+    json += ",\"symbols\":";
+    AppendUInt(json, m_symbols.size());
+    json += ",\"runs\":";
+    AppendUInt(json, m_runs.size());
+    json += ",\"computes\":";
+    AppendUInt(json, m_computes);
+    json += ",\"sorts\":";
+    AppendUInt(json, m_sorts);
+    json += ",\"lastComputeNs\":";
+    AppendUInt(json, m_lastComputeNs);
+    json += ",\"maxComputeNs\":";
+    AppendUInt(json, m_maxComputeNs);
+    json += ",\"kernel\":\"";
+    json += ExposureKernelName();
+    json += "\"}";
+    return json;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    hedgeedge::HandleTable<hedgeedge::ExposureBook> g_exposureBooks;
+
+    int CopyOut(const std::string& text, char* out, int len)
+    {
+        if (!out || len <= 0) return -5;
+        if (text.size() >= static_cast<size_t>(len)) return -5;
+        std::memcpy(out, text.c_str(), text.size() + 1);
+        return static_cast<int>(text.size());
+    }
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall ExposureCreate()
+{
+    return g_exposureBooks.Add(std::make_shared<hedgeedge::ExposureBook>());
+}
+
+HEDGEEDGE_API int __stdcall ExposureAddSymbol(int handle, const char* symbol, int digits, double valuePerPrice)
+{
+    auto book = g_exposureBooks.Get(handle);
+    if (!book) return -1;
+    if (!symbol || !*symbol || digits < 0 || digits > 8 || !(valuePerPrice >= 0.0)) return -5;
+    return book->AddSymbol(symbol, digits, valuePerPrice);
+}
+
+HEDGEEDGE_API int __stdcall ExposureSetPrices(int handle, const double* bids, const double* asks, int count)
+{
+    auto book = g_exposureBooks.Get(handle);
+    if (!book) return -1;
+    if (!bids || !asks || count < 0) return -5;
+    book->SetPrices(bids, asks, static_cast<size_t>(count));
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall ExposureUpsert(int handle, int book, long long ticket, int symbolId, int type,
+                                           double volume, double openPrice)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (!exposure) return -1;
+    if (type != 0 && type != 1) return -5;
+    return exposure->Upsert(book, static_cast<uint64_t>(ticket), symbolId, type == 0 ? 1 : -1,
+                            volume, openPrice) ? 0 : -5;
+}
+
+HEDGEEDGE_API int __stdcall ExposureRemove(int handle, int book, long long ticket)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (!exposure) return -1;
+    return exposure->Remove(book, static_cast<uint64_t>(ticket)) ? 0 : -4;
+}
+
+HEDGEEDGE_API void __stdcall ExposureClearBook(int handle, int book)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (exposure) exposure->ClearBook(book);
+}
+
+HEDGEEDGE_API int __stdcall ExposureCompute(int handle, double* outPnl)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (!exposure) return -1;
+
+    exposure->Compute();
+    if (outPnl)
+    {
+        double pnl = 0.0;
+        for (int book = 0; book < hedgeedge::EXPOSURE_BOOKS; book++) pnl += exposure->Total(book).pnl;
+        *outPnl = pnl;
+    }
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall ExposureGetSymbol(int handle, int symbolId, int book, double* netLots,
+                                              double* notional, double* pnl)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (!exposure) return -1;
+    if (symbolId < 0 || symbolId >= static_cast<int>(exposure->SymbolCount()) ||
+        book < 0 || book >= hedgeedge::EXPOSURE_BOOKS)
+    {
+        return -5;
+    }
+
+    const hedgeedge::BookExposure& one = exposure->Symbol(symbolId).books[book];
+    if (netLots) *netLots = one.netLots;
+    if (notional) *notional = one.notional;
+    if (pnl) *pnl = one.pnl;
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall ExposurePositionPnl(int handle, int book, long long ticket, double* pnl)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (!exposure) return -1;
+    if (!pnl) return -5;
+    return exposure->PositionPnl(book, static_cast<uint64_t>(ticket), pnl) ? 0 : -4;
+}
+
+HEDGEEDGE_API int __stdcall ExposureJson(int handle, char* outJson, int jsonLen)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (!exposure) return -1;
+    return CopyOut(exposure->Json(), outJson, jsonLen);
+}
+
+HEDGEEDGE_API int __stdcall ExposureStats(int handle, char* outJson, int jsonLen)
+{
+    auto exposure = g_exposureBooks.Get(handle);
+    if (!exposure) return -1;
+    return CopyOut(exposure->StatsJson(), outJson, jsonLen);
+}
+
+HEDGEEDGE_API void __stdcall ExposureClose(int handle)
+{
+    g_exposureBooks.Remove(handle);
+}
+
+} // extern "C"
@@ -0,0 +1,261 @@
+// ============================================================================
+// Hedge Edge Exposure Book
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Net lots, notional and floating P&L per symbol for two books (the master's
+// positions and the hedge's own), recomputed from a price vector in one pass
+// so the hedge EA can afford it on every tick.
+//
+// Positions are stored as a struct of arrays (ticket, sort key, signed lots,
+// open price, P&L), kept ordered by symbol and book. Every run of equal keys
+// shares one quote and one value per price unit, so the kernel over a run is
+// a branch-free pass over contiguous doubles:
+//
+//     mark    = lots[i] > 0 ? bid : ask      (BUY closes at the bid)
+//     pnl[i]  = (mark - open[i]) * lots[i] * valuePerPrice
+//
+// summing the run's P&L on the way. It uses AVX when the build enables it,
+// SSE2 on any x64 build, and plain C++ elsewhere. Long and short lots per run
+// do not depend on prices: they are summed when positions change, and net
+// lots and notional per tick cost one multiply-add per run.
+//
+// Volume, side and open price changes update the arrays in place. A new or
+// removed position, or one whose symbol changed, re-sorts the arrays on the
+// next Compute.
+//
+// Values per price unit come from the terminal (tick value / tick size), so
+// notional and P&L are in the hedge account's currency, master positions
+// included.
+//
+// Not synchronized: owned by one thread.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_EXPOSURE_H
+#define HEDGE_EDGE_EXPOSURE_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hedgeedge {
+
+constexpr int EXPOSURE_BOOKS = 2;           // 0 = master, 1 = hedge
+
+// One run: mark = bid for lots > 0, ask otherwise;
+// pnl[i] = (mark - open[i]) * lots[i] * value. Returns the run's P&L.
+// ExposureKernelName: "avx", "sse2" or "scalar".
+double ExposureKernel(const double* lots, const double* open, double* pnl, size_t count,
+                      double bid, double ask, double value);
+double ExposureKernelScalar(const double* lots, const double* open, double* pnl, size_t count,
+                            double bid, double ask, double value);
+const char* ExposureKernelName();
+
+struct BookExposure
+{
+    double netLots = 0.0;                   // Long - short
+    double grossLots = 0.0;                 // Long + short
+    double notional = 0.0;                  // Net lots x mark x value, signed
+    double pnl = 0.0;
+};
+
+struct SymbolExposure
+{
+    std::string  symbol;
+    int          digits = 5;
+    double       valuePerPrice = 0.0;       // Account currency per 1.0 price move per lot
+    double       bid = 0.0;
+    double       ask = 0.0;
+    BookExposure books[EXPOSURE_BOOKS];
+    size_t       unpriced = 0;              // Positions skipped for want of a quote
+};
+
+class ExposureBook
+{
+public:
+    // Register a symbol (or update its value / digits); returns its id, the
+    // index into the price vector
+    int AddSymbol(const std::string& symbol, int digits, double valuePerPrice);
+
+    bool SetQuote(int symbolId, double bid, double ask);
+
+    // Price vector indexed by symbol id (count <= symbol count)
+    void SetPrices(const double* bids, const double* asks, size_t count);
+
+    // side: +1 BUY, -1 SELL; lots > 0
+    bool Upsert(int book, uint64_t ticket, int symbolId, int side, double lots, double openPrice);
+    bool Remove(int book, uint64_t ticket);
+    void ClearBook(int book);
+
+    // One pass over every position at the current prices
+    void Compute();
+
+    size_t Count() const        { return m_tickets.size(); }
+    size_t SymbolCount() const  { return m_symbols.size(); }
+    const SymbolExposure& Symbol(int symbolId) const { return m_symbols[symbolId]; }
+
+    // Floating P&L of one position at the last Compute
+    bool PositionPnl(int book, uint64_t ticket, double* pnl) const;
+
+    // Sum over symbols for one book
+    BookExposure Total(int book) const;
+
+    // {"symbols":[{"symbol":..,"master":{..},"hedge":{..},"netLots":..,"pnl":..}],
+    //  "master":{..},"hedge":{..},"computedAtUs":..}
+    std::string Json() const;
+
+    // {"positions":..,"symbols":..,"runs":..,"computes":..,"sorts":..,"kernel":..,..}
+    std::string StatsJson() const;
+
+private:
+    struct Run
+    {
+        uint32_t key = 0;
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        double   longLots = 0.0;
+        double   shortLots = 0.0;           // Positive
+    };
+
+    // Symbol, then book: runs of one key share a quote and a value
+    static uint32_t Key(int symbolId, int book)
+    {
+        return (static_cast<uint32_t>(symbolId) << 1) | static_cast<uint32_t>(book);
+    }
+
+    void Arrange();
+    void SumRuns();
+    void Erase(size_t slot);
+
+    std::vector<SymbolExposure> m_symbols;
+    std::unordered_map<std::string, int> m_symbolIds;
+
+    // Struct of arrays, one slot per position
+    std::vector<uint64_t> m_tickets;
+    std::vector<uint32_t> m_keys;
+    std::vector<double>   m_lots;           // Signed: + BUY, - SELL
+    std::vector<double>   m_open;
+    std::vector<double>   m_pnl;
+    std::unordered_map<uint64_t, uint32_t> m_index[EXPOSURE_BOOKS];     // Ticket -> slot
+
+    std::vector<Run>    m_runs;
+    bool                m_dirty = false;        // Positions added, removed or moved: re-sort
+    bool                m_lotsDirty = false;    // Volumes changed in place: re-sum the runs
+
+    uint64_t m_computes = 0;
+    uint64_t m_sorts = 0;
+    uint64_t m_lastComputeNs = 0;
+    uint64_t m_maxComputeNs = 0;
+    uint64_t m_lastComputeEndNs = 0;        // NowNanos() (no wall clock read per tick)
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Exposure Book (Hedge EA)
+// ============================================================================
+
+/**
+ * Create an empty exposure book.
+ *
+ * @return Handle (>0) on success
+ */
+HEDGEEDGE_API int __stdcall ExposureCreate();
+
+/**
+ * Register a symbol, or update its digits and value.
+ *
+ * @param valuePerPrice  SYMBOL_TRADE_TICK_VALUE / SYMBOL_TRADE_TICK_SIZE
+ *
+ * @return Symbol id (>= 0, index into the price vector), -1 if not open,
+ *         -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall ExposureAddSymbol(int handle, const char* symbol, int digits, double valuePerPrice);
+
+/**
+ * Bid / ask for every symbol id from 0 to count - 1.
+ *
+ * @return 0 on success, -1 if not open, -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall ExposureSetPrices(int handle, const double* bids, const double* asks, int count);
+
+/**
+ * Insert or update one position.
+ *
+ * @param book  0 = master, 1 = hedge
+ * @param type  0 = BUY, 1 = SELL
+ *
+ * @return 0 on success, -1 if not open, -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall ExposureUpsert(int handle, int book, long long ticket, int symbolId, int type,
+                                           double volume, double openPrice);
+
+/**
+ * Remove one position.
+ *
+ * @return 0 on success, -1 if not open, -4 if the ticket was not present
+ */
+HEDGEEDGE_API int __stdcall ExposureRemove(int handle, int book, long long ticket);
+
+/**
+ * Remove every position of one book (before reloading it).
+ */
+HEDGEEDGE_API void __stdcall ExposureClearBook(int handle, int book);
+
+/**
+ * Recompute exposure and P&L at the current prices.
+ *
+ * @param outPnl  Receives the combined floating P&L of both books (may be NULL)
+ *
+ * @return 0 on success, -1 if not open
+ */
+HEDGEEDGE_API int __stdcall ExposureCompute(int handle, double* outPnl);
+
+/**
+ * One symbol's exposure for one book at the last compute.
+ *
+ * @return 0 on success, -1 if not open, -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall ExposureGetSymbol(int handle, int symbolId, int book, double* netLots,
+                                              double* notional, double* pnl);
+
+/**
+ * One position's floating P&L at the last compute.
+ *
+ * @return 0 on success, -1 if not open, -4 if the ticket was not present
+ */
+HEDGEEDGE_API int __stdcall ExposurePositionPnl(int handle, int book, long long ticket, double* pnl);
+
+/**
+ * Per-symbol and per-book exposure at the last compute.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall ExposureJson(int handle, char* outJson, int jsonLen);
+
+/**
+ * Position counts, sorts and compute times as JSON.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall ExposureStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Close an exposure book handle.
+ */
+HEDGEEDGE_API void __stdcall ExposureClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_EXPOSURE_H
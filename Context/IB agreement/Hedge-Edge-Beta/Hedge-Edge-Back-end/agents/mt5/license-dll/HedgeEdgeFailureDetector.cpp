@@ -0,0 +1,232 @@
+// ============================================================================
+// Hedge Edge Phi-Accrual Failure Detector
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+#include "HedgeEdgeFailureDetector.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHandles.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const double MAX_PHI = 100.0;
+    const double MAX_LEARNED_FACTOR = 2.0;   // Cap on an interval learned after a Failed verdict
+
+    // -log10(P(interval > elapsed)) for a normal distribution, using the
+    // logistic approximation of the CDF (Hayashibara et al., as in Akka)
+    double NormalPhi(double elapsedMs, double meanMs, double stdDevMs)
+    {
+        double y = (elapsedMs - meanMs) / stdDevMs;
+        double e = std::exp(-y * (1.5976 + 0.070566 * y * y));
+        double phi = elapsedMs > meanMs ? -std::log10(e / (1.0 + e))
+                                        : -std::log10(1.0 - 1.0 / (1.0 + e));
+        if (!std::isfinite(phi) || phi > MAX_PHI) return MAX_PHI;
+        return phi < 0.0 ? 0.0 : phi;
+    }
+
+    std::string FormatDouble(double value)
+    {
+        return FixedString(value, 3);
+    }
+
+} // namespace
+
+// ============================================================================
+// PhiAccrualDetector
+// ============================================================================
+
+const char* DetectorStateName(DetectorState state)
+{
+    switch (state)
+    {
+        case DetectorState::Suspect: return "suspect";
+        case DetectorState::Failed:  return "failed";
+        default:                     return "alive";
+    }
+}
+
+PhiAccrualDetector::PhiAccrualDetector(const DetectorConfig& config)
+    : m_config(config)
+{
+    m_config.windowSize = std::max<size_t>(m_config.windowSize, 2);
+    m_intervals.reserve(m_config.windowSize);
+}
+
+void PhiAccrualDetector::AddInterval(double intervalMs)
+{
+    if (m_intervals.size() < m_config.windowSize)
+    {
+        m_intervals.push_back(intervalMs);
+    }
+    else
+    {
+        double old = m_intervals[m_next];
+        m_sum -= old;
+        m_sumSquares -= old * old;
+        m_intervals[m_next] = intervalMs;
+        m_next = (m_next + 1) % m_config.windowSize;
+    }
+    m_sum += intervalMs;
+    m_sumSquares += intervalMs * intervalMs;
+}
+
+void PhiAccrualDetector::Heartbeat(uint64_t nowUs)
+{
+    if (m_lastUs != 0 && nowUs > m_lastUs)
+    {
+        // A late arrival is still learned, capped so that a real outage does
+        // not swamp the window; otherwise a sender that slows down (master
+        // ticks pausing between heartbeats) would be declared dead forever
+        double intervalMs = static_cast<double>(nowUs - m_lastUs) / 1000.0;
+        if (State(nowUs) == DetectorState::Failed)
+        {
+            m_outages++;
+            intervalMs = std::min(intervalMs, MAX_LEARNED_FACTOR * std::max(MeanMs(), m_config.firstIntervalMs));
+        }
+        AddInterval(intervalMs);
+    }
+    m_lastUs = nowUs;
+    m_heartbeats++;
+}
+
+double PhiAccrualDetector::MeanMs() const
+{
+    if (m_intervals.empty()) return m_config.firstIntervalMs;
+    return m_sum / static_cast<double>(m_intervals.size());
+}
+
+double PhiAccrualDetector::StdDevMs() const
+{
+    double stdDev = m_config.firstIntervalMs / 4.0;
+    if (m_intervals.size() >= 2)
+    {
+        double mean = MeanMs();
+        double variance = m_sumSquares / static_cast<double>(m_intervals.size()) - mean * mean;
+        stdDev = variance > 0.0 ? std::sqrt(variance) : 0.0;
+    }
+    return std::max(stdDev, m_config.minStdDevMs);
+}
+
+double PhiAccrualDetector::Phi(uint64_t nowUs) const
+{
+    if (m_lastUs == 0 || nowUs <= m_lastUs) return 0.0;
+
+    double elapsedMs = static_cast<double>(nowUs - m_lastUs) / 1000.0;
+    return NormalPhi(elapsedMs, MeanMs() + m_config.acceptablePauseMs, StdDevMs());
+}
+
+DetectorState PhiAccrualDetector::State(uint64_t nowUs) const
+{
+    double phi = Phi(nowUs);
+    if (phi >= m_config.failedPhi) return DetectorState::Failed;
+    if (phi >= m_config.suspectPhi) return DetectorState::Suspect;
+    return DetectorState::Alive;
+}
+
+std::string PhiAccrualDetector::StatsJson(uint64_t nowUs) const
+{
+    double sinceMs = m_lastUs ? static_cast<double>(nowUs - m_lastUs) / 1000.0 : 0.0;
+
+    std::string json = "{";
+    json += "\"phi\":" + FormatDouble(Phi(nowUs));
+    json += ",\"state\":\"" + std::string(DetectorStateName(State(nowUs))) + "\"";
+    json += ",\"meanMs\":" + FormatDouble(MeanMs());
+    json += ",\"stdDevMs\":" + FormatDouble(StdDevMs());
+    json += ",\"sinceLastMs\":" + FormatDouble(sinceMs);
+    json += ",\"samples\":" + std::to_string(m_intervals.size());
+    json += ",\"heartbeats\":" + std::to_string(m_heartbeats);
+    json += ",\"outages\":" + std::to_string(m_outages);
+    json += ",\"suspectPhi\":" + FormatDouble(m_config.suspectPhi);
+    json += ",\"failedPhi\":" + FormatDouble(m_config.failedPhi);
+    json += "}";
+    return json;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    hedgeedge::HandleTable<hedgeedge::PhiAccrualDetector> g_detectors;
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall FailureDetectorCreate(int windowSize, double minStdDevMs, double acceptablePauseMs,
+                                                  double firstIntervalMs, double suspectPhi, double failedPhi)
+{
+    if (windowSize < 2 || minStdDevMs <= 0.0 || acceptablePauseMs < 0.0 || firstIntervalMs <= 0.0 ||
+        suspectPhi <= 0.0 || failedPhi < suspectPhi)
+    {
+        return -5;
+    }
+
+    hedgeedge::DetectorConfig config;
+    config.windowSize = static_cast<size_t>(windowSize);
+    config.minStdDevMs = minStdDevMs;
+    config.acceptablePauseMs = acceptablePauseMs;
+    config.firstIntervalMs = firstIntervalMs;
+    config.suspectPhi = suspectPhi;
+    config.failedPhi = failedPhi;
+    return g_detectors.Add(std::make_shared<hedgeedge::PhiAccrualDetector>(config));
+}
+
+HEDGEEDGE_API int __stdcall FailureDetectorHeartbeat(int handle)
+{
+    auto detector = g_detectors.Get(handle);
+    if (!detector) return -1;
+
+    detector->Heartbeat(hedgeedge::NowMicros());
+    return 0;
+}
+
+HEDGEEDGE_API double __stdcall FailureDetectorPhi(int handle)
+{
+    auto detector = g_detectors.Get(handle);
+    if (!detector) return -1.0;
+    return detector->Phi(hedgeedge::NowMicros());
+}
+
+HEDGEEDGE_API int __stdcall FailureDetectorState(int handle)
+{
+    auto detector = g_detectors.Get(handle);
+    if (!detector) return -1;
+    return static_cast<int>(detector->State(hedgeedge::NowMicros()));
+}
+
+HEDGEEDGE_API int __stdcall FailureDetectorStats(int handle, char* outJson, int jsonLen)
+{
+    auto detector = g_detectors.Get(handle);
+    if (!detector) return -1;
+    if (!outJson || jsonLen <= 0) return -5;
+
+    std::string json = detector->StatsJson(hedgeedge::NowMicros());
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API void __stdcall FailureDetectorClose(int handle)
+{
+    g_detectors.Remove(handle);
+}
+
+} // extern "C"
@@ -0,0 +1,139 @@
+// ============================================================================
+// Hedge Edge Phi-Accrual Failure Detector
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Replaces the fixed "no heartbeat for N seconds" rule on the hedge. The
+// detector learns the inter-arrival distribution of master HEARTBEAT messages
+// and reports a suspicion level phi: the -log10 probability that a message
+// this late would still arrive. phi 1 = 10%, phi 3 = 0.1%, phi 8 = 1e-8.
+// On a steady link the master is declared dead a few intervals after it
+// stops; on a jittery link the learned deviation keeps phi low and avoids
+// false alarms. Intervals that arrive after a Failed verdict are still
+// learned (capped), so a slower rhythm is adopted instead of failing forever.
+//
+// Single-threaded: every call comes from the owning EA thread.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_FAILURE_DETECTOR_H
+#define HEDGE_EDGE_FAILURE_DETECTOR_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hedgeedge {
+
+enum class DetectorState : int
+{
+    Alive   = 0,
+    Suspect = 1,
+    Failed  = 2
+};
+
+struct DetectorConfig
+{
+    size_t windowSize = 100;             // Intervals kept for mean / deviation
+    double minStdDevMs = 100.0;          // Floor for a very regular sender
+    double acceptablePauseMs = 1000.0;   // Added to the mean (GC, timer jitter)
+    double firstIntervalMs = 1000.0;     // Bootstrap estimate before any sample
+    double suspectPhi = 3.0;
+    double failedPhi = 8.0;
+};
+
+class PhiAccrualDetector
+{
+public:
+    explicit PhiAccrualDetector(const DetectorConfig& config);
+
+    // Record a liveness message received at `nowUs` (NowMicros clock)
+    void Heartbeat(uint64_t nowUs);
+
+    // Suspicion level at `nowUs`; 0 before the first heartbeat
+    double Phi(uint64_t nowUs) const;
+    DetectorState State(uint64_t nowUs) const;
+
+    double MeanMs() const;
+    double StdDevMs() const;
+    size_t Samples() const { return m_intervals.size(); }
+
+    std::string StatsJson(uint64_t nowUs) const;
+
+private:
+    void AddInterval(double intervalMs);
+
+    DetectorConfig      m_config;
+    std::vector<double> m_intervals;     // Ring of the last windowSize intervals
+    size_t              m_next = 0;
+    double              m_sum = 0.0;
+    double              m_sumSquares = 0.0;
+    uint64_t            m_lastUs = 0;
+    uint64_t            m_heartbeats = 0;
+    uint64_t            m_outages = 0;   // Heartbeats after a Failed state
+};
+
+const char* DetectorStateName(DetectorState state);
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Failure Detector
+// ============================================================================
+
+/**
+ * Create a phi-accrual failure detector.
+ *
+ * @param windowSize         Intervals kept (e.g. 100)
+ * @param minStdDevMs        Minimum standard deviation in ms (e.g. 100)
+ * @param acceptablePauseMs  Extra pause tolerated on top of the mean, in ms
+ * @param firstIntervalMs    Expected interval until samples exist, in ms
+ * @param suspectPhi         Threshold for the suspect state (e.g. 3)
+ * @param failedPhi          Threshold for the failed state (e.g. 8)
+ *
+ * @return Handle (>0) on success, -5 on a parameter error
+ */
+HEDGEEDGE_API int __stdcall FailureDetectorCreate(int windowSize, double minStdDevMs, double acceptablePauseMs,
+                                                  double firstIntervalMs, double suspectPhi, double failedPhi);
+
+/**
+ * Record a liveness message from the master (call once per receive pass).
+ *
+ * @return 0 on success, -1 if the handle is not open
+ */
+HEDGEEDGE_API int __stdcall FailureDetectorHeartbeat(int handle);
+
+/**
+ * Current suspicion level (0 before the first heartbeat, -1 if not open).
+ */
+HEDGEEDGE_API double __stdcall FailureDetectorPhi(int handle);
+
+/**
+ * Current state: 0 = alive, 1 = suspect, 2 = failed, -1 if not open.
+ */
+HEDGEEDGE_API int __stdcall FailureDetectorState(int handle);
+
+/**
+ * Detector statistics as JSON (phi, state, meanMs, stdDevMs, samples, ...).
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall FailureDetectorStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Close a failure detector handle.
+ */
+HEDGEEDGE_API void __stdcall FailureDetectorClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_FAILURE_DETECTOR_H
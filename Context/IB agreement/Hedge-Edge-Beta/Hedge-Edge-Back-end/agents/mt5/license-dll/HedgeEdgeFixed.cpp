@@ -0,0 +1,124 @@
+// ============================================================================
+// Hedge Edge Scaled-Integer Prices and Volumes
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <cmath>
+
+#include "HedgeEdgeFixed.h"
+#include "HedgeEdgeFormat.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const int64_t POW10[MAX_PRICE_DIGITS + 1] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 10000000000,
+    };
+
+    int ClampDigits(int digits)
+    {
+        return digits < 0 ? 0 : (digits > MAX_PRICE_DIGITS ? MAX_PRICE_DIGITS : digits);
+    }
+
+} // namespace
+
+// ============================================================================
+// Conversions
+// ============================================================================
+
+int64_t ScalePrice(double price, int digits)
+{
+    return std::llround(price * static_cast<double>(POW10[ClampDigits(digits)]));
+}
+
+double UnscalePrice(int64_t scaled, int digits)
+{
+    return static_cast<double>(scaled) / static_cast<double>(POW10[ClampDigits(digits)]);
+}
+
+int64_t LotsToUnits(double lots)
+{
+    return std::llround(lots * static_cast<double>(LOT_UNITS_PER_LOT));
+}
+
+double UnitsToLots(int64_t units)
+{
+    return static_cast<double>(units) / static_cast<double>(LOT_UNITS_PER_LOT);
+}
+
+int64_t VolumeSteps(int64_t units, int64_t stepUnits)
+{
+    if (stepUnits <= 0) return 0;
+    return (units + stepUnits / 2) / stepUnits;
+}
+
+int64_t HedgeVolumeUnits(int64_t masterUnits, double multiplier, int64_t stepUnits,
+                         int64_t minUnits, int64_t maxUnits)
+{
+    // Rounding to 1e-8 lots first keeps 0.1 * 3 from landing a step short
+    int64_t target = std::llround(static_cast<double>(masterUnits) * multiplier);
+    if (stepUnits > 0) target = target / stepUnits * stepUnits;
+    if (target < minUnits) target = minUnits;
+    if (maxUnits > 0 && target > maxUnits) target = maxUnits;
+    return target;
+}
+
+void AppendScaledPrice(std::string& out, int64_t scaled, int digits)
+{
+    digits = ClampDigits(digits);
+    uint64_t magnitude = scaled < 0 ? ~static_cast<uint64_t>(scaled) + 1 : static_cast<uint64_t>(scaled);
+    uint64_t divisor = static_cast<uint64_t>(POW10[digits]);
+
+    if (scaled < 0) out += '-';
+    AppendUInt(out, magnitude / divisor);
+    if (digits == 0) return;
+
+    char fraction[FORMAT_INT_CHARS];
+    uint64_t rest = magnitude % divisor;
+    for (int i = digits - 1; i >= 0; i--)
+    {
+        fraction[i] = static_cast<char>('0' + rest % 10);
+        rest /= 10;
+    }
+    out += '.';
+    out.append(fraction, static_cast<size_t>(digits));
+}
+
+// ============================================================================
+// Message Encoding
+// ============================================================================
+
+void AppendPositionFields(std::string& out, const PositionMessage& message)
+{
+    out += "\"price\":";
+    AppendScaledPrice(out, message.price, message.digits);
+    out += ",\"stopLoss\":";
+    if (message.stopLoss > 0) AppendScaledPrice(out, message.stopLoss, message.digits);
+    else out += "null";
+    out += ",\"takeProfit\":";
+    if (message.takeProfit > 0) AppendScaledPrice(out, message.takeProfit, message.digits);
+    else out += "null";
+    out += ",\"volumeLots\":";
+    AppendScaledPrice(out, message.volumeSteps * message.lotStepUnits, 8);
+    out += ",\"digits\":";
+    AppendInt(out, message.digits);
+
+    out += ",\"priceScaled\":";
+    AppendInt(out, message.price);
+    out += ",\"stopLossScaled\":";
+    AppendInt(out, message.stopLoss);
+    out += ",\"takeProfitScaled\":";
+    AppendInt(out, message.takeProfit);
+    out += ",\"volumeSteps\":";
+    AppendInt(out, message.volumeSteps);
+    out += ",\"lotStepE8\":";
+    AppendInt(out, message.lotStepUnits);
+}
+
+} // namespace hedgeedge
@@ -0,0 +1,71 @@
+// ============================================================================
+// Hedge Edge Scaled-Integer Prices and Volumes
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Wire model for prices and volumes as exact integers:
+//   price   -> int64 scaled by 10^digits     (1.23456 @ 5 digits = 123456)
+//   volume  -> int64 lot-step units, with the step itself in 1e-8 lots
+//              (0.30 lots @ step 0.01 = 30 steps of 1000000)
+// Both sides convert with the same integer rules, so lot sizes no longer
+// drift through floor(0.3 / 0.01) = 29. HedgeEdgeFixed.mqh implements the
+// identical helpers in MQL5 for EAs running without the DLL.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_FIXED_H
+#define HEDGE_EDGE_FIXED_H
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <string>
+
+namespace hedgeedge {
+
+constexpr int64_t LOT_UNITS_PER_LOT = 100000000;   // Volumes are counted in 1e-8 lots
+constexpr int     MAX_PRICE_DIGITS  = 10;
+
+// Price <-> scaled integer (nearest, half away from zero)
+int64_t ScalePrice(double price, int digits);
+double  UnscalePrice(int64_t scaled, int digits);
+
+// Lots <-> 1e-8 lot units (nearest)
+int64_t LotsToUnits(double lots);
+double  UnitsToLots(int64_t units);
+
+// Whole lot steps in `units` (nearest step: the master's volume is on its grid)
+int64_t VolumeSteps(int64_t units, int64_t stepUnits);
+
+// Hedge volume in lot units: master units times the multiplier, floored to
+// the hedge symbol's step and clamped to [minUnits, maxUnits]
+int64_t HedgeVolumeUnits(int64_t masterUnits, double multiplier, int64_t stepUnits,
+                         int64_t minUnits, int64_t maxUnits);
+
+// Exact decimal text of a scaled value ("123456" @ 5 -> "1.23456")
+void AppendScaledPrice(std::string& out, int64_t scaled, int digits);
+
+// One position / deal in wire units
+struct PositionMessage
+{
+    uint64_t    ticket = 0;
+    std::string symbol;
+    int32_t     type = 0;           // 0 = BUY, 1 = SELL
+    int32_t     digits = 0;
+    int64_t     price = 0;          // Scaled by 10^digits
+    int64_t     stopLoss = 0;       // 0 = none
+    int64_t     takeProfit = 0;     // 0 = none
+    int64_t     volumeSteps = 0;
+    int64_t     lotStepUnits = 0;   // 1e-8 lots
+};
+
+// Appends the fields of a position object (without braces): the decimal
+// fields existing consumers parse, followed by the integer fields
+//   "price","stopLoss","takeProfit","volumeLots","digits",
+//   "priceScaled","stopLossScaled","takeProfitScaled","volumeSteps","lotStepE8"
+void AppendPositionFields(std::string& out, const PositionMessage& message);
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_FIXED_H
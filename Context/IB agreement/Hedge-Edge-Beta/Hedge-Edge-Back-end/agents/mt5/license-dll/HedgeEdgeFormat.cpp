@@ -0,0 +1,300 @@
+// ============================================================================
+// Hedge Edge Number and Time Formatting
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Fixed-point fast path: with s = 10^digits (exact as a double), the exact
+// product value * s is p + e, where p is the rounded product and e its error
+// term (Dekker's two-product, exact without FMA). p < 2^52 makes p - floor(p)
+// and the comparison against one half exact, so rounding matches printf for
+// every input, ties included. Requires strict IEEE double arithmetic: do not
+// build this file with -ffast-math or FMA contraction.
+// ============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "HedgeEdgeFormat.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const double TWO_POW_52 = 4503599627370496.0;
+
+    const double POW10[FORMAT_MAX_DIGITS + 1] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+        1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+    };
+
+    const uint64_t UPOW10[FORMAT_MAX_DIGITS + 1] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+        100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+        10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+        100000000000000000ull,
+    };
+
+    const char DIGIT_PAIRS[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    // Veltkamp split: a = hi + lo with 26-bit halves
+    inline void Split(double a, double& hi, double& lo)
+    {
+        double c = 134217729.0 * a;   // 2^27 + 1
+        hi = c - (c - a);
+        lo = a - hi;
+    }
+
+    // Exact error of p = fl(a * b): a * b == p + result
+    inline double ProductError(double a, double b, double p)
+    {
+        double aHi, aLo, bHi, bLo;
+        Split(a, aHi, aLo);
+        Split(b, bHi, bLo);
+        return ((aHi * bHi - p) + aHi * bLo + aLo * bHi) + aLo * bLo;
+    }
+
+    inline void Put2(char* out, unsigned value)
+    {
+        std::memcpy(out, DIGIT_PAIRS + value * 2, 2);
+    }
+
+    // Exactly `width` digits, zero-padded
+    inline void PutPadded(char* out, uint64_t value, int width)
+    {
+        char* p = out + width;
+        while (p - out >= 2)
+        {
+            p -= 2;
+            Put2(p, static_cast<unsigned>(value % 100));
+            value /= 100;
+        }
+        if (p != out) *--p = static_cast<char>('0' + value % 10);
+    }
+
+    int DigitCount(uint64_t value)
+    {
+        int count = 1;
+        uint64_t threshold = 10;
+        while (value >= threshold)
+        {
+            if (++count == 20) break;   // 10^20 does not fit
+            threshold *= 10;
+        }
+        return count;
+    }
+
+    size_t Fallback(char* out, size_t capacity, double value, int digits)
+    {
+        int length = std::snprintf(out, capacity, "%.*f", digits, value);
+        return length > 0 && static_cast<size_t>(length) < capacity ? static_cast<size_t>(length) : 0;
+    }
+
+    struct CivilTime
+    {
+        int64_t year;
+        unsigned month, day, hour, minute, second;
+    };
+
+    // Civil date from seconds since 1970-01-01 (H. Hinnant)
+    CivilTime ToCivil(int64_t seconds)
+    {
+        int64_t days = seconds / 86400;
+        int64_t rem = seconds % 86400;
+        if (rem < 0) { rem += 86400; days--; }
+
+        days += 719468;
+        int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+        int64_t doe = days - era * 146097;
+        int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        int64_t mp = (5 * doy + 2) / 153;
+
+        CivilTime civil;
+        civil.day = static_cast<unsigned>(doy - (153 * mp + 2) / 5 + 1);
+        civil.month = static_cast<unsigned>(mp < 10 ? mp + 3 : mp - 9);
+        civil.year = yoe + era * 400 + (civil.month <= 2 ? 1 : 0);
+        civil.hour = static_cast<unsigned>(rem / 3600);
+        civil.minute = static_cast<unsigned>(rem / 60 % 60);
+        civil.second = static_cast<unsigned>(rem % 60);
+        return civil;
+    }
+
+    // "YYYY?MM?DD?HH:MM:SS" (19 chars); years outside 0..9999 are clamped
+    void PutDateTime(char* out, const CivilTime& civil, char dateSep, char timeSep)
+    {
+        int64_t year = civil.year < 0 ? 0 : (civil.year > 9999 ? 9999 : civil.year);
+        Put2(out, static_cast<unsigned>(year / 100));
+        Put2(out + 2, static_cast<unsigned>(year % 100));
+        out[4] = dateSep;
+        Put2(out + 5, civil.month);
+        out[7] = dateSep;
+        Put2(out + 8, civil.day);
+        out[10] = timeSep;
+        Put2(out + 11, civil.hour);
+        out[13] = ':';
+        Put2(out + 14, civil.minute);
+        out[16] = ':';
+        Put2(out + 17, civil.second);
+    }
+
+} // namespace
+
+// ============================================================================
+// Numbers
+// ============================================================================
+
+size_t FormatUInt(char* out, uint64_t value)
+{
+    int length = DigitCount(value);
+    PutPadded(out, value, length);
+    return static_cast<size_t>(length);
+}
+
+size_t FormatInt(char* out, int64_t value)
+{
+    if (value >= 0) return FormatUInt(out, static_cast<uint64_t>(value));
+    out[0] = '-';
+    return 1 + FormatUInt(out + 1, ~static_cast<uint64_t>(value) + 1);
+}
+
+size_t FormatFixed(char* out, size_t capacity, double value, int digits)
+{
+    if (digits < 0) digits = 0;
+    if (digits > FORMAT_MAX_DIGITS) digits = FORMAT_MAX_DIGITS;
+
+    double magnitude = std::fabs(value);
+    double scale = POW10[digits];
+    double product = magnitude * scale;
+    if (!(product < TWO_POW_52)) return Fallback(out, capacity, value, digits);
+
+    uint64_t units = 0;
+    if (product >= 0.25)
+    {
+        double error = ProductError(magnitude, scale, product);
+        double whole = std::floor(product);
+        // Sign of (exact fraction - 1/2); both terms are exact, so is the sign
+        double half = (product - whole - 0.5) + error;
+        units = static_cast<uint64_t>(whole);
+        if (half > 0.0 || (half == 0.0 && (units & 1))) units++;
+    }
+
+    uint64_t integer = units / UPOW10[digits];
+    uint64_t fraction = units % UPOW10[digits];
+    int integerDigits = DigitCount(integer);
+    bool negative = std::signbit(value);
+
+    size_t length = (negative ? 1 : 0) + static_cast<size_t>(integerDigits) + (digits ? 1 + digits : 0);
+    if (length > capacity) return 0;
+
+    char* p = out;
+    if (negative) *p++ = '-';
+    PutPadded(p, integer, integerDigits);
+    p += integerDigits;
+    if (digits)
+    {
+        *p++ = '.';
+        PutPadded(p, fraction, digits);
+    }
+    return length;
+}
+
+// ============================================================================
+// Time
+// ============================================================================
+
+size_t FormatServerTime(char* out, int64_t seconds)
+{
+    PutDateTime(out, ToCivil(seconds), '.', ' ');
+    return 19;
+}
+
+size_t FormatIsoTime(char* out, int64_t micros, int fractionDigits)
+{
+    int64_t seconds = micros / 1000000;
+    int64_t fraction = micros % 1000000;
+    if (fraction < 0) { fraction += 1000000; seconds--; }
+
+    PutDateTime(out, ToCivil(seconds), '-', 'T');
+    size_t length = 19;
+    if (fractionDigits >= 6)
+    {
+        out[length++] = '.';
+        PutPadded(out + length, static_cast<uint64_t>(fraction), 6);
+        length += 6;
+    }
+    else if (fractionDigits >= 3)
+    {
+        out[length++] = '.';
+        PutPadded(out + length, static_cast<uint64_t>(fraction / 1000), 3);
+        length += 3;
+    }
+    out[length++] = 'Z';
+    return length;
+}
+
+// ============================================================================
+// std::string Helpers
+// ============================================================================
+
+void AppendFixed(std::string& out, double value, int digits)
+{
+    char text[64];
+    size_t length = FormatFixed(text, sizeof(text), value, digits);
+    if (length)
+    {
+        out.append(text, length);
+        return;
+    }
+
+    // Huge magnitudes: printf needs up to ~330 characters
+    char wide[400];
+    length = FormatFixed(wide, sizeof(wide), value, digits);
+    out.append(wide, length);
+}
+
+void AppendInt(std::string& out, int64_t value)
+{
+    char text[FORMAT_INT_CHARS];
+    out.append(text, FormatInt(text, value));
+}
+
+void AppendUInt(std::string& out, uint64_t value)
+{
+    char text[FORMAT_INT_CHARS];
+    out.append(text, FormatUInt(text, value));
+}
+
+void AppendServerTime(std::string& out, int64_t seconds)
+{
+    char text[FORMAT_TIME_CHARS];
+    out.append(text, FormatServerTime(text, seconds));
+}
+
+void AppendIsoTime(std::string& out, int64_t micros, int fractionDigits)
+{
+    char text[FORMAT_TIME_CHARS];
+    out.append(text, FormatIsoTime(text, micros, fractionDigits));
+}
+
+std::string FixedString(double value, int digits)
+{
+    std::string text;
+    AppendFixed(text, value, digits);
+    return text;
+}
+
+std::string ServerTimeString(int64_t seconds)
+{
+    char text[FORMAT_TIME_CHARS];
+    return std::string(text, FormatServerTime(text, seconds));
+}
+
+} // namespace hedgeedge
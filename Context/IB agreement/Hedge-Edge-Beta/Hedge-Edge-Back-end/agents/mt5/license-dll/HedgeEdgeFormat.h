@@ -0,0 +1,60 @@
+// ============================================================================
+// Hedge Edge Number and Time Formatting
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Allocation-free formatting for the native JSON serializers: doubles with a
+// fixed number of decimals (prices with the symbol's digits, money with 2),
+// integers, and broker / ISO timestamps. Fixed-point output is identical to
+// printf("%.*f") - the exact binary value rounded half to even - but avoids
+// the locale and format-string overhead of the C runtime.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_FORMAT_H
+#define HEDGE_EDGE_FORMAT_H
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hedgeedge {
+
+constexpr int FORMAT_MAX_DIGITS = 17;   // Decimals accepted by FormatFixed
+
+// Buffer sizes that always suffice
+constexpr size_t FORMAT_INT_CHARS  = 24;
+constexpr size_t FORMAT_TIME_CHARS = 32;
+
+// Write `value` with exactly `digits` decimals (clamped to 0..17) into
+// `out`, which must hold `capacity` bytes. Values beyond the fast path
+// (|value| * 10^digits >= 2^52, NaN, infinity) use snprintf. Returns the
+// length written (not null-terminated), 0 if the buffer is too small.
+size_t FormatFixed(char* out, size_t capacity, double value, int digits);
+
+// Decimal integer; `out` must hold FORMAT_INT_CHARS bytes. Returns the length.
+size_t FormatInt(char* out, int64_t value);
+size_t FormatUInt(char* out, uint64_t value);
+
+// Broker time as TimeToString(t, TIME_DATE|TIME_SECONDS): "2026.01.31 23:59:59"
+size_t FormatServerTime(char* out, int64_t seconds);
+
+// UTC ISO 8601 with 0, 3 or 6 fractional digits: "2026-01-31T23:59:59.123Z"
+size_t FormatIsoTime(char* out, int64_t micros, int fractionDigits);
+
+// Append helpers for the std::string JSON builders
+void AppendFixed(std::string& out, double value, int digits);
+void AppendInt(std::string& out, int64_t value);
+void AppendUInt(std::string& out, uint64_t value);
+void AppendServerTime(std::string& out, int64_t seconds);
+void AppendIsoTime(std::string& out, int64_t micros, int fractionDigits);
+
+std::string FixedString(double value, int digits);
+std::string ServerTimeString(int64_t seconds);
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_FORMAT_H
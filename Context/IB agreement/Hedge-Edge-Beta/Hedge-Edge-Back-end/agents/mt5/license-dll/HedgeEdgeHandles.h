@@ -0,0 +1,63 @@
+// ============================================================================
+// Hedge Edge Native Handle Table
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// MQL5 can only hold integers across DLL calls, so every native object is
+// exposed as an int handle (index + 1, 0 = invalid). Objects are shared_ptr
+// so a handle closed on one thread stays valid for a call in flight.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_HANDLES_H
+#define HEDGE_EDGE_HANDLES_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hedgeedge {
+
+template <typename T>
+class HandleTable
+{
+public:
+    // Store an object and return its handle (>0)
+    int Add(std::shared_ptr<T> object)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < m_objects.size(); i++)
+        {
+            if (!m_objects[i])
+            {
+                m_objects[i] = std::move(object);
+                return static_cast<int>(i) + 1;
+            }
+        }
+        m_objects.push_back(std::move(object));
+        return static_cast<int>(m_objects.size());
+    }
+
+    // Look up a handle; nullptr if invalid or closed
+    std::shared_ptr<T> Get(int handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (handle <= 0 || handle > static_cast<int>(m_objects.size())) return nullptr;
+        return m_objects[handle - 1];
+    }
+
+    // Release a handle; the object is destroyed with the last reference
+    std::shared_ptr<T> Remove(int handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (handle <= 0 || handle > static_cast<int>(m_objects.size())) return nullptr;
+        return std::move(m_objects[handle - 1]);
+    }
+
+private:
+    std::mutex                      m_mutex;
+    std::vector<std::shared_ptr<T>> m_objects;
+};
+
+} // namespace hedgeedge
+
+#endif // HEDGE_EDGE_HANDLES_H
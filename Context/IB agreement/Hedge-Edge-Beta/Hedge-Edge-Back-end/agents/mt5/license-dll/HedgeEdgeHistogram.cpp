@@ -0,0 +1,217 @@
+// ============================================================================
+// Hedge Edge Latency Histogram
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHistogram.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    int HighestBit(uint64_t value)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    template <size_t N, typename Slot>
+    void RecordSlot(std::array<Slot, N>& slots, uint64_t slotUs, uint64_t value, uint64_t nowUs)
+    {
+        uint64_t epoch = nowUs / slotUs;
+        Slot& slot = slots[epoch % N];
+        if (slot.epoch != epoch)
+        {
+            slot.histogram.Reset();
+            slot.epoch = epoch;
+        }
+        slot.histogram.Record(value);
+    }
+
+    template <size_t N, typename Slot>
+    void MergeSlots(const std::array<Slot, N>& slots, uint64_t slotUs, uint64_t spanUs, uint64_t nowUs,
+                    Histogram& out)
+    {
+        uint64_t current = nowUs / slotUs;
+        uint64_t count = std::min<uint64_t>((spanUs + slotUs - 1) / slotUs, N);
+        for (const Slot& slot : slots)
+        {
+            if (slot.epoch <= current && current - slot.epoch < count) out.Merge(slot.histogram);
+        }
+    }
+
+    void AppendWindow(std::string& json, const char* name, const Histogram& window)
+    {
+        json += "\"";
+        json += name;
+        json += "\":{\"count\":";
+        AppendUInt(json, window.Count());
+        json += ",\"p50\":";
+        AppendUInt(json, window.Percentile(50.0));
+        json += ",\"p99\":";
+        AppendUInt(json, window.Percentile(99.0));
+        json += ",\"p999\":";
+        AppendUInt(json, window.Percentile(99.9));
+        json += ",\"max\":";
+        AppendUInt(json, window.Max());
+        json += ",\"mean\":";
+        AppendFixed(json, window.Mean(), 1);
+        json += "}";
+    }
+
+} // namespace
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+size_t Histogram::BucketIndex(uint64_t value)
+{
+    if (value < LINEAR_LIMIT) return static_cast<size_t>(value);
+
+    // value >> shift lands in [16, 31]
+    int shift = HighestBit(value) - 4;
+    uint64_t top = value >> shift;
+    return LINEAR_LIMIT + static_cast<size_t>(shift - 1) * SUB_BUCKETS + static_cast<size_t>(top - SUB_BUCKETS);
+}
+
+uint64_t Histogram::BucketValue(size_t index)
+{
+    if (index < LINEAR_LIMIT) return index;
+
+    size_t offset = index - LINEAR_LIMIT;
+    int shift = static_cast<int>(offset / SUB_BUCKETS) + 1;
+    uint64_t low = (static_cast<uint64_t>(offset % SUB_BUCKETS) + SUB_BUCKETS) << shift;
+    return low + ((uint64_t(1) << shift) - 1) / 2;
+}
+
+void Histogram::Record(uint64_t value, uint64_t count)
+{
+    if (count == 0) return;
+
+    m_buckets[BucketIndex(value)] += count;
+    m_count += count;
+    m_sum += static_cast<double>(value) * static_cast<double>(count);
+    if (value < m_min) m_min = value;
+    if (value > m_max) m_max = value;
+}
+
+void Histogram::Merge(const Histogram& other)
+{
+    if (other.m_count == 0) return;
+
+    for (size_t i = 0; i < BUCKETS; i++) m_buckets[i] += other.m_buckets[i];
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+void Histogram::Reset()
+{
+    m_buckets.fill(0);
+    m_count = 0;
+    m_min = UINT64_MAX;
+    m_max = 0;
+    m_sum = 0.0;
+}
+
+double Histogram::Mean() const
+{
+    return m_count ? m_sum / static_cast<double>(m_count) : 0.0;
+}
+
+uint64_t Histogram::Percentile(double p) const
+{
+    if (m_count == 0) return 0;
+
+    double clamped = std::min(std::max(p, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_count)));
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; i++)
+    {
+        seen += m_buckets[i];
+        if (seen >= rank) return std::min(std::max(BucketValue(i), Min()), m_max);
+    }
+    return m_max;
+}
+
+std::string Histogram::Json() const
+{
+    std::string json = "{";
+    json += "\"count\":" + std::to_string(m_count);
+    json += ",\"min\":" + std::to_string(Min());
+    json += ",\"p50\":" + std::to_string(Percentile(50.0));
+    json += ",\"p90\":" + std::to_string(Percentile(90.0));
+    json += ",\"p99\":" + std::to_string(Percentile(99.0));
+    json += ",\"p999\":" + std::to_string(Percentile(99.9));
+    json += ",\"max\":" + std::to_string(m_max);
+    json += ",\"mean\":" + FixedString(Mean(), 1);
+    json += "}";
+    return json;
+}
+
+// ============================================================================
+// WindowedHistogram
+// ============================================================================
+
+void WindowedHistogram::Record(uint64_t value, uint64_t nowUs)
+{
+    RecordSlot(m_fine, FINE_SLOT_US, value, nowUs);
+    RecordSlot(m_coarse, COARSE_SLOT_US, value, nowUs);
+}
+
+void WindowedHistogram::Window(uint64_t spanUs, uint64_t nowUs, Histogram& out) const
+{
+    if (spanUs <= FINE_SLOT_US * FINE_SLOTS) MergeSlots(m_fine, FINE_SLOT_US, spanUs, nowUs, out);
+    else MergeSlots(m_coarse, COARSE_SLOT_US, spanUs, nowUs, out);
+}
+
+void WindowedHistogram::Reset()
+{
+    for (Slot& slot : m_fine) slot = Slot();
+    for (Slot& slot : m_coarse) slot = Slot();
+}
+
+std::string WindowedHistogram::WindowsJson(uint64_t nowUs) const
+{
+    static const struct { const char* name; uint64_t spanUs; } WINDOWS[] = {
+        { "1m",  60ULL * 1000000 },
+        { "15m", 900ULL * 1000000 },
+        { "1h",  3600ULL * 1000000 },
+    };
+
+    std::string json = "{";
+    Histogram window;
+    for (const auto& span : WINDOWS)
+    {
+        window.Reset();
+        Window(span.spanUs, nowUs, window);
+        if (json.size() > 1) json += ",";
+        AppendWindow(json, span.name, window);
+    }
+    json += "}";
+    return json;
+}
+
+} // namespace hedgeedge
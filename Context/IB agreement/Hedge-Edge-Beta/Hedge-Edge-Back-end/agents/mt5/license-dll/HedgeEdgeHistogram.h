@@ -0,0 +1,100 @@
+// ============================================================================
+// Hedge Edge Latency Histogram
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Fixed-size log-linear histogram for latencies in microseconds (HdrHistogram
+// style): exact below 32, then 16 sub-buckets per power of two, so every
+// recorded value is reported within ~6%. Recording is a few instructions and
+// never allocates; histograms can be merged and reset.
+//
+// WindowedHistogram keeps the recent past as a ring of histograms, so the
+// last minute, quarter hour and hour can be reported without a lifetime
+// aggregate hiding today's tail.
+//
+// Not synchronized: callers own the locking.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_HISTOGRAM_H
+#define HEDGE_EDGE_HISTOGRAM_H
+
+#ifdef __cplusplus
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace hedgeedge {
+
+class Histogram
+{
+public:
+    static constexpr int    LINEAR_LIMIT = 32;   // Values below are exact
+    static constexpr int    SUB_BUCKETS = 16;    // Per power of two above
+    static constexpr size_t BUCKETS = LINEAR_LIMIT + 59 * SUB_BUCKETS;
+
+    void Record(uint64_t value, uint64_t count = 1);
+    void Merge(const Histogram& other);
+    void Reset();
+
+    uint64_t Count() const { return m_count; }
+    uint64_t Min() const { return m_count ? m_min : 0; }
+    uint64_t Max() const { return m_max; }
+    double   Mean() const;
+
+    // Value at percentile `p` (0..100), e.g. 99.9
+    uint64_t Percentile(double p) const;
+
+    // {"count":..,"min":..,"p50":..,"p90":..,"p99":..,"p999":..,"max":..,"mean":..}
+    std::string Json() const;
+
+    static size_t   BucketIndex(uint64_t value);
+    static uint64_t BucketValue(size_t index);   // Representative value of a bucket
+
+private:
+    std::array<uint64_t, BUCKETS> m_buckets{};
+    uint64_t m_count = 0;
+    uint64_t m_min = UINT64_MAX;
+    uint64_t m_max = 0;
+    double   m_sum = 0.0;
+};
+
+// Sliding windows to slot granularity: 10 s slots for spans up to a minute,
+// 5 min slots beyond, an hour at most. A window holds the slots that started
+// within the span, the current (partial) slot included. About 140 KB: keep
+// it on the heap.
+class WindowedHistogram
+{
+public:
+    static constexpr uint64_t FINE_SLOT_US = 10ULL * 1000000;
+    static constexpr size_t   FINE_SLOTS = 6;
+    static constexpr uint64_t COARSE_SLOT_US = 300ULL * 1000000;
+    static constexpr size_t   COARSE_SLOTS = 12;
+
+    // `nowUs` from NowMicros
+    void Record(uint64_t value, uint64_t nowUs);
+
+    // Merge the last `spanUs` into `out`
+    void Window(uint64_t spanUs, uint64_t nowUs, Histogram& out) const;
+
+    void Reset();
+
+    // {"1m":{..},"15m":{..},"1h":{..}}, each {"count","p50","p99","p999","max","mean"}
+    std::string WindowsJson(uint64_t nowUs) const;
+
+private:
+    struct Slot
+    {
+        uint64_t  epoch = UINT64_MAX;       // nowUs / slot length; MAX = empty
+        Histogram histogram;
+    };
+
+    std::array<Slot, FINE_SLOTS>   m_fine;
+    std::array<Slot, COARSE_SLOTS> m_coarse;
+};
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_HISTOGRAM_H
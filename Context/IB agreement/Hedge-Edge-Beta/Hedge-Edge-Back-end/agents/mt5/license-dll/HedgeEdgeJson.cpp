@@ -0,0 +1,271 @@
+// ============================================================================
+// Hedge Edge JSON Reader
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "HedgeEdgeJson.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const char WHITESPACE[] = " \t\r\n";
+
+    // Number text of a member, quotes removed ("123" and 123 both work)
+    bool NumberText(std::string_view object, std::string_view key, char* buffer, size_t capacity)
+    {
+        std::string_view value;
+        if (!JsonMember(object, key, value) || value.empty() || value == "null") return false;
+        if (value.size() >= 2 && value.front() == '"') value = value.substr(1, value.size() - 2);
+        if (value.empty() || value.size() >= capacity) return false;
+        std::memcpy(buffer, value.data(), value.size());
+        buffer[value.size()] = '\0';
+        return true;
+    }
+
+    void AppendUtf8(std::string& out, unsigned code)
+    {
+        if (code < 0x80)
+        {
+            out += static_cast<char>(code);
+        }
+        else if (code < 0x800)
+        {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000)
+        {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else
+        {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    bool ParseHex4(std::string_view text, size_t pos, unsigned& code)
+    {
+        if (pos + 4 > text.size()) return false;
+        code = 0;
+        for (size_t i = pos; i < pos + 4; i++)
+        {
+            char c = text[i];
+            code <<= 4;
+            if (c >= '0' && c <= '9') code |= static_cast<unsigned>(c - '0');
+            else if (c >= 'a' && c <= 'f') code |= static_cast<unsigned>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') code |= static_cast<unsigned>(c - 'A' + 10);
+            else return false;
+        }
+        return true;
+    }
+
+} // namespace
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+size_t JsonValueEnd(std::string_view text, size_t pos)
+{
+    pos = text.find_first_not_of(WHITESPACE, pos);
+    if (pos == std::string_view::npos) return pos;
+
+    char first = text[pos];
+    if (first == '"')
+    {
+        for (size_t i = pos + 1; i < text.size(); i++)
+        {
+            if (text[i] == '\\') i++;
+            else if (text[i] == '"') return i + 1;
+        }
+        return std::string_view::npos;
+    }
+
+    if (first == '{' || first == '[')
+    {
+        int depth = 0;
+        bool inString = false;
+        for (size_t i = pos; i < text.size(); i++)
+        {
+            char c = text[i];
+            if (inString)
+            {
+                if (c == '\\') i++;
+                else if (c == '"') inString = false;
+                continue;
+            }
+            if (c == '"') inString = true;
+            else if (c == '{' || c == '[') depth++;
+            else if (c == '}' || c == ']')
+            {
+                if (--depth == 0) return i + 1;
+            }
+        }
+        return std::string_view::npos;
+    }
+
+    size_t end = text.find_first_of(",}] \t\r\n", pos);
+    return end == std::string_view::npos ? text.size() : end;
+}
+
+bool JsonMember(std::string_view object, std::string_view key, std::string_view& value)
+{
+    size_t pos = object.find_first_not_of(WHITESPACE);
+    if (pos == std::string_view::npos || object[pos] != '{') return false;
+    pos++;
+
+    for (;;)
+    {
+        pos = object.find_first_not_of(" \t\r\n,", pos);
+        if (pos == std::string_view::npos || object[pos] != '"') return false;
+
+        size_t keyEnd = JsonValueEnd(object, pos);
+        if (keyEnd == std::string_view::npos) return false;
+        std::string_view name = object.substr(pos + 1, keyEnd - pos - 2);
+
+        pos = object.find_first_not_of(WHITESPACE, keyEnd);
+        if (pos == std::string_view::npos || object[pos] != ':') return false;
+        pos = object.find_first_not_of(WHITESPACE, pos + 1);
+        if (pos == std::string_view::npos) return false;
+
+        size_t valueEnd = JsonValueEnd(object, pos);
+        if (valueEnd == std::string_view::npos) return false;
+        if (name == key)
+        {
+            value = object.substr(pos, valueEnd - pos);
+            return true;
+        }
+        pos = valueEnd;
+    }
+}
+
+std::string_view JsonStringView(std::string_view object, std::string_view key)
+{
+    std::string_view value;
+    if (!JsonMember(object, key, value) || value.size() < 2 || value.front() != '"') return std::string_view();
+    return value.substr(1, value.size() - 2);
+}
+
+std::string JsonString(std::string_view object, std::string_view key)
+{
+    return JsonUnescape(JsonStringView(object, key));
+}
+
+double JsonDouble(std::string_view object, std::string_view key, double fallback)
+{
+    char text[64];
+    if (!NumberText(object, key, text, sizeof(text))) return fallback;
+    char* end = nullptr;
+    double value = std::strtod(text, &end);
+    return end != text ? value : fallback;
+}
+
+int64_t JsonInt(std::string_view object, std::string_view key, int64_t fallback)
+{
+    char text[32];
+    if (!NumberText(object, key, text, sizeof(text))) return fallback;
+    char* end = nullptr;
+    long long value = std::strtoll(text, &end, 10);
+    return end != text ? static_cast<int64_t>(value) : fallback;
+}
+
+bool JsonBool(std::string_view object, std::string_view key, bool fallback)
+{
+    std::string_view value;
+    if (!JsonMember(object, key, value)) return fallback;
+    if (value == "true") return true;
+    if (value == "false") return false;
+    return fallback;
+}
+
+bool JsonHas(std::string_view object, std::string_view key)
+{
+    std::string_view value;
+    return JsonMember(object, key, value) && value != "null";
+}
+
+std::string JsonUnescape(std::string_view body)
+{
+    std::string out;
+    out.reserve(body.size());
+    for (size_t i = 0; i < body.size(); i++)
+    {
+        char c = body[i];
+        if (c != '\\' || i + 1 >= body.size())
+        {
+            out += c;
+            continue;
+        }
+
+        char escape = body[++i];
+        switch (escape)
+        {
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u':
+            {
+                unsigned code = 0;
+                if (!ParseHex4(body, i + 1, code)) { out += escape; break; }
+                i += 4;
+                // Surrogate pair
+                unsigned low = 0;
+                if (code >= 0xD800 && code < 0xDC00 && i + 6 < body.size() &&
+                    body[i + 1] == '\\' && body[i + 2] == 'u' && ParseHex4(body, i + 3, low) &&
+                    low >= 0xDC00 && low < 0xE000)
+                {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+                AppendUtf8(out, code);
+                break;
+            }
+            default: out += escape; break;   // \" \\ \/
+        }
+    }
+    return out;
+}
+
+void AppendJsonString(std::string& out, std::string_view text)
+{
+    out += '"';
+    for (char c : text)
+    {
+        switch (c)
+        {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    out += escaped;
+                }
+                else out += c;
+        }
+    }
+    out += '"';
+}
+
+} // namespace hedgeedge
@@ -0,0 +1,73 @@
+// ============================================================================
+// Hedge Edge JSON Reader
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Reads the messages the EAs publish without building a document: members
+// are looked up among the top-level keys of one object, nested objects and
+// arrays are skipped by bracket matching, and arrays are walked element by
+// element. Lookups return views into the caller's text; only JsonString
+// and JsonUnescape copy.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_JSON_H
+#define HEDGE_EDGE_JSON_H
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace hedgeedge {
+
+// Index one past the JSON value starting at `pos` (after whitespace), or npos
+size_t JsonValueEnd(std::string_view text, size_t pos);
+
+// Raw text of a top-level member of `object` (strings keep their quotes).
+// Returns false if the key is missing.
+bool JsonMember(std::string_view object, std::string_view key, std::string_view& value);
+
+// Typed accessors; `fallback` for a missing member, null or a type mismatch
+std::string_view JsonStringView(std::string_view object, std::string_view key);   // Still escaped
+std::string      JsonString(std::string_view object, std::string_view key);       // Unescaped
+double           JsonDouble(std::string_view object, std::string_view key, double fallback = 0.0);
+int64_t          JsonInt(std::string_view object, std::string_view key, int64_t fallback = 0);
+bool             JsonBool(std::string_view object, std::string_view key, bool fallback = false);
+
+// True if the member exists and is not null
+bool JsonHas(std::string_view object, std::string_view key);
+
+// Decode the escapes of a JSON string body (without quotes)
+std::string JsonUnescape(std::string_view body);
+
+// Append `text` as a quoted JSON string
+void AppendJsonString(std::string& out, std::string_view text);
+
+// Call `visit(element)` for every element of an array value. Returns false
+// if `array` is not a well-formed array.
+template <typename Visit>
+bool JsonForEach(std::string_view array, Visit&& visit)
+{
+    size_t pos = array.find_first_not_of(" \t\r\n");
+    if (pos == std::string_view::npos || array[pos] != '[') return false;
+    pos++;
+    for (;;)
+    {
+        pos = array.find_first_not_of(" \t\r\n,", pos);
+        if (pos == std::string_view::npos) return false;
+        if (array[pos] == ']') return true;
+
+        size_t end = JsonValueEnd(array, pos);
+        if (end == std::string_view::npos) return false;
+        visit(array.substr(pos, end - pos));
+        pos = end;
+    }
+}
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_JSON_H
@@ -10,17 +10,13 @@
 #ifndef HEDGE_EDGE_LICENSE_H
 #define HEDGE_EDGE_LICENSE_H
 
+// Export/Import macro and calling convention
+#include "HedgeEdgePlatform.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// Export/Import macro
-#ifdef HEDGEEDGE_EXPORTS
-    #define HEDGEEDGE_API __declspec(dllexport)
-#else
-    #define HEDGEEDGE_API __declspec(dllimport)
-#endif
-
 // ============================================================================
 // Return Codes
 // ============================================================================
@@ -0,0 +1,477 @@
+// ============================================================================
+// Hedge Edge Parity Check
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeParity.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    int Sign(int64_t value)
+    {
+        return value > 0 ? 1 : (value < 0 ? -1 : 0);
+    }
+
+    // Decimals of a lot step: 1000000 (0.01) -> 2
+    int StepDigits(int64_t stepUnits)
+    {
+        int digits = 8;
+        while (digits > 0 && stepUnits > 0 && stepUnits % 10 == 0)
+        {
+            stepUnits /= 10;
+            digits--;
+        }
+        return digits;
+    }
+
+    const char* TicketAction(const char* kind, int64_t expected, int64_t actual)
+    {
+        if (std::strcmp(kind, "missing") == 0) return "open";
+        if (std::strcmp(kind, "direction") == 0) return "reverse";
+        if (std::strcmp(kind, "volume") == 0 && expected != 0)
+        {
+            return std::llabs(expected) > std::llabs(actual) ? "increase" : "reduce";
+        }
+        return "close";
+    }
+
+} // anonymous namespace
+
+// ============================================================================
+// ParityEngine
+// ============================================================================
+
+void ParityEngine::SetSymbol(const std::string& symbol, const CopySymbol& limits)
+{
+    m_symbols[symbol] = limits;
+}
+
+const CopySymbol& ParityEngine::Limits(const std::string& symbol) const
+{
+    auto found = m_symbols.find(symbol);
+    return found != m_symbols.end() ? found->second : m_defaultLimits;
+}
+
+void ParityEngine::Begin()
+{
+    m_master.clear();
+    m_hedge.clear();
+    m_mapping.clear();
+}
+
+void ParityEngine::AddMaster(const ParityPosition& position)
+{
+    m_master.push_back(position);
+}
+
+void ParityEngine::AddHedge(const ParityPosition& position)
+{
+    m_hedge.push_back(position);
+}
+
+void ParityEngine::AddMapping(uint64_t masterTicket, uint64_t hedgeTicket)
+{
+    m_mapping[hedgeTicket] = masterTicket;
+}
+
+bool ParityEngine::Confirm(const std::string& key, std::unordered_map<std::string, int>& seen)
+{
+    auto previous = m_streaks.find(key);
+    int streak = (previous != m_streaks.end() ? previous->second : 0) + 1;
+    seen[key] = streak;
+    return streak >= m_config.confirmChecks;
+}
+
+size_t ParityEngine::Evaluate()
+{
+    uint64_t start = NowMicros();
+    m_parity.clear();
+    m_issues.clear();
+
+    const CopyConfig& copy = m_config.copy;
+    int64_t fixedUnits = copy.fixedLots > 0.0 ? LotsToUnits(copy.fixedLots) : 0;
+
+    // Master book: copy target per ticket and net exposure per symbol
+    std::unordered_map<uint64_t, size_t> masterIndex;
+    masterIndex.reserve(m_master.size());
+    std::vector<int64_t>  expected(m_master.size(), 0);
+    std::vector<int64_t>  hedged(m_master.size(), 0);
+    std::vector<uint64_t> hedgeTicket(m_master.size(), 0);
+
+    for (size_t i = 0; i < m_master.size(); i++)
+    {
+        const ParityPosition& position = m_master[i];
+        masterIndex[position.ticket] = i;
+
+        int hedgeSide = copy.invert ? -position.side : position.side;
+        expected[i] = hedgeSide * CopyHedgeUnits(copy, Limits(position.symbol), position.volumeUnits);
+
+        SymbolParity& parity = m_parity[position.symbol];
+        parity.masterNet += position.side * position.volumeUnits;
+        parity.targetNet += expected[i];
+        parity.rawNet += hedgeSide * (fixedUnits > 0 ? static_cast<double>(fixedUnits)
+                                                     : position.volumeUnits * copy.lotMultiplier);
+    }
+
+    std::unordered_map<std::string, int> seen;
+
+    // Hedge book: net exposure, and each position against its master ticket
+    for (const ParityPosition& position : m_hedge)
+    {
+        int64_t units = position.side * position.volumeUnits;
+        m_parity[position.symbol].hedgeNet += units;
+
+        uint64_t masterTicket = position.masterTicket;
+        if (masterTicket == 0)
+        {
+            auto mapped = m_mapping.find(position.ticket);
+            if (mapped != m_mapping.end()) masterTicket = mapped->second;
+        }
+
+        auto master = masterTicket != 0 ? masterIndex.find(masterTicket) : masterIndex.end();
+        if (master == masterIndex.end())
+        {
+            TicketIssue issue;
+            issue.kind = masterTicket != 0 ? "orphan" : "unmapped";
+            issue.masterTicket = masterTicket;
+            issue.hedgeTicket = position.ticket;
+            issue.symbol = position.symbol;
+            issue.actualUnits = units;
+            if (Confirm(std::string(issue.kind) + ":" + std::to_string(position.ticket), seen))
+            {
+                m_issues.push_back(std::move(issue));
+            }
+            continue;
+        }
+
+        hedged[master->second] += units;
+        if (hedgeTicket[master->second] == 0) hedgeTicket[master->second] = position.ticket;
+    }
+
+    for (size_t i = 0; i < m_master.size(); i++)
+    {
+        // A copy that rounds to zero is not expected to exist on the hedge
+        if (expected[i] == 0 && hedged[i] == 0) continue;
+
+        const ParityPosition& position = m_master[i];
+        int64_t tolerance = m_config.toleranceSteps * Limits(position.symbol).stepUnits;
+
+        const char* kind = nullptr;
+        if (hedgeTicket[i] == 0) kind = "missing";
+        else if (expected[i] != 0 && hedged[i] != 0 && Sign(hedged[i]) != Sign(expected[i])) kind = "direction";
+        else if (std::llabs(hedged[i] - expected[i]) > tolerance) kind = "volume";
+        if (!kind) continue;
+
+        if (!Confirm(std::string(kind) + ":" + std::to_string(position.ticket), seen)) continue;
+
+        TicketIssue issue;
+        issue.kind = kind;
+        issue.masterTicket = position.ticket;
+        issue.hedgeTicket = hedgeTicket[i];
+        issue.symbol = position.symbol;
+        issue.expectedUnits = expected[i];
+        issue.actualUnits = hedged[i];
+        m_issues.push_back(std::move(issue));
+    }
+
+    // Net drift per symbol
+    size_t symbolMismatches = 0;
+    for (auto& [symbol, parity] : m_parity)
+    {
+        int64_t step = Limits(symbol).stepUnits;
+        int64_t tolerance = m_config.toleranceSteps * step;
+
+        parity.clamped = step > 0 && std::llabs(parity.targetNet - std::llround(parity.rawNet)) >= step;
+        if (std::llabs(parity.hedgeNet - parity.targetNet) > tolerance)
+        {
+            parity.mismatch = Confirm("symbol:" + symbol, seen);
+        }
+        if (parity.mismatch) symbolMismatches++;
+    }
+
+    m_streaks.swap(seen);
+    m_reported = symbolMismatches + m_issues.size();
+
+    m_checks++;
+    if (m_reported > 0) m_mismatchChecks++;
+    m_symbolMismatches += symbolMismatches;
+    m_ticketMismatches += m_issues.size();
+    m_lastCheckUs = NowMicros() - start;
+    m_lastCheckWallUs = WallMicros();
+    return m_reported;
+}
+
+void ParityEngine::AppendLots(std::string& out, const std::string& symbol, int64_t units) const
+{
+    AppendFixed(out, static_cast<double>(units) / LOT_UNITS_PER_LOT, StepDigits(Limits(symbol).stepUnits));
+}
+
+// Trade that moves the hedge by `units` (+ buys, - sells), whole lot steps
+void ParityEngine::AppendCorrection(std::string& out, const std::string& symbol, int64_t units) const
+{
+    int64_t step = Limits(symbol).stepUnits;
+    int64_t steps = VolumeSteps(std::llabs(units), step);
+    if (steps == 0)
+    {
+        out += "null";
+        return;
+    }
+
+    out += "{\"side\":\"";
+    out += units > 0 ? "BUY" : "SELL";
+    out += "\",\"lots\":";
+    AppendLots(out, symbol, steps * step);
+    out += ",\"volumeSteps\":";
+    AppendInt(out, steps);
+    out += "}";
+}
+
+std::string ParityEngine::ReportJson() const
+{
+    std::string json = "{\"mismatches\":";
+    AppendUInt(json, m_reported);
+    json += ",\"checkedAtUs\":";
+    AppendUInt(json, m_lastCheckWallUs);
+
+    json += ",\"symbols\":[";
+    bool first = true;
+    for (const auto& [symbol, parity] : m_parity)
+    {
+        if (!first) json += ",";
+        first = false;
+
+        int digits = std::min(StepDigits(Limits(symbol).stepUnits) + 2, 8);
+        json += "{\"symbol\":\"";
+        json += symbol;
+        json += "\",\"masterNet\":";
+        AppendLots(json, symbol, parity.masterNet);
+        json += ",\"hedgeTarget\":";
+        AppendLots(json, symbol, parity.targetNet);
+        json += ",\"hedgeRaw\":";
+        AppendFixed(json, parity.rawNet / LOT_UNITS_PER_LOT, digits);
+        json += ",\"hedgeNet\":";
+        AppendLots(json, symbol, parity.hedgeNet);
+        json += ",\"drift\":";
+        AppendLots(json, symbol, parity.hedgeNet - parity.targetNet);
+        json += ",\"mismatch\":";
+        json += parity.mismatch ? "true" : "false";
+        json += ",\"clamped\":";
+        json += parity.clamped ? "true" : "false";
+        json += ",\"correction\":";
+        if (parity.mismatch) AppendCorrection(json, symbol, parity.targetNet - parity.hedgeNet);
+        else json += "null";
+        json += "}";
+    }
+
+    json += "],\"tickets\":[";
+    first = true;
+    for (const TicketIssue& issue : m_issues)
+    {
+        if (!first) json += ",";
+        first = false;
+
+        json += "{\"kind\":\"";
+        json += issue.kind;
+        json += "\",\"action\":\"";
+        json += TicketAction(issue.kind, issue.expectedUnits, issue.actualUnits);
+        json += "\",\"master\":";
+        AppendUInt(json, issue.masterTicket);
+        json += ",\"hedge\":";
+        AppendUInt(json, issue.hedgeTicket);
+        json += ",\"symbol\":\"";
+        json += issue.symbol;
+        json += "\",\"expected\":";
+        AppendLots(json, issue.symbol, issue.expectedUnits);
+        json += ",\"actual\":";
+        AppendLots(json, issue.symbol, issue.actualUnits);
+        json += ",\"correction\":";
+        AppendCorrection(json, issue.symbol, issue.expectedUnits - issue.actualUnits);
+        json += "}";
+    }
+    json += "]}";
+    return json;
+}
+
+std::string ParityEngine::StatsJson() const
+{
+    std::string json = "{\"checks\":";
+    AppendUInt(json, m_checks);
+    json += ",\"mismatchChecks\":";
+    AppendUInt(json, m_mismatchChecks);
+    json += ",\"symbolMismatches\":";
+    AppendUInt(json, m_symbolMismatches);
+    json += ",\"ticketMismatches\":";
+    AppendUInt(json, m_ticketMismatches);
+    json += ",\"current\":";
+    AppendUInt(json, m_reported);
+    json += ",\"masterPositions\":";
+    AppendUInt(json, m_master.size());
+    json += ",\"hedgePositions\":";
+    AppendUInt(json, m_hedge.size());
+    json += ",\"lastCheckUs\":";
+    AppendUInt(json, m_lastCheckUs);
+    json += ",\"lastCheckAtUs\":";
+    AppendUInt(json, m_lastCheckWallUs);
+    json += "}";
+    return json;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    hedgeedge::HandleTable<hedgeedge::ParityEngine> g_parityEngines;
+
+    hedgeedge::CopyConfig MakeCopyConfig(int invert, double lotMultiplier, double fixedLots, double maxLots)
+    {
+        hedgeedge::CopyConfig copy;
+        copy.invert = invert != 0;
+        copy.lotMultiplier = lotMultiplier;
+        copy.fixedLots = fixedLots;
+        copy.maxLots = maxLots;
+        return copy;
+    }
+
+    bool ValidCopyConfig(double lotMultiplier, double fixedLots, double maxLots)
+    {
+        return lotMultiplier >= 0.0 && fixedLots >= 0.0 && maxLots > 0.0;
+    }
+
+    hedgeedge::ParityPosition MakePosition(long long ticket, const char* symbol, int type, long long volumeUnits)
+    {
+        hedgeedge::ParityPosition position;
+        position.ticket = static_cast<uint64_t>(ticket);
+        position.symbol = symbol;
+        position.side = type == 0 ? 1 : -1;
+        position.volumeUnits = volumeUnits;
+        return position;
+    }
+
+    int CopyOut(const std::string& text, char* out, int len)
+    {
+        if (!out || len <= 0) return -5;
+        if (text.size() >= static_cast<size_t>(len)) return -5;
+        std::memcpy(out, text.c_str(), text.size() + 1);
+        return static_cast<int>(text.size());
+    }
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall ParityCreate(int invert, double lotMultiplier, double fixedLots, double maxLots,
+                                         int toleranceSteps, int confirmChecks)
+{
+    if (!ValidCopyConfig(lotMultiplier, fixedLots, maxLots) || toleranceSteps < 0 || confirmChecks < 1)
+    {
+        return -5;
+    }
+
+    hedgeedge::ParityConfig config;
+    config.copy = MakeCopyConfig(invert, lotMultiplier, fixedLots, maxLots);
+    config.toleranceSteps = toleranceSteps;
+    config.confirmChecks = confirmChecks;
+    return g_parityEngines.Add(std::make_shared<hedgeedge::ParityEngine>(config));
+}
+
+HEDGEEDGE_API int __stdcall ParitySetCopyConfig(int handle, int invert, double lotMultiplier, double fixedLots,
+                                                double maxLots)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (!engine) return -1;
+    if (!ValidCopyConfig(lotMultiplier, fixedLots, maxLots)) return -5;
+
+    engine->SetCopyConfig(MakeCopyConfig(invert, lotMultiplier, fixedLots, maxLots));
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall ParitySetSymbol(int handle, const char* symbol, long long stepUnits,
+                                            long long minUnits, long long maxUnits)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (!engine) return -1;
+    if (!symbol || stepUnits <= 0 || minUnits < 0 || maxUnits < 0) return -5;
+
+    hedgeedge::CopySymbol limits;
+    limits.stepUnits = stepUnits;
+    limits.minUnits = minUnits;
+    limits.maxUnits = maxUnits;
+    engine->SetSymbol(symbol, limits);
+    return 0;
+}
+
+HEDGEEDGE_API void __stdcall ParityBegin(int handle)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (engine) engine->Begin();
+}
+
+HEDGEEDGE_API void __stdcall ParityAddMaster(int handle, long long ticket, const char* symbol, int type,
+                                             long long volumeUnits)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (!engine || !symbol) return;
+    engine->AddMaster(MakePosition(ticket, symbol, type, volumeUnits));
+}
+
+HEDGEEDGE_API void __stdcall ParityAddHedge(int handle, long long ticket, const char* symbol, int type,
+                                            long long volumeUnits)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (!engine || !symbol) return;
+    engine->AddHedge(MakePosition(ticket, symbol, type, volumeUnits));
+}
+
+HEDGEEDGE_API void __stdcall ParityAddMapping(int handle, long long masterTicket, long long hedgeTicket)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (engine) engine->AddMapping(static_cast<uint64_t>(masterTicket), static_cast<uint64_t>(hedgeTicket));
+}
+
+HEDGEEDGE_API int __stdcall ParityEvaluate(int handle)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (!engine) return -1;
+    return static_cast<int>(engine->Evaluate());
+}
+
+HEDGEEDGE_API int __stdcall ParityReport(int handle, char* outJson, int jsonLen)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (!engine) return -1;
+    return CopyOut(engine->ReportJson(), outJson, jsonLen);
+}
+
+HEDGEEDGE_API int __stdcall ParityStats(int handle, char* outJson, int jsonLen)
+{
+    auto engine = g_parityEngines.Get(handle);
+    if (!engine) return -1;
+    return CopyOut(engine->StatsJson(), outJson, jsonLen);
+}
+
+HEDGEEDGE_API void __stdcall ParityClose(int handle)
+{
+    g_parityEngines.Remove(handle);
+}
+
+} // extern "C"
@@ -0,0 +1,219 @@
+// ============================================================================
+// Hedge Edge Parity Check
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Compares the hedge's book with the book its copy rules imply, where the
+// ticket reconciliation in HE_Hedge.mq5 only sees missing and orphaned
+// tickets. Each check takes both books in full, in O(positions):
+//
+//   per symbol   master net, hedge target net (what CalculateLotSize would
+//                have opened for every master position, inverted), the raw
+//                master net x multiplier, and the hedge's actual net. A
+//                drift (actual - target) beyond the tolerance is a mismatch,
+//                with the trade that restores the target.
+//   per ticket   mapped hedge volume against the copy volume of its master
+//                position: "volume" (partial fill or close), "direction",
+//                "missing" (no hedge), "orphan" (master gone), "unmapped"
+//                (hedge position with the copier's magic but no mapping).
+//
+// A symbol whose target differs from the raw net by a lot step or more is
+// flagged "clamped": lot limits keep the hedge from matching the multiplier,
+// which no trade on this account can fix.
+//
+// A mismatch is reported once it is seen in `confirmChecks` consecutive
+// checks, so fills still in flight when a snapshot arrives are not flagged.
+// Ticket and symbol corrections describe the same drift from two sides:
+// apply one or the other, not both.
+//
+// Not synchronized: owned by one thread.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_PARITY_H
+#define HEDGE_EDGE_PARITY_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "HedgeEdgeCopy.h"
+
+namespace hedgeedge {
+
+struct ParityConfig
+{
+    CopyConfig copy;                        // invert, lotMultiplier, fixedLots, maxLots
+    int        toleranceSteps = 0;          // Drift allowed, in the symbol's lot steps
+    int        confirmChecks = 2;           // Consecutive checks before a mismatch is reported
+};
+
+struct ParityPosition
+{
+    uint64_t    ticket = 0;
+    uint64_t    masterTicket = 0;           // Hedge side: 0 = look up the mappings
+    std::string symbol;
+    int         side = 1;                   // +1 BUY, -1 SELL
+    int64_t     volumeUnits = 0;
+};
+
+class ParityEngine
+{
+public:
+    explicit ParityEngine(const ParityConfig& config) : m_config(config) {}
+
+    // Copy settings changed at runtime (SET_CONFIG)
+    void SetCopyConfig(const CopyConfig& copy) { m_config.copy = copy; }
+
+    // Hedge symbol limits (default: 0.01 step and minimum)
+    void SetSymbol(const std::string& symbol, const CopySymbol& limits);
+
+    // One check: Begin, both books and the copier's ticket map, Evaluate.
+    // Returns the reported mismatches.
+    void   Begin();
+    void   AddMaster(const ParityPosition& position);
+    void   AddHedge(const ParityPosition& position);
+    void   AddMapping(uint64_t masterTicket, uint64_t hedgeTicket);
+    size_t Evaluate();
+
+    size_t Mismatches() const { return m_reported; }
+
+    // {"mismatches":N,"symbols":[..every symbol..],"tickets":[..mismatches..]}
+    std::string ReportJson() const;
+
+    // {"checks":..,"mismatchChecks":..,"symbolMismatches":..,"ticketMismatches":..,..}
+    std::string StatsJson() const;
+
+private:
+    struct SymbolParity
+    {
+        int64_t masterNet = 0;              // Master book, signed
+        int64_t targetNet = 0;              // Hedge per the copy rules, signed
+        double  rawNet = 0.0;               // Master net x multiplier, hedge sign
+        int64_t hedgeNet = 0;               // Hedge book, signed
+        bool    mismatch = false;
+        bool    clamped = false;
+    };
+
+    struct TicketIssue
+    {
+        const char* kind = "";
+        uint64_t    masterTicket = 0;
+        uint64_t    hedgeTicket = 0;
+        std::string symbol;
+        int64_t     expectedUnits = 0;      // Hedge volume, signed
+        int64_t     actualUnits = 0;
+    };
+
+    const CopySymbol& Limits(const std::string& symbol) const;
+    bool Confirm(const std::string& key, std::unordered_map<std::string, int>& seen);
+    void AppendLots(std::string& out, const std::string& symbol, int64_t units) const;
+    void AppendCorrection(std::string& out, const std::string& symbol, int64_t units) const;
+
+    ParityConfig m_config;
+    std::unordered_map<std::string, CopySymbol> m_symbols;
+    CopySymbol   m_defaultLimits;
+
+    std::vector<ParityPosition> m_master;
+    std::vector<ParityPosition> m_hedge;
+    std::unordered_map<uint64_t, uint64_t> m_mapping;       // Hedge ticket -> master ticket
+
+    std::map<std::string, SymbolParity> m_parity;           // Last check, by symbol
+    std::vector<TicketIssue>            m_issues;           // Last check, reported only
+    std::unordered_map<std::string, int> m_streaks;         // Consecutive sightings
+    size_t   m_reported = 0;
+
+    uint64_t m_checks = 0;
+    uint64_t m_mismatchChecks = 0;
+    uint64_t m_symbolMismatches = 0;
+    uint64_t m_ticketMismatches = 0;
+    uint64_t m_lastCheckUs = 0;
+    uint64_t m_lastCheckWallUs = 0;
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Parity Check (Hedge EA)
+// ============================================================================
+
+/**
+ * Create a parity checker.
+ *
+ * @param invert          1 = hedge side is the inverse of the master side
+ * @param lotMultiplier   Copy multiplier (ignored if fixedLots > 0)
+ * @param fixedLots       Fixed copy volume, 0 = multiplier
+ * @param maxLots         InpMaxLots
+ * @param toleranceSteps  Net drift allowed per symbol, in lot steps
+ * @param confirmChecks   Consecutive checks before a mismatch is reported (>= 1)
+ *
+ * @return Handle (>0) on success, -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall ParityCreate(int invert, double lotMultiplier, double fixedLots, double maxLots,
+                                         int toleranceSteps, int confirmChecks);
+
+/**
+ * Copy settings changed at runtime.
+ *
+ * @return 0 on success, -1 if not open
+ */
+HEDGEEDGE_API int __stdcall ParitySetCopyConfig(int handle, int invert, double lotMultiplier, double fixedLots,
+                                                double maxLots);
+
+/**
+ * Hedge symbol volume limits, in 1e-8 lots (maxUnits 0 = only maxLots).
+ *
+ * @return 0 on success, -1 if not open, -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall ParitySetSymbol(int handle, const char* symbol, long long stepUnits,
+                                            long long minUnits, long long maxUnits);
+
+/**
+ * One check: ParityBegin, ParityAddMaster for every master position,
+ * ParityAddHedge for every copier position on the hedge account,
+ * ParityAddMapping for every master -> hedge ticket pair the copier holds,
+ * ParityEvaluate. Types are POSITION_TYPE_BUY (0) / SELL (1).
+ *
+ * @return ParityEvaluate: reported mismatches, -1 if not open
+ */
+HEDGEEDGE_API void __stdcall ParityBegin(int handle);
+HEDGEEDGE_API void __stdcall ParityAddMaster(int handle, long long ticket, const char* symbol, int type,
+                                             long long volumeUnits);
+HEDGEEDGE_API void __stdcall ParityAddHedge(int handle, long long ticket, const char* symbol, int type,
+                                            long long volumeUnits);
+HEDGEEDGE_API void __stdcall ParityAddMapping(int handle, long long masterTicket, long long hedgeTicket);
+HEDGEEDGE_API int __stdcall ParityEvaluate(int handle);
+
+/**
+ * Last check: net exposure per symbol on both sides, mismatches and
+ * suggested corrections.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall ParityReport(int handle, char* outJson, int jsonLen);
+
+/**
+ * Check counts and mismatch totals as JSON.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall ParityStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Close a parity checker handle.
+ */
+HEDGEEDGE_API void __stdcall ParityClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_PARITY_H
@@ -0,0 +1,176 @@
+// ============================================================================
+// Hedge Edge Native Platform Layer
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <dlfcn.h>
+    #include <signal.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+#include <chrono>
+#include <cstdio>
+
+#include "HedgeEdgePlatform.h"
+
+namespace hedgeedge {
+
+uint64_t NowMicros()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(
+        duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t NowNanos()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(
+        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t WallMicros()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(
+        duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
+}
+
+uint32_t CurrentProcessId()
+{
+#ifdef _WIN32
+    return static_cast<uint32_t>(GetCurrentProcessId());
+#else
+    return static_cast<uint32_t>(getpid());
+#endif
+}
+
+bool IsProcessAlive(uint32_t pid)
+{
+    if (pid == 0) return false;
+#ifdef _WIN32
+    HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, pid);
+    if (!process) return false;
+    DWORD wait = WaitForSingleObject(process, 0);
+    CloseHandle(process);
+    return wait == WAIT_TIMEOUT;
+#else
+    // Signal 0 performs the permission/existence check without delivering
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
+
+void* LoadSharedLibrary(std::initializer_list<const char*> names)
+{
+    for (const char* name : names)
+    {
+#ifdef _WIN32
+        HMODULE module = LoadLibraryA(name);
+        if (module) return reinterpret_cast<void*>(module);
+#else
+        void* module = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+        if (module) return module;
+#endif
+    }
+    return nullptr;
+}
+
+void* LibrarySymbol(void* library, const char* name)
+{
+    if (!library) return nullptr;
+#ifdef _WIN32
+    return reinterpret_cast<void*>(GetProcAddress(reinterpret_cast<HMODULE>(library), name));
+#else
+    return dlsym(library, name);
+#endif
+}
+
+namespace {
+
+#ifdef _WIN32
+    std::wstring WidePath(const std::string& path)
+    {
+        int length = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+        if (length <= 0) return std::wstring();
+        std::wstring widePath(static_cast<size_t>(length), L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, &widePath[0], length);
+        return widePath;
+    }
+#endif
+
+    FILE* OpenFile(const std::string& path, bool write)
+    {
+#ifdef _WIN32
+        std::wstring widePath = WidePath(path);
+        if (widePath.empty()) return nullptr;
+        return _wfopen(widePath.c_str(), write ? L"wb" : L"rb");
+#else
+        return std::fopen(path.c_str(), write ? "wb" : "rb");
+#endif
+    }
+
+} // namespace
+
+bool ReadFileBytes(const std::string& path, std::string& out)
+{
+    FILE* file = OpenFile(path, false);
+    if (!file) return false;
+
+    out.clear();
+    char buffer[65536];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        out.append(buffer, read);
+    }
+    bool ok = !std::ferror(file);
+    std::fclose(file);
+    return ok;
+}
+
+bool WriteFileBytes(const std::string& path, const std::string& data)
+{
+    FILE* file = OpenFile(path, true);
+    if (!file) return false;
+
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = (std::fclose(file) == 0) && ok;
+    return ok;
+}
+
+std::FILE* OpenFileStream(const std::string& path, bool write)
+{
+    return OpenFile(path, write);
+}
+
+bool FileExists(const std::string& path)
+{
+    FILE* file = OpenFile(path, false);
+    if (!file) return false;
+    std::fclose(file);
+    return true;
+}
+
+bool MakeDirectory(const std::string& path)
+{
+#ifdef _WIN32
+    std::wstring widePath = WidePath(path);
+    if (widePath.empty()) return false;
+    if (CreateDirectoryW(widePath.c_str(), nullptr)) return true;
+    DWORD attributes = GetFileAttributesW(widePath.c_str());
+    return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+    if (mkdir(path.c_str(), 0700) == 0) return true;
+    struct stat st = {};
+    return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+#endif
+}
+
+} // namespace hedgeedge
@@ -0,0 +1,81 @@
+// ============================================================================
+// Hedge Edge Native Platform Layer
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Export macros, calling convention and clock helpers shared by every native
+// module. The DLL is built on Windows; the same sources build as a static
+// core library on Linux for the tools, benchmarks and replay harness.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_PLATFORM_H
+#define HEDGE_EDGE_PLATFORM_H
+
+#include <cstdint>
+
+#ifdef __cplusplus
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+#endif
+
+// Export/Import macro
+#ifdef _WIN32
+    #ifdef HEDGEEDGE_EXPORTS
+        #define HEDGEEDGE_API __declspec(dllexport)
+    #else
+        #define HEDGEEDGE_API __declspec(dllimport)
+    #endif
+#else
+    #define HEDGEEDGE_API __attribute__((visibility("default")))
+    // MT5 only exists on Windows; elsewhere the calling convention is a no-op
+    #ifndef __stdcall
+        #define __stdcall
+    #endif
+#endif
+
+#ifdef __cplusplus
+
+namespace hedgeedge {
+
+// Monotonic clock in microseconds (latency measurement, never goes backwards)
+uint64_t NowMicros();
+
+// Same clock in nanoseconds (stages shorter than a microsecond)
+uint64_t NowNanos();
+
+// Wall clock in microseconds since the Unix epoch (wire timestamps)
+uint64_t WallMicros();
+
+// Current process id (stale-writer detection in shared memory segments)
+uint32_t CurrentProcessId();
+
+// Returns true if the process with the given id is still running
+bool IsProcessAlive(uint32_t pid);
+
+// Load the first shared library that resolves from `names` (nullptr if none).
+// Optional runtimes (libzmq, zstd, lz4) are bound at run time so the DLL
+// still loads on terminals that only use licensing.
+void* LoadSharedLibrary(std::initializer_list<const char*> names);
+
+// Resolve a symbol from a library returned by LoadSharedLibrary
+void* LibrarySymbol(void* library, const char* name);
+
+// Read/write a whole file; paths are UTF-8 on every platform
+bool ReadFileBytes(const std::string& path, std::string& out);
+bool WriteFileBytes(const std::string& path, const std::string& data);
+
+// Open a file for binary streaming ("rb", or "wb" when `write`); UTF-8 path
+std::FILE* OpenFileStream(const std::string& path, bool write);
+
+// True if `path` can be opened for reading
+bool FileExists(const std::string& path);
+
+// Create a directory (parent must exist); true if it exists afterwards
+bool MakeDirectory(const std::string& path);
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_PLATFORM_H
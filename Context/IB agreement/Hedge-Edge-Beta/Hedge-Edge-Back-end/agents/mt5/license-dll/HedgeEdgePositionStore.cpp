@@ -0,0 +1,462 @@
+// ============================================================================
+// Hedge Edge Position Store
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include "HedgeEdgeFixed.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeJson.h"
+#include "HedgeEdgePositionStore.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    // splitmix64 finalizer: every input bit moves every output bit, so the
+    // wrapping sum over positions only cancels by chance (~2^-64)
+    uint64_t Mix(uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ULL;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    int64_t ScaledOrZero(double price, int digits)
+    {
+        return price > 0 ? ScalePrice(price, digits) : 0;
+    }
+
+    void AppendPriceOrNull(std::string& out, double price, int digits)
+    {
+        if (price > 0) AppendFixed(out, price, digits);
+        else out += "null";
+    }
+
+    const char* SideName(int32_t type)
+    {
+        return type == 0 ? "BUY" : "SELL";
+    }
+
+} // anonymous namespace
+
+// ============================================================================
+// PositionStore
+// ============================================================================
+
+uint64_t PositionStore::EntryHash(uint64_t ticket, int32_t type, double volume, double stopLoss,
+                                  double takeProfit, int32_t digits)
+{
+    uint64_t hash = Mix(ticket);
+    hash = Mix(hash ^ static_cast<uint64_t>(type));
+    hash = Mix(hash ^ static_cast<uint64_t>(LotsToUnits(volume)));
+    hash = Mix(hash ^ static_cast<uint64_t>(ScaledOrZero(stopLoss, digits)));
+    hash = Mix(hash ^ static_cast<uint64_t>(ScaledOrZero(takeProfit, digits)));
+    return hash;
+}
+
+void PositionStore::Render(Entry& entry)
+{
+    const StoredPosition& p = entry.position;
+
+    entry.head.clear();
+    entry.head += "{\"id\":\"";
+    AppendUInt(entry.head, p.ticket);
+    entry.head += "\",\"symbol\":\"";
+    entry.head += p.symbol;
+    entry.head += "\",\"volume\":";
+    AppendFixed(entry.head, p.volume * 100000, 0);
+    entry.head += ",\"volumeLots\":";
+    AppendFixed(entry.head, p.volume, 2);
+    entry.head += ",\"side\":\"";
+    entry.head += SideName(p.type);
+    entry.head += "\",\"entryPrice\":";
+    AppendFixed(entry.head, p.entryPrice, p.digits);
+    entry.head += ",\"currentPrice\":";
+
+    entry.middle.clear();
+    entry.middle += ",\"stopLoss\":";
+    AppendPriceOrNull(entry.middle, p.stopLoss, p.digits);
+    entry.middle += ",\"takeProfit\":";
+    AppendPriceOrNull(entry.middle, p.takeProfit, p.digits);
+    entry.middle += ",\"profit\":";
+
+    entry.tail.clear();
+    entry.tail += ",\"commission\":0.00,\"openTime\":\"";
+    AppendServerTime(entry.tail, p.openTime);
+    entry.tail += "\",\"comment\":";
+    AppendJsonString(entry.tail, p.comment);
+    entry.tail += ",\"digits\":";
+    AppendInt(entry.tail, p.digits);
+    entry.tail += ",\"entryPriceScaled\":";
+    AppendInt(entry.tail, ScaledOrZero(p.entryPrice, p.digits));
+    entry.tail += ",\"stopLossScaled\":";
+    AppendInt(entry.tail, ScaledOrZero(p.stopLoss, p.digits));
+    entry.tail += ",\"takeProfitScaled\":";
+    AppendInt(entry.tail, ScaledOrZero(p.takeProfit, p.digits));
+    entry.tail += ",\"volumeSteps\":";
+    AppendInt(entry.tail, VolumeSteps(LotsToUnits(p.volume), p.lotStepE8));
+    entry.tail += ",\"lotStepE8\":";
+    AppendInt(entry.tail, p.lotStepE8);
+    entry.tail += "}";
+}
+
+int PositionStore::Upsert(const StoredPosition& position, StoredPosition* previous)
+{
+    m_upserts++;
+
+    auto it = m_positions.find(position.ticket);
+    int changes = 0;
+    if (it == m_positions.end())
+    {
+        it = m_positions.emplace(position.ticket, Entry()).first;
+        changes = ADDED;
+    }
+    else
+    {
+        const StoredPosition& old = it->second.position;
+        if (previous) *previous = old;
+
+        int digits = position.digits;
+        if (old.type != position.type || LotsToUnits(old.volume) != LotsToUnits(position.volume))
+        {
+            changes |= VOLUME;
+        }
+        if (ScaledOrZero(old.stopLoss, digits) != ScaledOrZero(position.stopLoss, digits) ||
+            ScaledOrZero(old.takeProfit, digits) != ScaledOrZero(position.takeProfit, digits))
+        {
+            changes |= STOPS;
+        }
+        if (old.symbol != position.symbol || old.digits != position.digits ||
+            ScalePrice(old.entryPrice, digits) != ScalePrice(position.entryPrice, digits) ||
+            old.openTime != position.openTime || old.comment != position.comment ||
+            old.lotStepE8 != position.lotStepE8)
+        {
+            changes |= OTHER;
+        }
+    }
+
+    Entry& entry = it->second;
+    if (changes == 0)
+    {
+        entry.position.profit = position.profit;
+        entry.position.swap = position.swap;
+        return 0;
+    }
+
+    m_checksum -= entry.hash;
+    entry.position = position;
+    entry.hash = EntryHash(position.ticket, position.type, position.volume,
+                           position.stopLoss, position.takeProfit, position.digits);
+    m_checksum += entry.hash;
+    Render(entry);
+    m_version++;
+    return changes;
+}
+
+bool PositionStore::Remove(uint64_t ticket)
+{
+    auto it = m_positions.find(ticket);
+    if (it == m_positions.end()) return false;
+
+    m_checksum -= it->second.hash;
+    m_positions.erase(it);
+    m_removes++;
+    m_version++;
+    return true;
+}
+
+void PositionStore::Clear()
+{
+    if (m_positions.empty()) return;
+    m_positions.clear();
+    m_checksum = 0;
+    m_version++;
+}
+
+void PositionStore::SetQuote(const std::string& symbol, double bid, double ask)
+{
+    auto it = m_quotes.find(symbol);
+    if (it == m_quotes.end()) m_quotes.emplace(symbol, std::make_pair(bid, ask));
+    else it->second = std::make_pair(bid, ask);
+}
+
+void PositionStore::VerifyBegin()
+{
+    m_verifyChecksum = 0;
+    m_verifyCount = 0;
+    m_verifyUnknown = 0;
+}
+
+void PositionStore::VerifyAdd(uint64_t ticket, int32_t type, double volume, double stopLoss, double takeProfit,
+                              double profit, double swap)
+{
+    m_verifyCount++;
+
+    auto it = m_positions.find(ticket);
+    if (it == m_positions.end())
+    {
+        m_verifyUnknown++;
+        return;
+    }
+
+    StoredPosition& stored = it->second.position;
+    stored.profit = profit;
+    stored.swap = swap;
+
+    // The terminal's side of the comparison, at the stored digits
+    m_verifyChecksum += EntryHash(ticket, type, volume, stopLoss, takeProfit, stored.digits);
+}
+
+bool PositionStore::VerifyEnd()
+{
+    m_verifies++;
+    bool inSync = m_verifyUnknown == 0 && m_verifyCount == m_positions.size() &&
+                  m_verifyChecksum == m_checksum;
+    if (!inSync)
+    {
+        m_mismatches++;
+        m_lastMismatchWallUs = WallMicros();
+    }
+    return inSync;
+}
+
+std::string PositionStore::SymbolsCsv() const
+{
+    std::string csv;
+    std::map<std::string_view, bool> seen;
+    for (const auto& [ticket, entry] : m_positions)
+    {
+        if (!seen.emplace(entry.position.symbol, true).second) continue;
+        if (!csv.empty()) csv += ",";
+        csv += entry.position.symbol;
+    }
+    return csv;
+}
+
+std::string PositionStore::Json() const
+{
+    std::string json;
+    size_t reserve = 2;
+    for (const auto& [ticket, entry] : m_positions)
+    {
+        reserve += entry.head.size() + entry.middle.size() + entry.tail.size() + 64;
+    }
+    json.reserve(reserve);
+
+    json += "[";
+    bool first = true;
+    for (const auto& [ticket, entry] : m_positions)
+    {
+        const StoredPosition& p = entry.position;
+        if (!first) json += ",";
+        first = false;
+
+        double current = p.entryPrice;
+        auto quote = m_quotes.find(p.symbol);
+        if (quote != m_quotes.end()) current = p.type == 0 ? quote->second.first : quote->second.second;
+
+        json += entry.head;
+        AppendFixed(json, current, p.digits);
+        json += entry.middle;
+        AppendFixed(json, p.profit, 2);
+        json += ",\"swap\":";
+        AppendFixed(json, p.swap, 2);
+        json += entry.tail;
+    }
+    json += "]";
+    return json;
+}
+
+std::string PositionStore::StatsJson() const
+{
+    char checksum[17];
+    std::snprintf(checksum, sizeof(checksum), "%016llx", static_cast<unsigned long long>(m_checksum));
+
+    std::string json = "{\"positions\":";
+    AppendUInt(json, m_positions.size());
+    json += ",\"checksum\":\"";
+    json += checksum;
+    json += "\",\"version\":";
+    AppendUInt(json, m_version);
+    json += ",\"upserts\":";
+    AppendUInt(json, m_upserts);
+    json += ",\"removes\":";
+    AppendUInt(json, m_removes);
+    json += ",\"verifies\":";
+    AppendUInt(json, m_verifies);
+    json += ",\"mismatches\":";
+    AppendUInt(json, m_mismatches);
+    json += ",\"lastMismatchAtUs\":";
+    AppendUInt(json, m_lastMismatchWallUs);
+    json += "}";
+    return json;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    hedgeedge::HandleTable<hedgeedge::PositionStore> g_positionStores;
+
+    int CopyOut(const std::string& text, char* out, int len)
+    {
+        if (!out || len <= 0) return -5;
+        if (text.size() >= static_cast<size_t>(len)) return -5;
+        std::memcpy(out, text.c_str(), text.size() + 1);
+        return static_cast<int>(text.size());
+    }
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall PositionStoreCreate()
+{
+    return g_positionStores.Add(std::make_shared<hedgeedge::PositionStore>());
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreUpsert(int handle, long long ticket, const char* symbol, int type,
+                                                double volume, double entryPrice, double stopLoss,
+                                                double takeProfit, long long openTime, const char* comment,
+                                                int digits, long long lotStepE8, double profit, double swap,
+                                                double* prevStopLoss, double* prevTakeProfit)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    if (!symbol || ticket <= 0 || digits < 0 || digits > hedgeedge::MAX_PRICE_DIGITS || lotStepE8 <= 0)
+    {
+        return -5;
+    }
+
+    hedgeedge::StoredPosition position;
+    position.ticket = static_cast<uint64_t>(ticket);
+    position.symbol = symbol;
+    position.type = type;
+    position.volume = volume;
+    position.entryPrice = entryPrice;
+    position.stopLoss = stopLoss;
+    position.takeProfit = takeProfit;
+    position.openTime = openTime;
+    position.comment = comment ? comment : "";
+    position.digits = digits;
+    position.lotStepE8 = lotStepE8;
+    position.profit = profit;
+    position.swap = swap;
+
+    hedgeedge::StoredPosition previous;
+    int changes = store->Upsert(position, &previous);
+    if (prevStopLoss) *prevStopLoss = previous.stopLoss;
+    if (prevTakeProfit) *prevTakeProfit = previous.takeProfit;
+    return changes;
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreRemove(int handle, long long ticket)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    return store->Remove(static_cast<uint64_t>(ticket)) ? 0 : -4;
+}
+
+HEDGEEDGE_API void __stdcall PositionStoreClear(int handle)
+{
+    auto store = g_positionStores.Get(handle);
+    if (store) store->Clear();
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreCount(int handle)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    return static_cast<int>(store->Count());
+}
+
+HEDGEEDGE_API long long __stdcall PositionStoreVersion(int handle)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    return static_cast<long long>(store->Version());
+}
+
+HEDGEEDGE_API long long __stdcall PositionStoreChecksum(int handle)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return 0;
+    return static_cast<long long>(store->Checksum());
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreSymbols(int handle, char* outCsv, int csvLen)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    return CopyOut(store->SymbolsCsv(), outCsv, csvLen);
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreSetQuote(int handle, const char* symbol, double bid, double ask)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    if (!symbol) return -5;
+
+    store->SetQuote(symbol, bid, ask);
+    return 0;
+}
+
+HEDGEEDGE_API void __stdcall PositionStoreVerifyBegin(int handle)
+{
+    auto store = g_positionStores.Get(handle);
+    if (store) store->VerifyBegin();
+}
+
+HEDGEEDGE_API void __stdcall PositionStoreVerifyAdd(int handle, long long ticket, int type, double volume,
+                                                    double stopLoss, double takeProfit,
+                                                    double profit, double swap)
+{
+    auto store = g_positionStores.Get(handle);
+    if (store) store->VerifyAdd(static_cast<uint64_t>(ticket), type, volume, stopLoss, takeProfit, profit, swap);
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreVerifyEnd(int handle)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    return store->VerifyEnd() ? 0 : 1;
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreJson(int handle, char* outJson, int jsonLen)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    return CopyOut(store->Json(), outJson, jsonLen);
+}
+
+HEDGEEDGE_API int __stdcall PositionStoreStats(int handle, char* outJson, int jsonLen)
+{
+    auto store = g_positionStores.Get(handle);
+    if (!store) return -1;
+    return CopyOut(store->StatsJson(), outJson, jsonLen);
+}
+
+HEDGEEDGE_API void __stdcall PositionStoreClose(int handle)
+{
+    g_positionStores.Remove(handle);
+}
+
+} // extern "C"
@@ -0,0 +1,239 @@
+// ============================================================================
+// Hedge Edge Position Store
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// HE_Prop's open positions, kept in the DLL and updated one ticket at a time
+// from OnTradeTransaction, so snapshots and events no longer rescan every
+// position through a dozen terminal getters.
+//
+// Each position's JSON is rendered once per change and cached in three
+// fragments around the fields that move with the market (currentPrice,
+// profit, swap). A snapshot concatenates the fragments and formats those
+// three numbers, from quotes pushed once per symbol and marks refreshed by
+// the verification pass.
+//
+// The store keeps an order-independent 64-bit checksum of the position set
+// (ticket, side, volume in lot units, SL and TP scaled by digits), updated
+// per change. The verification pass feeds the terminal's positions through
+// VerifyAdd and compares checksums at VerifyEnd; a difference (a missed or
+// early transaction) makes the EA rebuild the store from a full scan.
+//
+// Single-threaded: every call comes from the owning EA thread.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_POSITION_STORE_H
+#define HEDGE_EDGE_POSITION_STORE_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace hedgeedge {
+
+struct StoredPosition
+{
+    uint64_t    ticket = 0;
+    std::string symbol;
+    int32_t     type = 0;                   // POSITION_TYPE_BUY (0) / SELL (1)
+    double      volume = 0.0;               // Lots
+    double      entryPrice = 0.0;
+    double      stopLoss = 0.0;             // 0 = none
+    double      takeProfit = 0.0;           // 0 = none
+    int64_t     openTime = 0;               // Server time (seconds)
+    std::string comment;
+    int32_t     digits = 0;
+    int64_t     lotStepE8 = 1;
+    double      profit = 0.0;               // Marks (verification pass)
+    double      swap = 0.0;
+};
+
+class PositionStore
+{
+public:
+    // Upsert change bits
+    static constexpr int ADDED  = 1;
+    static constexpr int VOLUME = 2;        // Volume or side
+    static constexpr int STOPS  = 4;        // SL or TP at the symbol's digits
+    static constexpr int OTHER  = 8;        // Symbol, entry, open time, comment, ...
+
+    // Insert or replace by ticket; returns the change bits (0 = unchanged).
+    // `previous` receives the entry as it was (untouched when ADDED).
+    int Upsert(const StoredPosition& position, StoredPosition* previous = nullptr);
+
+    bool Remove(uint64_t ticket);
+    void Clear();
+
+    // Latest bid / ask of a symbol (currentPrice: BUY at bid, SELL at ask)
+    void SetQuote(const std::string& symbol, double bid, double ask);
+
+    // Verification against the terminal: VerifyAdd per terminal position
+    // (also refreshes that position's profit and swap), then VerifyEnd
+    // returns true if the terminal matches the store.
+    void VerifyBegin();
+    void VerifyAdd(uint64_t ticket, int32_t type, double volume, double stopLoss, double takeProfit,
+                   double profit, double swap);
+    bool VerifyEnd();
+
+    size_t   Count() const    { return m_positions.size(); }
+    uint64_t Checksum() const { return m_checksum; }
+    uint64_t Version() const  { return m_version; }
+
+    // Distinct symbols of the open positions, comma-separated
+    std::string SymbolsCsv() const;
+
+    // Positions array in the SNAPSHOT / ACCOUNT_UPDATE format
+    std::string Json() const;
+
+    // {"positions":N,"checksum":"..","version":V,"upserts":..,"removes":..,
+    //  "verifies":..,"mismatches":..,"lastMismatchAtUs":..}
+    std::string StatsJson() const;
+
+private:
+    struct Entry
+    {
+        StoredPosition position;
+        uint64_t       hash = 0;
+        std::string    head;                // {"id":..,"entryPrice":..,"currentPrice":
+        std::string    middle;              // ,"stopLoss":..,"takeProfit":..,"profit":
+        std::string    tail;                // ,"commission":..,"openTime":..,..}
+    };
+
+    static uint64_t EntryHash(uint64_t ticket, int32_t type, double volume, double stopLoss,
+                              double takeProfit, int32_t digits);
+    static void Render(Entry& entry);
+
+    std::map<uint64_t, Entry> m_positions;  // Ticket order (open order on MT5)
+    std::map<std::string, std::pair<double, double>, std::less<>> m_quotes;
+    uint64_t m_checksum = 0;
+    uint64_t m_version = 0;
+
+    uint64_t m_verifyChecksum = 0;
+    size_t   m_verifyCount = 0;
+    size_t   m_verifyUnknown = 0;
+
+    uint64_t m_upserts = 0;
+    uint64_t m_removes = 0;
+    uint64_t m_verifies = 0;
+    uint64_t m_mismatches = 0;
+    uint64_t m_lastMismatchWallUs = 0;
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Position Store (Master EA)
+// ============================================================================
+
+/**
+ * Create an empty position store.
+ *
+ * @return Handle (>0) on success
+ */
+HEDGEEDGE_API int __stdcall PositionStoreCreate();
+
+/**
+ * Insert or update one position (from OnTradeTransaction or a rebuild).
+ *
+ * @param symbol          Symbol (UTF-8, null-terminated)
+ * @param type            0 = BUY, 1 = SELL
+ * @param comment         Position comment (UTF-8, null-terminated)
+ * @param digits          SYMBOL_DIGITS
+ * @param lotStepE8       SYMBOL_VOLUME_STEP in 1e-8 lots
+ * @param prevStopLoss    Receives the SL before this call (0 if added)
+ * @param prevTakeProfit  Receives the TP before this call (0 if added)
+ *
+ * @return Change bits (0 = unchanged, 1 = added, 2 = volume / side,
+ *         4 = SL / TP, 8 = other fields), -1 if not open, -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall PositionStoreUpsert(int handle, long long ticket, const char* symbol, int type,
+                                                double volume, double entryPrice, double stopLoss,
+                                                double takeProfit, long long openTime, const char* comment,
+                                                int digits, long long lotStepE8, double profit, double swap,
+                                                double* prevStopLoss, double* prevTakeProfit);
+
+/**
+ * Remove one position.
+ *
+ * @return 0 on success, -1 if not open, -4 if the ticket was not present
+ */
+HEDGEEDGE_API int __stdcall PositionStoreRemove(int handle, long long ticket);
+
+/**
+ * Remove all positions (before a rebuild).
+ */
+HEDGEEDGE_API void __stdcall PositionStoreClear(int handle);
+
+/**
+ * Number of positions in the store (-1 if not open).
+ */
+HEDGEEDGE_API int __stdcall PositionStoreCount(int handle);
+
+/**
+ * Change counter, bumped by every upsert that changed something and every remove.
+ */
+HEDGEEDGE_API long long __stdcall PositionStoreVersion(int handle);
+
+/**
+ * 64-bit checksum of the position set (ticket, side, volume, SL, TP).
+ */
+HEDGEEDGE_API long long __stdcall PositionStoreChecksum(int handle);
+
+/**
+ * Distinct symbols of the open positions, comma-separated.
+ *
+ * @return Text length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall PositionStoreSymbols(int handle, char* outCsv, int csvLen);
+
+/**
+ * Latest bid / ask of a symbol, for the snapshot's currentPrice.
+ *
+ * @return 0 on success, -1 if not open, -5 on a bad parameter
+ */
+HEDGEEDGE_API int __stdcall PositionStoreSetQuote(int handle, const char* symbol, double bid, double ask);
+
+/**
+ * Verification pass: VerifyBegin, VerifyAdd for every terminal position
+ * (also refreshes its profit and swap), VerifyEnd.
+ *
+ * @return VerifyEnd: 0 if the terminal matches the store, 1 if it differs
+ *         (rebuild the store), -1 if not open
+ */
+HEDGEEDGE_API void __stdcall PositionStoreVerifyBegin(int handle);
+HEDGEEDGE_API void __stdcall PositionStoreVerifyAdd(int handle, long long ticket, int type, double volume,
+                                                    double stopLoss, double takeProfit,
+                                                    double profit, double swap);
+HEDGEEDGE_API int __stdcall PositionStoreVerifyEnd(int handle);
+
+/**
+ * Positions array as published in SNAPSHOT and ACCOUNT_UPDATE.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall PositionStoreJson(int handle, char* outJson, int jsonLen);
+
+/**
+ * Counts, checksum and verification results as JSON.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall PositionStoreStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Close a position store handle.
+ */
+HEDGEEDGE_API void __stdcall PositionStoreClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_POSITION_STORE_H
@@ -0,0 +1,404 @@
+// ============================================================================
+// Hedge Edge Shared Position Table
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Seqlock protocol (one writer):
+//   seq odd  -> mutation in progress, readers retry
+//   seq even -> table stable; a reader's copy is valid if seq did not change
+// ============================================================================
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgePositionTable.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const int SNAPSHOT_RETRIES = 64;
+
+    PositionRecord* Records(PositionTableHeader* header)
+    {
+        return reinterpret_cast<PositionRecord*>(reinterpret_cast<char*>(header) + sizeof(PositionTableHeader));
+    }
+
+} // namespace
+
+std::string PositionTableName(int port)
+{
+    return "HedgeEdge.Positions." + std::to_string(port);
+}
+
+// ============================================================================
+// PositionTableWriter
+// ============================================================================
+
+bool PositionTableWriter::Create(const std::string& name, uint32_t capacity)
+{
+    Close();
+
+    size_t size = sizeof(PositionTableHeader) + static_cast<size_t>(capacity) * sizeof(PositionRecord);
+    bool created = false;
+    if (!m_segment.Create(name, size, &created)) return false;
+
+    // A section reused from a previous writer keeps its size on Windows
+    size_t available = (m_segment.Size() - sizeof(PositionTableHeader)) / sizeof(PositionRecord);
+    if (available < capacity) capacity = static_cast<uint32_t>(available);
+    if (capacity == 0)
+    {
+        m_segment.Close(true);
+        return false;
+    }
+
+    m_header = static_cast<PositionTableHeader*>(m_segment.Data());
+    if (created)
+    {
+        new (m_header) PositionTableHeader();
+    }
+
+    // Invalidate attached readers, then publish an empty table. A writer that
+    // died mid-write leaves seq odd; realign it so BeginWrite() makes it odd.
+    m_header->writerAlive.store(0, std::memory_order_release);
+    m_header->seq.store(m_header->seq.load(std::memory_order_relaxed) & ~1ull, std::memory_order_relaxed);
+    uint64_t generation = created ? 0 : m_header->generation;
+    BeginWrite();
+    m_header->magic = POSITION_TABLE_MAGIC;
+    m_header->version = POSITION_TABLE_VERSION;
+    m_header->capacity = capacity;
+    m_header->recordSize = sizeof(PositionRecord);
+    m_header->generation = std::max(WallMicros(), generation + 1);
+    m_header->writerPid = CurrentProcessId();
+    m_header->count = 0;
+    m_header->mapVersion = 0;
+    EndWrite();
+    m_header->writerAlive.store(1, std::memory_order_release);
+
+    m_records = Records(m_header);
+    m_index.clear();
+    m_index.reserve(capacity);
+    return true;
+}
+
+void PositionTableWriter::Close()
+{
+    if (!m_header) return;
+
+    m_header->writerAlive.store(0, std::memory_order_release);
+    m_segment.Close(true);
+    m_header = nullptr;
+    m_records = nullptr;
+    m_index.clear();
+}
+
+void PositionTableWriter::BeginWrite()
+{
+    uint64_t seq = m_header->seq.load(std::memory_order_relaxed);
+    m_header->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void PositionTableWriter::EndWrite()
+{
+    m_header->mapVersion++;
+    m_header->updatedUs = WallMicros();
+    uint64_t seq = m_header->seq.load(std::memory_order_relaxed);
+    m_header->seq.store(seq + 1, std::memory_order_release);
+}
+
+bool PositionTableWriter::Upsert(const PositionRecord& record)
+{
+    if (!m_header) return false;
+
+    auto it = m_index.find(record.ticket);
+    uint32_t slot;
+    if (it != m_index.end())
+    {
+        slot = it->second;
+    }
+    else
+    {
+        if (m_header->count >= m_header->capacity) return false;
+        slot = m_header->count;
+    }
+
+    BeginWrite();
+    m_records[slot] = record;
+    m_records[slot].symbol[POSITION_SYMBOL_LEN - 1] = '\0';
+    if (it == m_index.end())
+    {
+        m_header->count++;
+        m_index[record.ticket] = slot;
+    }
+    EndWrite();
+    return true;
+}
+
+bool PositionTableWriter::Remove(uint64_t ticket)
+{
+    if (!m_header) return false;
+
+    auto it = m_index.find(ticket);
+    if (it == m_index.end()) return false;
+
+    uint32_t slot = it->second;
+    uint32_t last = m_header->count - 1;
+
+    // Keep the table dense: move the last record into the hole
+    BeginWrite();
+    if (slot != last)
+    {
+        m_records[slot] = m_records[last];
+        m_index[m_records[slot].ticket] = slot;
+    }
+    m_header->count--;
+    EndWrite();
+
+    m_index.erase(it);
+    return true;
+}
+
+void PositionTableWriter::Clear()
+{
+    if (!m_header) return;
+
+    BeginWrite();
+    m_header->count = 0;
+    EndWrite();
+    m_index.clear();
+}
+
+// ============================================================================
+// PositionTableReader
+// ============================================================================
+
+bool PositionTableReader::Attach(const std::string& name)
+{
+    Close();
+
+    if (!m_segment.Open(name)) return false;
+    if (m_segment.Size() < sizeof(PositionTableHeader))
+    {
+        m_segment.Close();
+        return false;
+    }
+
+    m_header = static_cast<PositionTableHeader*>(m_segment.Data());
+    if (m_header->magic != POSITION_TABLE_MAGIC ||
+        m_header->version != POSITION_TABLE_VERSION ||
+        m_header->recordSize != sizeof(PositionRecord) ||
+        m_header->writerAlive.load(std::memory_order_acquire) == 0 ||
+        sizeof(PositionTableHeader) + static_cast<size_t>(m_header->capacity) * sizeof(PositionRecord) > m_segment.Size())
+    {
+        m_header = nullptr;
+        m_segment.Close();
+        return false;
+    }
+
+    m_records = Records(m_header);
+    m_capacity = m_header->capacity;
+    m_generation = m_header->generation;
+    return true;
+}
+
+void PositionTableReader::Close()
+{
+    if (!m_header) return;
+
+    m_segment.Close();
+    m_header = nullptr;
+    m_records = nullptr;
+}
+
+bool PositionTableReader::WriterAlive() const
+{
+    return m_header &&
+           m_header->writerAlive.load(std::memory_order_acquire) != 0 &&
+           m_header->generation == m_generation &&
+           IsProcessAlive(m_header->writerPid);
+}
+
+bool PositionTableReader::Snapshot(std::vector<PositionRecord>& out, uint64_t* mapVersion)
+{
+    if (!m_header || m_header->generation != m_generation) return false;
+
+    for (int attempt = 0; attempt < SNAPSHOT_RETRIES; attempt++)
+    {
+        uint64_t before = m_header->seq.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        uint32_t count = std::min(m_header->count, m_capacity);
+        uint64_t version = m_header->mapVersion;
+        out.resize(count);
+        if (count) std::memcpy(out.data(), m_records, count * sizeof(PositionRecord));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_header->seq.load(std::memory_order_relaxed) == before)
+        {
+            if (mapVersion) *mapVersion = version;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    struct TableHandle
+    {
+        std::unique_ptr<hedgeedge::PositionTableWriter> writer;
+        std::unique_ptr<hedgeedge::PositionTableReader> reader;
+        std::vector<hedgeedge::PositionRecord>          snapshot;
+        uint64_t                                        snapshotVersion = 0;
+    };
+
+    hedgeedge::HandleTable<TableHandle> g_tables;
+
+    const int MIN_CAPACITY = 64;
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall PositionTableCreate(int port, int capacity)
+{
+    if (port <= 0) return -5;
+    if (capacity < MIN_CAPACITY) capacity = MIN_CAPACITY;
+
+    auto table = std::make_shared<TableHandle>();
+    table->writer.reset(new hedgeedge::PositionTableWriter());
+    if (!table->writer->Create(hedgeedge::PositionTableName(port), static_cast<uint32_t>(capacity)))
+    {
+        return -1;
+    }
+    return g_tables.Add(std::move(table));
+}
+
+HEDGEEDGE_API int __stdcall PositionTableUpsert(int handle, long long ticket, const char* symbol,
+                                                int type, double volume, double entryPrice,
+                                                double stopLoss, double takeProfit,
+                                                long long openTime)
+{
+    auto table = g_tables.Get(handle);
+    if (!table || !table->writer) return -1;
+    if (ticket <= 0 || !symbol) return -5;
+
+    hedgeedge::PositionRecord record = {};
+    record.ticket = static_cast<uint64_t>(ticket);
+    record.openTime = openTime;
+    record.volume = volume;
+    record.entryPrice = entryPrice;
+    record.stopLoss = stopLoss;
+    record.takeProfit = takeProfit;
+    record.type = type;
+    std::strncpy(record.symbol, symbol, hedgeedge::POSITION_SYMBOL_LEN - 1);
+
+    return table->writer->Upsert(record) ? 0 : -4;
+}
+
+HEDGEEDGE_API int __stdcall PositionTableRemove(int handle, long long ticket)
+{
+    auto table = g_tables.Get(handle);
+    if (!table || !table->writer) return -1;
+    return table->writer->Remove(static_cast<uint64_t>(ticket)) ? 0 : -4;
+}
+
+HEDGEEDGE_API void __stdcall PositionTableClear(int handle)
+{
+    auto table = g_tables.Get(handle);
+    if (table && table->writer) table->writer->Clear();
+}
+
+HEDGEEDGE_API int __stdcall PositionTableCount(int handle)
+{
+    auto table = g_tables.Get(handle);
+    if (!table || !table->writer) return -1;
+    return static_cast<int>(table->writer->Count());
+}
+
+HEDGEEDGE_API int __stdcall PositionTableAttach(int port)
+{
+    if (port <= 0) return -5;
+
+    auto table = std::make_shared<TableHandle>();
+    table->reader.reset(new hedgeedge::PositionTableReader());
+    if (!table->reader->Attach(hedgeedge::PositionTableName(port)))
+    {
+        return -1;
+    }
+    return g_tables.Add(std::move(table));
+}
+
+HEDGEEDGE_API int __stdcall PositionTableSnapshot(int handle)
+{
+    auto table = g_tables.Get(handle);
+    if (!table || !table->reader) return -1;
+    if (!table->reader->Snapshot(table->snapshot, &table->snapshotVersion)) return -1;
+    return static_cast<int>(table->snapshot.size());
+}
+
+HEDGEEDGE_API int __stdcall PositionTableGetEntry(int handle, int index, long long* ticket,
+                                                  char* symbolOut, int symbolLen, int* type,
+                                                  double* volume, double* entryPrice,
+                                                  double* stopLoss, double* takeProfit)
+{
+    auto table = g_tables.Get(handle);
+    if (!table || !table->reader) return -1;
+    if (index < 0 || index >= static_cast<int>(table->snapshot.size())) return -5;
+
+    const hedgeedge::PositionRecord& record = table->snapshot[static_cast<size_t>(index)];
+    if (ticket) *ticket = static_cast<long long>(record.ticket);
+    if (symbolOut && symbolLen > 0)
+    {
+        std::strncpy(symbolOut, record.symbol, static_cast<size_t>(symbolLen) - 1);
+        symbolOut[symbolLen - 1] = '\0';
+    }
+    if (type) *type = record.type;
+    if (volume) *volume = record.volume;
+    if (entryPrice) *entryPrice = record.entryPrice;
+    if (stopLoss) *stopLoss = record.stopLoss;
+    if (takeProfit) *takeProfit = record.takeProfit;
+    return 0;
+}
+
+HEDGEEDGE_API long long __stdcall PositionTableVersion(int handle)
+{
+    auto table = g_tables.Get(handle);
+    if (!table || !table->reader) return -1;
+    return static_cast<long long>(table->snapshotVersion);
+}
+
+HEDGEEDGE_API int __stdcall PositionTableWriterAlive(int handle)
+{
+    auto table = g_tables.Get(handle);
+    if (!table || !table->reader) return 0;
+    return table->reader->WriterAlive() ? 1 : 0;
+}
+
+HEDGEEDGE_API void __stdcall PositionTableClose(int handle)
+{
+    g_tables.Remove(handle);
+}
+
+} // extern "C"
@@ -0,0 +1,238 @@
+// ============================================================================
+// Hedge Edge Shared Position Table
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Fixed-capacity table of the master's open positions in shared memory,
+// maintained incrementally by HE_Prop and protected by a single seqlock.
+// Same-host readers copy a consistent snapshot without any serialization,
+// so reconciliation becomes a record comparison instead of a JSON parse.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_POSITION_TABLE_H
+#define HEDGE_EDGE_POSITION_TABLE_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "HedgeEdgeShm.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Table Layout
+// ============================================================================
+
+constexpr uint32_t POSITION_TABLE_MAGIC   = 0x48455054; // "HEPT"
+constexpr uint32_t POSITION_TABLE_VERSION = 1;
+constexpr size_t   POSITION_SYMBOL_LEN    = 32;
+
+struct PositionRecord
+{
+    uint64_t ticket;
+    int64_t  openTime;                      // Server time (seconds)
+    double   volume;                        // Lots
+    double   entryPrice;
+    double   stopLoss;                      // 0 = none
+    double   takeProfit;                    // 0 = none
+    int32_t  type;                          // POSITION_TYPE_BUY (0) / SELL (1)
+    uint32_t reserved;
+    char     symbol[POSITION_SYMBOL_LEN];   // Null-terminated
+};
+
+struct alignas(64) PositionTableHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t capacity;                      // Records
+    uint32_t recordSize;                    // sizeof(PositionRecord) of the writer
+    uint64_t generation;                    // Changes every time a writer (re)creates the table
+    uint32_t writerPid;
+    std::atomic<uint32_t> writerAlive;
+
+    alignas(64) std::atomic<uint64_t> seq;  // Seqlock: odd while the writer is mutating
+    uint32_t count;
+    uint32_t reserved;
+    uint64_t mapVersion;                    // Bumped by every mutation
+    uint64_t updatedUs;                     // WallMicros() of the last mutation
+};
+
+// Segment name for a master data port
+std::string PositionTableName(int port);
+
+// ============================================================================
+// Table Writer (HE_Prop)
+// ============================================================================
+
+class PositionTableWriter
+{
+public:
+    ~PositionTableWriter() { Close(); }
+
+    bool Create(const std::string& name, uint32_t capacity);
+    void Close();
+
+    // Insert or update by ticket. Returns false if the table is full.
+    bool Upsert(const PositionRecord& record);
+
+    // Remove by ticket. Returns false if the ticket is not in the table.
+    bool Remove(uint64_t ticket);
+
+    // Remove all records (start of a full rebuild)
+    void Clear();
+
+    uint32_t Count() const    { return m_header ? m_header->count : 0; }
+    uint32_t Capacity() const { return m_header ? m_header->capacity : 0; }
+
+private:
+    void BeginWrite();
+    void EndWrite();
+
+    SharedSegment   m_segment;
+    PositionTableHeader* m_header = nullptr;
+    PositionRecord* m_records = nullptr;
+    std::unordered_map<uint64_t, uint32_t> m_index;  // ticket -> slot
+};
+
+// ============================================================================
+// Table Reader (HE_Hedge, tools)
+// ============================================================================
+
+class PositionTableReader
+{
+public:
+    ~PositionTableReader() { Close(); }
+
+    bool Attach(const std::string& name);
+    void Close();
+
+    // Copy a consistent snapshot. Returns false if detached or the writer
+    // kept the seqlock busy for every retry.
+    bool Snapshot(std::vector<PositionRecord>& out, uint64_t* mapVersion = nullptr);
+
+    bool WriterAlive() const;
+
+private:
+    SharedSegment        m_segment;
+    PositionTableHeader* m_header = nullptr;
+    const PositionRecord* m_records = nullptr;
+    uint32_t             m_capacity = 0;
+    uint64_t             m_generation = 0;
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Writer (Master EA)
+// ============================================================================
+
+/**
+ * Create the shared position table for a master data port.
+ *
+ * @param port      Master PUB port (table is named after it)
+ * @param capacity  Maximum number of open positions (min 64)
+ *
+ * @return Handle (>0) on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall PositionTableCreate(int port, int capacity);
+
+/**
+ * Insert or update one position.
+ *
+ * @param handle      Writer handle from PositionTableCreate
+ * @param ticket      Position ticket
+ * @param symbol      Symbol (UTF-8, null-terminated, truncated to 31 bytes)
+ * @param type        0 = BUY, 1 = SELL
+ * @param volume      Volume in lots
+ * @param entryPrice  Open price
+ * @param stopLoss    Stop loss (0 = none)
+ * @param takeProfit  Take profit (0 = none)
+ * @param openTime    Open time (server seconds)
+ *
+ * @return 0 on success, -1 if not open, -4 if the table is full
+ */
+HEDGEEDGE_API int __stdcall PositionTableUpsert(int handle, long long ticket, const char* symbol,
+                                                int type, double volume, double entryPrice,
+                                                double stopLoss, double takeProfit,
+                                                long long openTime);
+
+/**
+ * Remove one position.
+ *
+ * @return 0 on success, -1 if not open, -4 if the ticket was not present
+ */
+HEDGEEDGE_API int __stdcall PositionTableRemove(int handle, long long ticket);
+
+/**
+ * Remove all positions (before a full rebuild).
+ */
+HEDGEEDGE_API void __stdcall PositionTableClear(int handle);
+
+/**
+ * Number of positions currently in a writer's table.
+ */
+HEDGEEDGE_API int __stdcall PositionTableCount(int handle);
+
+// ============================================================================
+// Reader (Slave EA)
+// ============================================================================
+
+/**
+ * Attach to the position table of a master on the same host.
+ *
+ * @return Handle (>0) on success, -1 if no table exists for that port
+ */
+HEDGEEDGE_API int __stdcall PositionTableAttach(int port);
+
+/**
+ * Take a consistent snapshot into the handle's local buffer.
+ *
+ * @return Number of positions (>=0), -1 if detached or the writer is gone
+ */
+HEDGEEDGE_API int __stdcall PositionTableSnapshot(int handle);
+
+/**
+ * Read one entry of the last snapshot.
+ *
+ * @param index       0 .. PositionTableSnapshot()-1
+ * @param symbolOut   Buffer for the symbol (UTF-8, null-terminated)
+ * @param symbolLen   Size of the symbol buffer
+ *
+ * @return 0 on success, -5 if the index is out of range
+ */
+HEDGEEDGE_API int __stdcall PositionTableGetEntry(int handle, int index, long long* ticket,
+                                                  char* symbolOut, int symbolLen, int* type,
+                                                  double* volume, double* entryPrice,
+                                                  double* stopLoss, double* takeProfit);
+
+/**
+ * Mutation counter of the last snapshot (unchanged version = unchanged table).
+ */
+HEDGEEDGE_API long long __stdcall PositionTableVersion(int handle);
+
+/**
+ * Check whether the table's writer is alive and has not restarted.
+ *
+ * @return 1 if alive, 0 otherwise
+ */
+HEDGEEDGE_API int __stdcall PositionTableWriterAlive(int handle);
+
+/**
+ * Close a writer or reader handle.
+ */
+HEDGEEDGE_API void __stdcall PositionTableClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_POSITION_TABLE_H
@@ -0,0 +1,188 @@
+// ============================================================================
+// Hedge Edge Stream Recording
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <cstring>
+
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeRecording.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const size_t FLUSH_BYTES = 64 * 1024;
+
+    void AppendVarint(std::string& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    bool ReadVarint(const std::string& data, size_t& position, uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (position >= data.size()) return false;
+            uint8_t byte = static_cast<uint8_t>(data[position++]);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+
+} // namespace
+
+// ============================================================================
+// RecordingWriter
+// ============================================================================
+
+bool RecordingWriter::Open(const std::string& path, uint64_t startWallUs)
+{
+    Close();
+    m_file = OpenFileStream(path, true);
+    if (!m_file) return false;
+
+    RecordingHeader header = {};
+    header.magic = RECORDING_MAGIC;
+    header.version = RECORDING_VERSION;
+    header.startWallUs = startWallUs;
+    m_buffer.assign(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_topics.clear();
+    m_lastUs = 0;
+    m_frames = 0;
+    m_bytes = sizeof(header);
+    return Flush();
+}
+
+bool RecordingWriter::Append(uint64_t offsetUs, std::string_view topic, std::string_view payload)
+{
+    if (!m_file) return false;
+
+    size_t before = m_buffer.size();
+    AppendVarint(m_buffer, offsetUs > m_lastUs ? offsetUs - m_lastUs : 0);
+    if (offsetUs > m_lastUs) m_lastUs = offsetUs;
+
+    auto known = m_topics.find(topic);
+    if (known != m_topics.end())
+    {
+        AppendVarint(m_buffer, known->second << 1);
+    }
+    else
+    {
+        uint64_t id = m_topics.size();
+        m_topics.emplace(std::string(topic), id);
+        AppendVarint(m_buffer, (id << 1) | 1);
+        AppendVarint(m_buffer, topic.size());
+        m_buffer.append(topic.data(), topic.size());
+    }
+
+    AppendVarint(m_buffer, payload.size());
+    m_buffer.append(payload.data(), payload.size());
+
+    m_frames++;
+    m_bytes += m_buffer.size() - before;
+    return m_buffer.size() < FLUSH_BYTES || Flush();
+}
+
+bool RecordingWriter::Flush()
+{
+    if (!m_file) return false;
+    bool ok = m_buffer.empty() || std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) == m_buffer.size();
+    m_buffer.clear();
+    return std::fflush(m_file) == 0 && ok;
+}
+
+void RecordingWriter::Close()
+{
+    if (!m_file) return;
+    Flush();
+    std::fclose(m_file);
+    m_file = nullptr;
+}
+
+// ============================================================================
+// RecordingReader
+// ============================================================================
+
+bool RecordingReader::Open(const std::string& path)
+{
+    m_data.clear();
+    if (!ReadFileBytes(path, m_data) || m_data.size() < sizeof(RecordingHeader)) return false;
+
+    RecordingHeader header;
+    std::memcpy(&header, m_data.data(), sizeof(header));
+    if (header.magic != RECORDING_MAGIC || header.version != RECORDING_VERSION) return false;
+
+    m_startWallUs = header.startWallUs;
+    Rewind();
+    return true;
+}
+
+void RecordingReader::Rewind()
+{
+    m_position = sizeof(RecordingHeader);
+    m_offsetUs = 0;
+    m_truncated = false;
+    m_topics.clear();
+}
+
+bool RecordingReader::Next(RecordedFrame& frame)
+{
+    if (m_position >= m_data.size()) return false;
+
+    size_t position = m_position;
+    uint64_t delta = 0;
+    uint64_t reference = 0;
+    if (!ReadVarint(m_data, position, delta) || !ReadVarint(m_data, position, reference))
+    {
+        m_truncated = true;
+        return false;
+    }
+
+    uint64_t id = reference >> 1;
+    if (reference & 1)
+    {
+        uint64_t length = 0;
+        if (id != m_topics.size() || !ReadVarint(m_data, position, length) ||
+            length > m_data.size() - position)
+        {
+            m_truncated = true;
+            return false;
+        }
+        m_topics.emplace_back(m_data.data() + position, static_cast<size_t>(length));
+        position += static_cast<size_t>(length);
+    }
+    else if (id >= m_topics.size())
+    {
+        m_truncated = true;
+        return false;
+    }
+
+    uint64_t length = 0;
+    if (!ReadVarint(m_data, position, length) || length > m_data.size() - position)
+    {
+        m_truncated = true;
+        return false;
+    }
+
+    m_offsetUs += delta;
+    frame.offsetUs = m_offsetUs;
+    frame.topic = m_topics[static_cast<size_t>(id)];
+    frame.payload = std::string_view(m_data.data() + position, static_cast<size_t>(length));
+    m_position = position + static_cast<size_t>(length);
+    return true;
+}
+
+} // namespace hedgeedge
@@ -0,0 +1,108 @@
+// ============================================================================
+// Hedge Edge Stream Recording
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Compact file of a master stream exactly as it arrived: every frame's topic
+// (with its .Z / .B variant suffix) and payload bytes, stamped with the
+// receive time. Replaying a recording reproduces a production burst against
+// the decoder and the copy logic byte for byte.
+//
+// Layout ("<name>.herec"):
+//   header   "HERC", version, startWallUs (16 bytes)
+//   record   varint  receive time, microseconds since the previous record
+//            varint  topic reference: (id << 1) | 1 + varint length + bytes
+//                    for a topic seen the first time, (id << 1) otherwise
+//            varint  payload length, payload bytes
+//
+// Records are appended through a buffered stream; a recording cut short by
+// a crash reads up to its last complete record.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_RECORDING_H
+#define HEDGE_EDGE_RECORDING_H
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hedgeedge {
+
+constexpr uint32_t RECORDING_MAGIC   = 0x43524548; // "HERC"
+constexpr uint32_t RECORDING_VERSION = 1;
+
+struct RecordingHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t startWallUs;                   // WallMicros() of the first record's time base
+};
+
+struct RecordedFrame
+{
+    uint64_t         offsetUs = 0;          // Receive time since the start of the recording
+    std::string_view topic;                 // Wire topic, e.g. "EVENT.Z"
+    std::string_view payload;
+};
+
+class RecordingWriter
+{
+public:
+    ~RecordingWriter() { Close(); }
+
+    // Create (truncate) the file; `startWallUs` anchors the offsets
+    bool Open(const std::string& path, uint64_t startWallUs);
+
+    // Append one frame received `offsetUs` after the start (non-decreasing)
+    bool Append(uint64_t offsetUs, std::string_view topic, std::string_view payload);
+
+    bool Flush();
+    void Close();
+
+    uint64_t Frames() const { return m_frames; }
+    uint64_t Bytes() const  { return m_bytes; }
+
+private:
+    std::FILE*  m_file = nullptr;
+    std::map<std::string, uint64_t, std::less<>> m_topics;
+    std::string m_buffer;
+    uint64_t    m_lastUs = 0;
+    uint64_t    m_frames = 0;
+    uint64_t    m_bytes = 0;
+};
+
+class RecordingReader
+{
+public:
+    // Load a whole recording. Returns false if it is not a recording.
+    bool Open(const std::string& path);
+
+    // Next frame (views stay valid while the reader lives); false at the end
+    // or at a truncated record
+    bool Next(RecordedFrame& frame);
+
+    // Back to the first frame
+    void Rewind();
+
+    uint64_t StartWallUs() const { return m_startWallUs; }
+    bool     Truncated() const   { return m_truncated; }
+
+private:
+    std::string m_data;
+    size_t      m_position = 0;
+    uint64_t    m_startWallUs = 0;
+    uint64_t    m_offsetUs = 0;
+    bool        m_truncated = false;
+    std::vector<std::string_view> m_topics;
+};
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_RECORDING_H
@@ -0,0 +1,658 @@
+// ============================================================================
+// Hedge Edge Agent Registry
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Entry protocol (one owner per entry, any number of readers):
+//   claim   FREE -> CLAIMED by CAS (or LIVE -> CLAIMED if the owner died),
+//           then pid by CAS from the value seen; a CLAIMED entry whose pid
+//           has exited is taken over by the pid CAS alone
+//   write   seq odd, copy fields, seq even (release)
+//   publish state = LIVE, generation++, wake watchers
+// A reader's copy is valid if the entry's seq was even and unchanged across
+// the copy. Readers also skip entries whose owning process has exited, so a
+// crashed terminal disappears even before a watcher reaps its entry.
+// ============================================================================
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <climits>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeRegistry.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const char* const REGISTRY_NAME = "HedgeEdge.Registry";
+    const int READ_RETRIES = 64;
+    const int INIT_WAIT_MS = 1000;
+    const int KEY_LOCK_WAIT_MS = 1000;      // SetLicenseKey gives up after this
+    const uint64_t KEY_STALE_US = 100000;   // An odd keySeq this old belongs to a dead writer
+
+#ifdef _WIN32
+    std::wstring WatcherEventName(int slot)
+    {
+        std::string name = SharedObjectName(REGISTRY_NAME) + ".w" + std::to_string(slot);
+        return std::wstring(name.begin(), name.end());
+    }
+#else
+    long Futex(std::atomic<uint32_t>* word, int op, uint32_t value, const timespec* timeout)
+    {
+        // Non-private futex: the word lives in memory shared between processes
+        return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), op, value, timeout, nullptr, 0);
+    }
+#endif
+
+    RegistryEntry* Entries(RegistryHeader* header)
+    {
+        return reinterpret_cast<RegistryEntry*>(reinterpret_cast<char*>(header) + sizeof(RegistryHeader));
+    }
+
+    // Truncating copy into a fixed, null-terminated field
+    template <size_t N>
+    void CopyField(char (&field)[N], const std::string& value)
+    {
+        size_t length = value.size() < N - 1 ? value.size() : N - 1;
+        std::memcpy(field, value.data(), length);
+        std::memset(field + length, 0, N - length);
+    }
+
+    template <size_t N>
+    std::string ReadField(const char (&field)[N])
+    {
+        size_t length = 0;
+        while (length < N && field[length]) length++;
+        return std::string(field, length);
+    }
+
+    std::string EscapeJson(const std::string& text)
+    {
+        std::string out;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\') out += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20) out += c;
+        }
+        return out;
+    }
+
+} // namespace
+
+// ============================================================================
+// AgentRegistry
+// ============================================================================
+
+bool AgentRegistry::Open()
+{
+    if (m_header) return true;
+
+    size_t size = sizeof(RegistryHeader) + REGISTRY_MAX_AGENTS * sizeof(RegistryEntry);
+    if (!m_segment.Create(REGISTRY_NAME, size)) return false;
+    if (m_segment.Size() < size)
+    {
+        m_segment.Close();
+        return false;
+    }
+
+    // New segments are zero-filled: the first process to flip initState
+    // writes the header, everyone else waits for it
+    RegistryHeader* header = static_cast<RegistryHeader*>(m_segment.Data());
+    uint32_t blank = 0;
+    if (header->initState.compare_exchange_strong(blank, 1, std::memory_order_acq_rel))
+    {
+        header->magic = REGISTRY_MAGIC;
+        header->version = REGISTRY_VERSION;
+        header->capacity = REGISTRY_MAX_AGENTS;
+        header->entrySize = sizeof(RegistryEntry);
+        header->initState.store(2, std::memory_order_release);
+    }
+    else
+    {
+        uint64_t deadline = NowMicros() + static_cast<uint64_t>(INIT_WAIT_MS) * 1000;
+        while (header->initState.load(std::memory_order_acquire) != 2 && NowMicros() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if (header->initState.load(std::memory_order_acquire) != 2 ||
+        header->magic != REGISTRY_MAGIC ||
+        header->version != REGISTRY_VERSION ||
+        header->entrySize != sizeof(RegistryEntry) ||
+        header->capacity > REGISTRY_MAX_AGENTS)
+    {
+        m_segment.Close();
+        return false;
+    }
+
+    m_header = header;
+    m_entries = Entries(header);
+    return true;
+}
+
+void AgentRegistry::Close()
+{
+    if (!m_header) return;
+
+#ifdef _WIN32
+    if (m_watcherSlot >= 0)
+    {
+        m_header->watcherPid[m_watcherSlot].store(0, std::memory_order_relaxed);
+        m_header->watcherMask.fetch_and(~(1u << m_watcherSlot));
+        m_watcherSlot = -1;
+    }
+    if (m_watcherEvent)
+    {
+        CloseHandle(m_watcherEvent);
+        m_watcherEvent = nullptr;
+    }
+    for (void*& event : m_watcherEvents)
+    {
+        if (event) CloseHandle(event);
+        event = nullptr;
+    }
+#endif
+
+    // The segment is shared by every agent: never remove the name
+    m_segment.Close();
+    m_header = nullptr;
+    m_entries = nullptr;
+}
+
+void AgentRegistry::WriteEntry(RegistryEntry& entry, const AgentInfo& info)
+{
+    uint64_t seq = entry.seq.load(std::memory_order_relaxed);
+    entry.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    CopyField(entry.role, info.role);
+    CopyField(entry.status, info.status);
+    CopyField(entry.broker, info.broker);
+    CopyField(entry.server, info.server);
+    CopyField(entry.publicKey, info.publicKey);
+    CopyField(entry.details, info.details);
+    entry.login = info.login;
+    entry.dataPort = info.dataPort;
+    entry.commandPort = info.commandPort;
+    entry.version++;
+    entry.updatedUs = WallMicros();
+
+    entry.seq.store(seq + 2, std::memory_order_release);
+}
+
+void AgentRegistry::Changed()
+{
+    m_header->generation.fetch_add(1, std::memory_order_seq_cst);
+
+#ifdef _WIN32
+    uint32_t mask = m_header->watcherMask.load(std::memory_order_seq_cst);
+    for (uint32_t slot = 0; mask != 0; ++slot, mask >>= 1)
+    {
+        if (!(mask & 1u)) continue;
+        if (!m_watcherEvents[slot])
+        {
+            m_watcherEvents[slot] = OpenEventW(EVENT_MODIFY_STATE, FALSE,
+                                               WatcherEventName(static_cast<int>(slot)).c_str());
+        }
+        if (m_watcherEvents[slot]) SetEvent(m_watcherEvents[slot]);
+    }
+#else
+    m_header->wakeWord.fetch_add(1, std::memory_order_seq_cst);
+    if (m_header->waiters.load(std::memory_order_seq_cst) > 0)
+    {
+        Futex(&m_header->wakeWord, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+#endif
+}
+
+int AgentRegistry::Register(const AgentInfo& info)
+{
+    if (!m_header) return -1;
+
+    uint32_t pid = CurrentProcessId();
+    for (uint32_t slot = 0; slot < m_header->capacity; slot++)
+    {
+        RegistryEntry& entry = m_entries[slot];
+        uint32_t state = entry.state.load(std::memory_order_acquire);
+        uint32_t owner = entry.pid.load(std::memory_order_acquire);
+
+        // Live and claimed entries are only taken over once their process has
+        // exited; a claimed one is already CLAIMED, so the pid CAS decides
+        if (state != REGISTRY_FREE && IsProcessAlive(owner)) continue;
+        if (state == REGISTRY_FREE || state == REGISTRY_LIVE)
+        {
+            if (!entry.state.compare_exchange_strong(state, REGISTRY_CLAIMED, std::memory_order_acq_rel)) continue;
+        }
+        else if (state != REGISTRY_CLAIMED)
+        {
+            continue;
+        }
+        if (!entry.pid.compare_exchange_strong(owner, pid, std::memory_order_acq_rel)) continue;
+
+        // An owner that died mid-write left seq odd
+        entry.seq.store(entry.seq.load(std::memory_order_relaxed) & ~1ull, std::memory_order_relaxed);
+        entry.version = 0;
+        entry.registeredUs = WallMicros();
+        WriteEntry(entry, info);
+        entry.state.store(REGISTRY_LIVE, std::memory_order_release);
+        Changed();
+        return static_cast<int>(slot);
+    }
+    return -1;
+}
+
+bool AgentRegistry::Update(int slot, const std::string& status, const std::string& details)
+{
+    if (!m_header || slot < 0 || slot >= static_cast<int>(m_header->capacity)) return false;
+
+    RegistryEntry& entry = m_entries[slot];
+    if (entry.state.load(std::memory_order_acquire) != REGISTRY_LIVE ||
+        entry.pid.load(std::memory_order_relaxed) != CurrentProcessId())
+    {
+        return false;
+    }
+
+    // Only the owner writes, so its own fields can be read without the seqlock
+    AgentInfo info;
+    info.role = ReadField(entry.role);
+    info.status = status.empty() ? ReadField(entry.status) : status;
+    info.broker = ReadField(entry.broker);
+    info.server = ReadField(entry.server);
+    info.publicKey = ReadField(entry.publicKey);
+    info.details = details.empty() ? ReadField(entry.details) : details;
+    info.login = entry.login;
+    info.dataPort = entry.dataPort;
+    info.commandPort = entry.commandPort;
+
+    WriteEntry(entry, info);
+    Changed();
+    return true;
+}
+
+void AgentRegistry::Unregister(int slot)
+{
+    if (!m_header || slot < 0 || slot >= static_cast<int>(m_header->capacity)) return;
+
+    RegistryEntry& entry = m_entries[slot];
+    uint32_t live = REGISTRY_LIVE;
+    if (entry.pid.load(std::memory_order_relaxed) != CurrentProcessId()) return;
+    if (entry.state.compare_exchange_strong(live, REGISTRY_FREE, std::memory_order_acq_rel))
+    {
+        Changed();
+    }
+}
+
+void AgentRegistry::List(std::vector<AgentInfo>& out) const
+{
+    out.clear();
+    if (!m_header) return;
+
+    for (uint32_t slot = 0; slot < m_header->capacity; slot++)
+    {
+        const RegistryEntry& entry = m_entries[slot];
+        for (int attempt = 0; attempt < READ_RETRIES; attempt++)
+        {
+            if (entry.state.load(std::memory_order_acquire) != REGISTRY_LIVE) break;
+
+            uint64_t before = entry.seq.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            AgentInfo info;
+            info.role = ReadField(entry.role);
+            info.status = ReadField(entry.status);
+            info.broker = ReadField(entry.broker);
+            info.server = ReadField(entry.server);
+            info.publicKey = ReadField(entry.publicKey);
+            info.details = ReadField(entry.details);
+            info.login = entry.login;
+            info.dataPort = entry.dataPort;
+            info.commandPort = entry.commandPort;
+            info.pid = entry.pid.load(std::memory_order_relaxed);
+            info.version = entry.version;
+            info.registeredUs = entry.registeredUs;
+            info.updatedUs = entry.updatedUs;
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry.seq.load(std::memory_order_relaxed) != before) continue;
+            if (entry.state.load(std::memory_order_acquire) != REGISTRY_LIVE) break;
+
+            if (IsProcessAlive(info.pid)) out.push_back(std::move(info));
+            break;
+        }
+    }
+}
+
+uint64_t AgentRegistry::Generation() const
+{
+    return m_header ? m_header->generation.load(std::memory_order_acquire) : 0;
+}
+
+uint64_t AgentRegistry::Wait(uint64_t seen, int timeoutMs)
+{
+    if (!m_header) return 0;
+
+    uint64_t deadline = NowMicros() + static_cast<uint64_t>(timeoutMs > 0 ? timeoutMs : 0) * 1000;
+    for (;;)
+    {
+        uint64_t generation = m_header->generation.load(std::memory_order_seq_cst);
+        uint64_t now = NowMicros();
+        if (generation != seen || now >= deadline) return generation;
+        int remainingMs = static_cast<int>((deadline - now + 999) / 1000);
+
+#ifdef _WIN32
+        if (m_watcherSlot < 0)
+        {
+            // Claim a wake-up slot, reclaiming slots of watchers that died.
+            // The pid CAS from the value seen decides between two claimants.
+            uint32_t pid = CurrentProcessId();
+            for (int slot = 0; slot < static_cast<int>(REGISTRY_MAX_WATCHERS) && m_watcherSlot < 0; ++slot)
+            {
+                uint32_t bit = 1u << slot;
+                uint32_t mask = m_header->watcherMask.load(std::memory_order_acquire);
+                uint32_t owner = m_header->watcherPid[slot].load(std::memory_order_acquire);
+                if ((mask & bit) && IsProcessAlive(owner)) continue;
+                if (!(mask & bit) && !m_header->watcherMask.compare_exchange_strong(mask, mask | bit)) continue;
+                if (m_header->watcherPid[slot].compare_exchange_strong(owner, pid, std::memory_order_acq_rel))
+                {
+                    m_watcherSlot = slot;
+                }
+            }
+            if (m_watcherSlot >= 0)
+            {
+                m_watcherEvent = CreateEventW(nullptr, FALSE, FALSE, WatcherEventName(m_watcherSlot).c_str());
+            }
+        }
+        if (!m_watcherEvent)
+        {
+            Sleep(static_cast<DWORD>(remainingMs > 10 ? 10 : remainingMs));
+            continue;
+        }
+        // Auto-reset event: a change signalled before this wait is not lost
+        if (m_header->generation.load(std::memory_order_seq_cst) == seen)
+        {
+            WaitForSingleObject(m_watcherEvent, static_cast<DWORD>(remainingMs));
+        }
+#else
+        uint32_t word = m_header->wakeWord.load(std::memory_order_seq_cst);
+        m_header->waiters.fetch_add(1, std::memory_order_seq_cst);
+        if (m_header->generation.load(std::memory_order_seq_cst) == seen)
+        {
+            timespec timeout = {};
+            timeout.tv_sec = remainingMs / 1000;
+            timeout.tv_nsec = static_cast<long>(remainingMs % 1000) * 1000000L;
+            Futex(&m_header->wakeWord, FUTEX_WAIT, word, &timeout);
+        }
+        m_header->waiters.fetch_sub(1, std::memory_order_seq_cst);
+#endif
+    }
+}
+
+int AgentRegistry::Reap()
+{
+    if (!m_header) return 0;
+
+    int reaped = 0;
+    for (uint32_t slot = 0; slot < m_header->capacity; slot++)
+    {
+        RegistryEntry& entry = m_entries[slot];
+        uint32_t live = REGISTRY_LIVE;
+        if (entry.state.load(std::memory_order_acquire) != REGISTRY_LIVE) continue;
+        if (IsProcessAlive(entry.pid.load(std::memory_order_relaxed))) continue;
+        if (entry.state.compare_exchange_strong(live, REGISTRY_FREE, std::memory_order_acq_rel)) reaped++;
+    }
+    if (reaped > 0) Changed();
+    return reaped;
+}
+
+bool AgentRegistry::SetLicenseKey(const std::string& key)
+{
+    if (!m_header || key.size() >= REGISTRY_KEY_LEN) return false;
+
+    // Several processes may publish: take the seqlock by CAS to an odd value.
+    // An odd value that does not move for far longer than the copy takes was
+    // left by a writer that died; it is taken over by CAS to the next odd.
+    uint64_t start = NowMicros();
+    uint64_t seq = m_header->keySeq.load(std::memory_order_relaxed);
+    uint64_t oddSeq = 0;
+    uint64_t oddSinceUs = 0;
+    uint64_t locked = 0;
+    for (;;)
+    {
+        uint64_t now = NowMicros();
+        if (now - start >= static_cast<uint64_t>(KEY_LOCK_WAIT_MS) * 1000) return false;
+
+        if (seq & 1)
+        {
+            if (seq != oddSeq)
+            {
+                oddSeq = seq;
+                oddSinceUs = now;
+            }
+            else if (now - oddSinceUs >= KEY_STALE_US &&
+                     m_header->keySeq.compare_exchange_strong(seq, seq + 2, std::memory_order_acquire))
+            {
+                locked = seq + 2;
+                break;
+            }
+            std::this_thread::yield();
+            seq = m_header->keySeq.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (m_header->keySeq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire))
+        {
+            locked = seq + 1;
+            break;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    CopyField(m_header->licenseKey, key);
+
+    // Released by CAS: if this writer stalled and was taken over, the new
+    // holder owns the seqlock and this write is superseded
+    if (!m_header->keySeq.compare_exchange_strong(locked, locked + 1, std::memory_order_release)) return false;
+
+    Changed();
+    return true;
+}
+
+std::string AgentRegistry::LicenseKey() const
+{
+    if (!m_header) return "";
+
+    for (int attempt = 0; attempt < READ_RETRIES; attempt++)
+    {
+        uint64_t before = m_header->keySeq.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        std::string key = ReadField(m_header->licenseKey);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_header->keySeq.load(std::memory_order_relaxed) == before) return key;
+    }
+    return "";
+}
+
+std::string AgentsJson(const std::vector<AgentInfo>& agents)
+{
+    std::string json = "[";
+    for (size_t i = 0; i < agents.size(); i++)
+    {
+        const AgentInfo& agent = agents[i];
+        if (i) json += ",";
+        json += "{\"role\":\"" + EscapeJson(agent.role) + "\"";
+        json += ",\"login\":" + std::to_string(agent.login);
+        json += ",\"broker\":\"" + EscapeJson(agent.broker) + "\"";
+        json += ",\"server\":\"" + EscapeJson(agent.server) + "\"";
+        json += ",\"dataPort\":" + std::to_string(agent.dataPort);
+        json += ",\"commandPort\":" + std::to_string(agent.commandPort);
+        json += ",\"publicKey\":\"" + EscapeJson(agent.publicKey) + "\"";
+        json += ",\"status\":\"" + EscapeJson(agent.status) + "\"";
+        json += ",\"pid\":" + std::to_string(agent.pid);
+        json += ",\"version\":" + std::to_string(agent.version);
+        json += ",\"registeredUs\":" + std::to_string(agent.registeredUs);
+        json += ",\"updatedUs\":" + std::to_string(agent.updatedUs);
+        // Details are written by the EA as a JSON object
+        bool object = agent.details.size() >= 2 && agent.details.front() == '{' && agent.details.back() == '}';
+        json += ",\"details\":" + (object ? agent.details : std::string("null"));
+        json += "}";
+    }
+    json += "]";
+    return json;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    struct RegistrationHandle
+    {
+        int slot;
+    };
+
+    std::mutex                 g_registryMutex;
+    hedgeedge::AgentRegistry   g_registry;
+    hedgeedge::HandleTable<RegistrationHandle> g_registrations;
+
+    // Opened on first use and kept for the life of the process
+    hedgeedge::AgentRegistry* Registry()
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        return g_registry.Open() ? &g_registry : nullptr;
+    }
+
+    std::string Text(const char* value)
+    {
+        return value ? value : "";
+    }
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall RegistryRegister(const char* role, long long login, const char* broker,
+                                             const char* server, int dataPort, int commandPort,
+                                             const char* publicKey, const char* status,
+                                             const char* details)
+{
+    if (!role || !*role || dataPort < 0 || commandPort < 0) return -5;
+    if (details && std::strlen(details) >= hedgeedge::REGISTRY_DETAILS_LEN) return -5;
+
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (!registry) return -1;
+
+    hedgeedge::AgentInfo info;
+    info.role = role;
+    info.login = login;
+    info.broker = Text(broker);
+    info.server = Text(server);
+    info.dataPort = dataPort;
+    info.commandPort = commandPort;
+    info.publicKey = Text(publicKey);
+    info.status = status && *status ? status : "active";
+    info.details = Text(details);
+
+    int slot = registry->Register(info);
+    if (slot < 0) return -4;
+    return g_registrations.Add(std::make_shared<RegistrationHandle>(RegistrationHandle{ slot }));
+}
+
+HEDGEEDGE_API int __stdcall RegistryUpdate(int handle, const char* status, const char* details)
+{
+    auto registration = g_registrations.Get(handle);
+    if (!registration) return -1;
+    if (details && std::strlen(details) >= hedgeedge::REGISTRY_DETAILS_LEN) return -5;
+
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (!registry) return -1;
+    return registry->Update(registration->slot, Text(status), Text(details)) ? 0 : -1;
+}
+
+HEDGEEDGE_API void __stdcall RegistryUnregister(int handle)
+{
+    auto registration = g_registrations.Remove(handle);
+    if (!registration) return;
+
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (registry) registry->Unregister(registration->slot);
+}
+
+HEDGEEDGE_API long long __stdcall RegistryGeneration()
+{
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (!registry) return -1;
+    return static_cast<long long>(registry->Generation());
+}
+
+HEDGEEDGE_API long long __stdcall RegistryWait(long long seenGeneration, int timeoutMs)
+{
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (!registry) return -1;
+    return static_cast<long long>(registry->Wait(static_cast<uint64_t>(seenGeneration), timeoutMs));
+}
+
+HEDGEEDGE_API int __stdcall RegistryList(char* outJson, int jsonLen)
+{
+    if (!outJson || jsonLen <= 0) return -5;
+
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (!registry) return -1;
+
+    std::vector<hedgeedge::AgentInfo> agents;
+    registry->List(agents);
+    std::string json = hedgeedge::AgentsJson(agents);
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API int __stdcall RegistrySetLicenseKey(const char* key)
+{
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (!registry) return -1;
+    return registry->SetLicenseKey(Text(key)) ? 0 : -5;
+}
+
+HEDGEEDGE_API int __stdcall RegistryLicenseKey(char* outKey, int keyLen)
+{
+    if (!outKey || keyLen <= 0) return -5;
+
+    hedgeedge::AgentRegistry* registry = Registry();
+    if (!registry) return -1;
+
+    std::string key = registry->LicenseKey();
+    if (key.size() >= static_cast<size_t>(keyLen)) return -5;
+    std::memcpy(outKey, key.c_str(), key.size() + 1);
+    return static_cast<int>(key.size());
+}
+
+} // extern "C"
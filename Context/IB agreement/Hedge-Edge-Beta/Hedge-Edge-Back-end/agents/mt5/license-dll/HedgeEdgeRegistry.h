@@ -0,0 +1,244 @@
+// ============================================================================
+// Hedge Edge Agent Registry
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// One named shared-memory segment ("HedgeEdge.Registry") holds a fixed table
+// of the agents running on this host: role, account, ports, CURVE public key,
+// status and free-form details. Each EA owns one entry and updates it under
+// a per-entry seqlock; every change bumps a registry-wide generation counter
+// and wakes watchers (futex on Linux, per-watcher named event on Windows),
+// so the desktop app learns about terminals as they come and go instead of
+// polling registration files. Entries of crashed processes are reaped by
+// watchers. The app can also publish the shared license key here.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_REGISTRY_H
+#define HEDGE_EDGE_REGISTRY_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeShm.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Registry Layout
+// ============================================================================
+
+constexpr uint32_t REGISTRY_MAGIC        = 0x48455259; // "HERY"
+constexpr uint32_t REGISTRY_VERSION      = 1;
+constexpr uint32_t REGISTRY_MAX_AGENTS   = 64;
+constexpr uint32_t REGISTRY_MAX_WATCHERS = 16;
+constexpr size_t   REGISTRY_KEY_LEN      = 128;
+constexpr size_t   REGISTRY_DETAILS_LEN  = 1024;
+
+enum RegistryEntryState : uint32_t
+{
+    REGISTRY_FREE    = 0,
+    REGISTRY_CLAIMED = 1,       // Owner is writing the first version
+    REGISTRY_LIVE    = 2,
+};
+
+struct RegistryEntry
+{
+    std::atomic<uint32_t> state;
+    std::atomic<uint32_t> pid;              // Owning process (claimed by CAS)
+    std::atomic<uint64_t> seq;              // Seqlock: odd while the owner writes
+    uint64_t version;                       // Bumped by every update of this entry
+    uint64_t registeredUs;                  // WallMicros()
+    uint64_t updatedUs;
+    int64_t  login;
+    int32_t  dataPort;
+    int32_t  commandPort;
+    char     role[16];                      // "master" / "slave"
+    char     status[16];                    // "starting" / "active" / "paused" / ...
+    char     broker[64];
+    char     server[64];
+    char     publicKey[48];                 // Z85 CURVE key, empty without CURVE
+    char     details[REGISTRY_DETAILS_LEN]; // JSON object, empty = none
+};
+
+struct alignas(64) RegistryHeader
+{
+    std::atomic<uint32_t> initState;        // 0 = blank, 1 = initializing, 2 = ready
+    uint32_t magic;
+    uint32_t version;
+    uint32_t capacity;                      // Entries
+    uint32_t entrySize;                     // sizeof(RegistryEntry) of the creator
+
+    alignas(64) std::atomic<uint64_t> generation; // Bumped by every change
+    std::atomic<uint32_t> wakeWord;         // Futex word (bumped per change)
+    std::atomic<uint32_t> waiters;          // Watchers blocked on the futex
+    std::atomic<uint32_t> watcherMask;      // Windows: allocated watcher slots
+    std::atomic<uint32_t> watcherPid[REGISTRY_MAX_WATCHERS];
+
+    alignas(64) std::atomic<uint64_t> keySeq;  // Seqlock for the license key
+    char licenseKey[REGISTRY_KEY_LEN];
+};
+
+// Decoded copy of one live entry
+struct AgentInfo
+{
+    std::string role;
+    std::string status;
+    std::string broker;
+    std::string server;
+    std::string publicKey;
+    std::string details;
+    int64_t     login = 0;
+    int         dataPort = 0;
+    int         commandPort = 0;
+    uint32_t    pid = 0;
+    uint64_t    version = 0;
+    uint64_t    registeredUs = 0;
+    uint64_t    updatedUs = 0;
+};
+
+// ============================================================================
+// AgentRegistry
+// ============================================================================
+// A process opens the registry once (creating the segment if it is the
+// first) and then owns any number of entries; readers use the same object.
+
+class AgentRegistry
+{
+public:
+    ~AgentRegistry() { Close(); }
+
+    bool Open();
+    void Close();
+    bool IsOpen() const { return m_header != nullptr; }
+
+    // Claim an entry (reusing one left by a dead process). Returns the slot
+    // or -1 if the table is full.
+    int  Register(const AgentInfo& info);
+
+    // Rewrite an owned entry. Empty `status` / `details` keep the old value.
+    bool Update(int slot, const std::string& status, const std::string& details);
+    void Unregister(int slot);
+
+    // Consistent copies of every live entry
+    void List(std::vector<AgentInfo>& out) const;
+
+    uint64_t Generation() const;
+
+    // Block until the generation differs from `seen` or the timeout passes.
+    // Returns the current generation.
+    uint64_t Wait(uint64_t seen, int timeoutMs);
+
+    // Free entries whose process has exited. Returns the number reaped.
+    int Reap();
+
+    bool SetLicenseKey(const std::string& key);
+    std::string LicenseKey() const;
+
+private:
+    void WriteEntry(RegistryEntry& entry, const AgentInfo& info);
+    void Changed();
+
+    SharedSegment   m_segment;
+    RegistryHeader* m_header = nullptr;
+    RegistryEntry*  m_entries = nullptr;
+#ifdef _WIN32
+    int             m_watcherSlot = -1;
+    void*           m_watcherEvent = nullptr;
+    void*           m_watcherEvents[REGISTRY_MAX_WATCHERS] = {};
+#endif
+};
+
+// JSON array of agents (as returned by RegistryList)
+std::string AgentsJson(const std::vector<AgentInfo>& agents);
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Agent (EA)
+// ============================================================================
+
+/**
+ * Register this EA in the host registry.
+ *
+ * @param role         "master" or "slave"
+ * @param login        Account login
+ * @param broker       Broker company name (UTF-8)
+ * @param server       Trade server name (UTF-8)
+ * @param dataPort     Data port (master PUB port / slave's master port)
+ * @param commandPort  Command (REP) port
+ * @param publicKey    CURVE public key (Z85), empty if CURVE is off
+ * @param status       Initial status, e.g. "active"
+ * @param details      JSON object with feature flags, empty for none
+ *
+ * @return Handle (>0) on success, -1 if shared memory is unavailable,
+ *         -4 if the registry is full, -5 on a parameter error
+ */
+HEDGEEDGE_API int __stdcall RegistryRegister(const char* role, long long login, const char* broker,
+                                             const char* server, int dataPort, int commandPort,
+                                             const char* publicKey, const char* status,
+                                             const char* details);
+
+/**
+ * Update status and/or details of a registered EA (empty string = keep).
+ *
+ * @return 0 on success, -1 if not registered, -5 on a parameter error
+ */
+HEDGEEDGE_API int __stdcall RegistryUpdate(int handle, const char* status, const char* details);
+
+/**
+ * Remove the EA's entry and close the handle.
+ */
+HEDGEEDGE_API void __stdcall RegistryUnregister(int handle);
+
+// ============================================================================
+// Discovery (app, tools, EAs)
+// ============================================================================
+
+/**
+ * Registry generation; changes whenever any entry changes.
+ *
+ * @return Generation (>=0), -1 if shared memory is unavailable
+ */
+HEDGEEDGE_API long long __stdcall RegistryGeneration();
+
+/**
+ * Wait up to `timeoutMs` for the generation to move past `seenGeneration`.
+ *
+ * @return Current generation, -1 if shared memory is unavailable
+ */
+HEDGEEDGE_API long long __stdcall RegistryWait(long long seenGeneration, int timeoutMs);
+
+/**
+ * JSON array of the live agents on this host.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall RegistryList(char* outJson, int jsonLen);
+
+/**
+ * Publish the shared license key (written by the desktop app).
+ *
+ * @return 0 on success, -1 if unavailable, -5 if the key is too long
+ */
+HEDGEEDGE_API int __stdcall RegistrySetLicenseKey(const char* key);
+
+/**
+ * Read the shared license key.
+ *
+ * @return Key length (0 = none published), negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall RegistryLicenseKey(char* outKey, int keyLen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_REGISTRY_H
@@ -0,0 +1,416 @@
+// ============================================================================
+// Hedge Edge Prop Rule Engine
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeJson.h"
+#include "HedgeEdgeRules.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const int64_t SECONDS_PER_DAY = 86400;
+    const size_t  MAX_QUEUED_EVENTS = 64;    // Oldest dropped if the EA stops draining
+
+    double BasisValue(RuleBasis basis, double balance, double equity)
+    {
+        switch (basis)
+        {
+            case RuleBasis::Equity: return equity;
+            case RuleBasis::Higher: return std::max(balance, equity);
+            default:                return balance;
+        }
+    }
+
+    bool ParseBasis(std::string_view json, std::string_view key, RuleBasis& basis, std::string* error)
+    {
+        std::string_view text = JsonStringView(json, key);
+        if (text.empty()) return true;
+        if (text == "balance") basis = RuleBasis::Balance;
+        else if (text == "equity") basis = RuleBasis::Equity;
+        else if (text == "higher") basis = RuleBasis::Higher;
+        else
+        {
+            if (error) *error = std::string(key) + ": expected balance, equity or higher";
+            return false;
+        }
+        return true;
+    }
+
+    // Absolute amount, or a percentage of the initial balance
+    double Amount(std::string_view json, std::string_view key, std::string_view pctKey, double initialBalance)
+    {
+        if (JsonHas(json, key)) return std::max(JsonDouble(json, key), 0.0);
+        return std::max(JsonDouble(json, pctKey), 0.0) * initialBalance / 100.0;
+    }
+
+    // Floor division: broker day of a server timestamp
+    int64_t DayIndex(int64_t serverTime, int dayStartHour)
+    {
+        int64_t shifted = serverTime - static_cast<int64_t>(dayStartHour) * 3600;
+        int64_t day = shifted / SECONDS_PER_DAY;
+        return shifted % SECONDS_PER_DAY < 0 ? day - 1 : day;
+    }
+
+    void AppendMoney(std::string& out, double value)
+    {
+        AppendFixed(out, value, 2);
+    }
+
+} // namespace
+
+const char* RuleName(RuleEngine::Rule rule)
+{
+    switch (rule)
+    {
+        case RuleEngine::DailyLoss:        return "dailyLoss";
+        case RuleEngine::MaxDrawdown:      return "maxDrawdown";
+        case RuleEngine::TrailingDrawdown: return "trailingDrawdown";
+        case RuleEngine::ProfitTarget:     return "profitTarget";
+        default:                           return "unknown";
+    }
+}
+
+const char* RuleStateName(RuleEngine::Rule rule, RuleState state)
+{
+    switch (state)
+    {
+        case RuleState::Warning:  return "WARNING";
+        case RuleState::Breached: return rule == RuleEngine::ProfitTarget ? "REACHED" : "BREACHED";
+        default:                  return "OK";
+    }
+}
+
+bool ParseRuleConfig(std::string_view json, RuleConfig& config, std::string* error)
+{
+    config = RuleConfig();
+    config.initialBalance = JsonDouble(json, "initialBalance");
+    if (config.initialBalance <= 0.0)
+    {
+        if (error) *error = "initialBalance is required";
+        return false;
+    }
+
+    double initial = config.initialBalance;
+    config.dailyLoss = Amount(json, "dailyLoss", "dailyLossPct", initial);
+    config.maxDrawdown = Amount(json, "maxDrawdown", "maxDrawdownPct", initial);
+    config.trailingDrawdown = Amount(json, "trailingDrawdown", "trailingDrawdownPct", initial);
+    config.profitTarget = Amount(json, "profitTarget", "profitTargetPct", initial);
+    config.trailingLock = JsonBool(json, "trailingLock", false);
+
+    double warnAtPct = JsonDouble(json, "warnAtPct", 80.0);
+    int64_t dayStartHour = JsonInt(json, "dayStartHour", 0);
+    if (warnAtPct <= 0.0 || warnAtPct > 100.0 || dayStartHour < 0 || dayStartHour > 23)
+    {
+        if (error) *error = "warnAtPct must be in (0, 100], dayStartHour in [0, 23]";
+        return false;
+    }
+    config.warnFraction = warnAtPct / 100.0;
+    config.dayStartHour = static_cast<int>(dayStartHour);
+
+    return ParseBasis(json, "dailyAnchor", config.dailyAnchor, error) &&
+           ParseBasis(json, "trailingBasis", config.trailingBasis, error) &&
+           ParseBasis(json, "profitBasis", config.profitBasis, error);
+}
+
+// ============================================================================
+// RuleEngine
+// ============================================================================
+
+RuleEngine::RuleEngine(const RuleConfig& config)
+    : m_config(config)
+{
+    m_rules[DailyLoss].limit = config.dailyLoss;
+    m_rules[MaxDrawdown].limit = config.maxDrawdown;
+    m_rules[TrailingDrawdown].limit = config.trailingDrawdown;
+    m_rules[ProfitTarget].limit = config.profitTarget;
+    m_highWater = config.initialBalance;
+}
+
+int64_t RuleEngine::DayStart(int64_t serverTime) const
+{
+    return DayIndex(serverTime, m_config.dayStartHour) * SECONDS_PER_DAY +
+           static_cast<int64_t>(m_config.dayStartHour) * 3600;
+}
+
+void RuleEngine::SetDayAnchor(int64_t serverTime, double anchor)
+{
+    m_day = DayIndex(serverTime, m_config.dayStartHour);
+    m_dayAnchor = anchor;
+}
+
+RuleState RuleEngine::Update(int64_t serverTime, double balance, double equity)
+{
+    if (m_updates++ == 0)
+    {
+        m_lowEquity = equity;
+        m_dayLow = equity;
+    }
+    m_balance = balance;
+    m_equity = equity;
+    m_serverTime = serverTime;
+
+    int64_t day = DayIndex(serverTime, m_config.dayStartHour);
+    if (day != m_day)
+    {
+        // First update of a new broker day takes the anchor
+        if (m_day != INT64_MIN) m_dayRolls++;
+        m_day = day;
+        m_dayAnchor = BasisValue(m_config.dailyAnchor, balance, equity);
+        m_dayLow = equity;
+    }
+    m_dayLow = std::min(m_dayLow, equity);
+    m_lowEquity = std::min(m_lowEquity, equity);
+    m_highWater = std::max(m_highWater, BasisValue(m_config.trailingBasis, balance, equity));
+
+    double initial = m_config.initialBalance;
+
+    RuleStatus& daily = m_rules[DailyLoss];
+    daily.floor = m_dayAnchor - daily.limit;
+    daily.used = m_dayAnchor - equity;
+
+    RuleStatus& maxDrawdown = m_rules[MaxDrawdown];
+    maxDrawdown.floor = initial - maxDrawdown.limit;
+    maxDrawdown.used = initial - equity;
+
+    RuleStatus& trailing = m_rules[TrailingDrawdown];
+    trailing.floor = m_highWater - trailing.limit;
+    if (m_config.trailingLock) trailing.floor = std::min(trailing.floor, initial);
+    trailing.used = trailing.limit - (equity - trailing.floor);
+
+    RuleStatus& target = m_rules[ProfitTarget];
+    target.floor = initial + target.limit;
+    target.used = BasisValue(m_config.profitBasis, balance, equity) - initial;
+
+    RuleState worst = RuleState::Ok;
+    for (int rule = 0; rule < RULE_COUNT; rule++)
+    {
+        Evaluate(static_cast<Rule>(rule), equity, serverTime, balance, equity);
+        if (rule != ProfitTarget && m_rules[rule].state > worst) worst = m_rules[rule].state;
+    }
+    return worst;
+}
+
+void RuleEngine::Evaluate(Rule rule, double value, int64_t serverTime, double balance, double equity)
+{
+    RuleStatus& status = m_rules[rule];
+    if (status.limit <= 0.0 || status.state == RuleState::Breached) return;
+
+    RuleState state = RuleState::Ok;
+    if (rule == ProfitTarget)
+    {
+        if (status.used >= status.limit) state = RuleState::Breached;
+    }
+    else if (value <= status.floor)
+    {
+        state = RuleState::Breached;
+    }
+    else if (status.used >= status.limit * m_config.warnFraction)
+    {
+        state = RuleState::Warning;
+    }
+
+    if (state == status.state) return;
+    RuleState previous = status.state;
+    status.state = state;
+    QueueEvent(rule, previous, serverTime, balance, equity);
+}
+
+void RuleEngine::QueueEvent(Rule rule, RuleState previous, int64_t serverTime, double balance, double equity)
+{
+    const RuleStatus& status = m_rules[rule];
+
+    RuleEvent event;
+    if (status.state == RuleState::Breached) event.type = rule == ProfitTarget ? "PROFIT_TARGET" : "RULE_BREACH";
+    else if (status.state == RuleState::Warning) event.type = "RULE_WARNING";
+    else event.type = "RULE_OK";
+
+    std::string& json = event.json;
+    json = "{\"rule\":\"";
+    json += RuleName(rule);
+    json += "\",\"state\":\"";
+    json += RuleStateName(rule, status.state);
+    json += "\",\"previous\":\"";
+    json += RuleStateName(rule, previous);
+    json += "\",\"balance\":";
+    AppendMoney(json, balance);
+    json += ",\"equity\":";
+    AppendMoney(json, equity);
+    json += ",\"limit\":";
+    AppendMoney(json, status.limit);
+    json += ",\"floor\":";
+    AppendMoney(json, status.floor);
+    json += ",\"used\":";
+    AppendMoney(json, status.used);
+    json += ",\"usedPct\":";
+    AppendFixed(json, status.used / status.limit * 100.0, 2);
+    json += ",\"serverTimeUnix\":";
+    AppendInt(json, serverTime);
+    json += "}";
+
+    if (m_events.size() >= MAX_QUEUED_EVENTS) m_events.pop_front();
+    m_events.push_back(std::move(event));
+    m_eventsQueued++;
+}
+
+bool RuleEngine::NextEvent(RuleEvent& event)
+{
+    if (m_events.empty()) return false;
+    event = std::move(m_events.front());
+    m_events.pop_front();
+    return true;
+}
+
+std::string RuleEngine::StatsJson() const
+{
+    std::string json = "{\"initialBalance\":";
+    AppendMoney(json, m_config.initialBalance);
+    json += ",\"balance\":";
+    AppendMoney(json, m_balance);
+    json += ",\"equity\":";
+    AppendMoney(json, m_equity);
+    json += ",\"dayStart\":\"";
+    AppendServerTime(json, m_day == INT64_MIN ? 0 : m_day * SECONDS_PER_DAY + m_config.dayStartHour * 3600);
+    json += "\",\"dayAnchor\":";
+    AppendMoney(json, m_dayAnchor);
+    json += ",\"dayLow\":";
+    AppendMoney(json, m_dayLow);
+    json += ",\"highWater\":";
+    AppendMoney(json, m_highWater);
+    json += ",\"lowEquity\":";
+    AppendMoney(json, m_lowEquity);
+    json += ",\"updates\":";
+    AppendUInt(json, m_updates);
+    json += ",\"dayRolls\":";
+    AppendUInt(json, m_dayRolls);
+    json += ",\"events\":";
+    AppendUInt(json, m_eventsQueued);
+    json += ",\"rules\":{";
+
+    bool first = true;
+    for (int i = 0; i < RULE_COUNT; i++)
+    {
+        Rule rule = static_cast<Rule>(i);
+        const RuleStatus& status = m_rules[rule];
+        if (status.limit <= 0.0) continue;
+        if (!first) json += ",";
+        first = false;
+
+        json += "\"";
+        json += RuleName(rule);
+        json += "\":{\"state\":\"";
+        json += RuleStateName(rule, status.state);
+        json += "\",\"limit\":";
+        AppendMoney(json, status.limit);
+        json += ",\"floor\":";
+        AppendMoney(json, status.floor);
+        json += ",\"used\":";
+        AppendMoney(json, status.used);
+        json += ",\"usedPct\":";
+        AppendFixed(json, status.used / status.limit * 100.0, 2);
+        json += "}";
+    }
+    json += "}}";
+    return json;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    hedgeedge::HandleTable<hedgeedge::RuleEngine> g_ruleEngines;
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall RulesCreate(const char* configJson)
+{
+    if (!configJson) return -5;
+
+    hedgeedge::RuleConfig config;
+    if (!hedgeedge::ParseRuleConfig(configJson, config)) return -5;
+    return g_ruleEngines.Add(std::make_shared<hedgeedge::RuleEngine>(config));
+}
+
+HEDGEEDGE_API long long __stdcall RulesDayStart(int handle, long long serverTime)
+{
+    auto engine = g_ruleEngines.Get(handle);
+    if (!engine) return -1;
+    return engine->DayStart(serverTime);
+}
+
+HEDGEEDGE_API int __stdcall RulesSetDayAnchor(int handle, long long serverTime, double anchor)
+{
+    auto engine = g_ruleEngines.Get(handle);
+    if (!engine) return -1;
+
+    engine->SetDayAnchor(serverTime, anchor);
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall RulesUpdate(int handle, long long serverTime, double balance, double equity)
+{
+    auto engine = g_ruleEngines.Get(handle);
+    if (!engine) return -1;
+
+    engine->Update(serverTime, balance, equity);
+    return static_cast<int>(engine->PendingEvents());
+}
+
+HEDGEEDGE_API int __stdcall RulesNextEvent(int handle, char* outType, int typeLen, char* outJson, int jsonLen)
+{
+    auto engine = g_ruleEngines.Get(handle);
+    if (!engine) return -1;
+    if (!outType || typeLen <= 0 || !outJson || jsonLen <= 0) return -5;
+
+    const hedgeedge::RuleEvent* next = engine->PeekEvent();
+    if (!next) return 0;
+    if (next->type.size() >= static_cast<size_t>(typeLen) || next->json.size() >= static_cast<size_t>(jsonLen))
+    {
+        return -5;
+    }
+
+    hedgeedge::RuleEvent event;
+    engine->NextEvent(event);
+    std::memcpy(outType, event.type.c_str(), event.type.size() + 1);
+    std::memcpy(outJson, event.json.c_str(), event.json.size() + 1);
+    return static_cast<int>(event.json.size());
+}
+
+HEDGEEDGE_API int __stdcall RulesStats(int handle, char* outJson, int jsonLen)
+{
+    auto engine = g_ruleEngines.Get(handle);
+    if (!engine) return -1;
+    if (!outJson || jsonLen <= 0) return -5;
+
+    std::string json = engine->StatsJson();
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API void __stdcall RulesClose(int handle)
+{
+    g_ruleEngines.Remove(handle);
+}
+
+} // extern "C"
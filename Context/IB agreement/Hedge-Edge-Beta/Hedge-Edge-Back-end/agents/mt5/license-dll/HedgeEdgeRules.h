@@ -0,0 +1,212 @@
+// ============================================================================
+// Hedge Edge Prop Rule Engine
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Evaluates prop-firm account rules (daily loss, maximum drawdown, trailing
+// drawdown, profit target) on every balance / equity update. Each update is
+// O(1): the engine keeps the running equity high-water mark, the lowest
+// equity overall and of the day, and the daily anchor that is re-taken
+// when the broker's trading day rolls over.
+//
+// A rule moves between OK, WARNING (a configurable share of its allowance
+// used) and BREACHED; the profit target between OK and REACHED. Every state
+// change queues one event for the EA to publish, so the app learns of a
+// breach on the tick that caused it instead of from the firm.
+//
+// Breaches latch: a failed account stays failed until the engine is
+// recreated. Warnings clear when equity recovers.
+//
+// Single-threaded: every call comes from the owning EA thread.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_RULES_H
+#define HEDGE_EDGE_RULES_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+
+namespace hedgeedge {
+
+enum class RuleState : int
+{
+    Ok       = 0,
+    Warning  = 1,
+    Breached = 2,           // REACHED for the profit target
+};
+
+enum class RuleBasis : int
+{
+    Balance = 0,
+    Equity  = 1,
+    Higher  = 2,            // max(balance, equity)
+};
+
+// Loss limits are absolute amounts in account currency; 0 disables a rule.
+// ParseRuleConfig converts the *Pct forms against initialBalance.
+struct RuleConfig
+{
+    double    initialBalance = 0.0;
+    double    dailyLoss = 0.0;              // Below the day's anchor
+    RuleBasis dailyAnchor = RuleBasis::Balance;
+    int       dayStartHour = 0;             // Server time (broker day roll)
+    double    maxDrawdown = 0.0;            // Below initialBalance (static floor)
+    double    trailingDrawdown = 0.0;       // Below the high-water mark
+    RuleBasis trailingBasis = RuleBasis::Equity;
+    bool      trailingLock = false;         // Floor stops at initialBalance
+    double    profitTarget = 0.0;           // Above initialBalance
+    RuleBasis profitBasis = RuleBasis::Balance;
+    double    warnFraction = 0.8;           // Share of an allowance that warns
+};
+
+// Parse the rules file:
+//   {"initialBalance":100000,"dailyLossPct":5,"maxDrawdownPct":10,
+//    "trailingDrawdownPct":0,"trailingLock":false,"profitTargetPct":10,
+//    "warnAtPct":80,"dayStartHour":0,"dailyAnchor":"balance"}
+// Absolute forms ("dailyLoss", "maxDrawdown", ...) win over the *Pct forms.
+// Bases are "balance", "equity" or "higher".
+bool ParseRuleConfig(std::string_view json, RuleConfig& config, std::string* error = nullptr);
+
+struct RuleEvent
+{
+    std::string type;                       // RULE_WARNING / RULE_BREACH / RULE_OK / PROFIT_TARGET
+    std::string json;                       // Event data object
+};
+
+class RuleEngine
+{
+public:
+    enum Rule
+    {
+        DailyLoss = 0,
+        MaxDrawdown,
+        TrailingDrawdown,
+        ProfitTarget,
+        RULE_COUNT
+    };
+
+    explicit RuleEngine(const RuleConfig& config);
+
+    // Server time at which the broker day containing `serverTime` began
+    int64_t DayStart(int64_t serverTime) const;
+
+    // Anchor of the day containing `serverTime` (e.g. the balance at day start
+    // rebuilt from deal history after a restart)
+    void SetDayAnchor(int64_t serverTime, double anchor);
+
+    // Evaluate one update. Returns the worst loss-rule state.
+    RuleState Update(int64_t serverTime, double balance, double equity);
+
+    // Next queued state change; false if none
+    bool NextEvent(RuleEvent& event);
+    const RuleEvent* PeekEvent() const { return m_events.empty() ? nullptr : &m_events.front(); }
+    size_t PendingEvents() const { return m_events.size(); }
+
+    RuleState State(Rule rule) const { return m_rules[rule].state; }
+
+    std::string StatsJson() const;
+
+private:
+    struct RuleStatus
+    {
+        RuleState state = RuleState::Ok;
+        double    limit = 0.0;              // Allowance (or target), 0 = disabled
+        double    floor = 0.0;              // Equity / balance level of the breach
+        double    used = 0.0;               // Loss (or profit) counted against it
+    };
+
+    void Evaluate(Rule rule, double value, int64_t serverTime, double balance, double equity);
+    void QueueEvent(Rule rule, RuleState previous, int64_t serverTime, double balance, double equity);
+
+    RuleConfig  m_config;
+    RuleStatus  m_rules[RULE_COUNT];
+    int64_t     m_day = INT64_MIN;          // Broker day index of m_dayAnchor
+    double      m_dayAnchor = 0.0;
+    double      m_dayLow = 0.0;             // Lowest equity of the day
+    double      m_highWater = 0.0;          // Trailing basis high-water mark
+    double      m_lowEquity = 0.0;
+    double      m_balance = 0.0;
+    double      m_equity = 0.0;
+    int64_t     m_serverTime = 0;
+    uint64_t    m_updates = 0;
+    uint64_t    m_dayRolls = 0;
+    uint64_t    m_eventsQueued = 0;
+    std::deque<RuleEvent> m_events;
+};
+
+const char* RuleName(RuleEngine::Rule rule);
+const char* RuleStateName(RuleEngine::Rule rule, RuleState state);
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Prop Rules
+// ============================================================================
+
+/**
+ * Create a rule engine from the rules file contents (JSON, see ParseRuleConfig).
+ *
+ * @return Handle (>0) on success, -5 on a parameter or config error
+ */
+HEDGEEDGE_API int __stdcall RulesCreate(const char* configJson);
+
+/**
+ * Start of the broker day containing `serverTime` (per the config's dayStartHour).
+ *
+ * @return Server time in seconds, -1 if the handle is not open
+ */
+HEDGEEDGE_API long long __stdcall RulesDayStart(int handle, long long serverTime);
+
+/**
+ * Anchor the current trading day (e.g. day-start balance from deal history).
+ *
+ * @return 0 on success, -1 if the handle is not open
+ */
+HEDGEEDGE_API int __stdcall RulesSetDayAnchor(int handle, long long serverTime, double anchor);
+
+/**
+ * Evaluate one balance / equity update (call per tick and per timer pass).
+ *
+ * @param serverTime  Broker server time, seconds (TimeCurrent)
+ *
+ * @return Number of queued state-change events, -1 if the handle is not open
+ */
+HEDGEEDGE_API int __stdcall RulesUpdate(int handle, long long serverTime, double balance, double equity);
+
+/**
+ * Pop the next state-change event.
+ *
+ * @param outType  Receives the event type (RULE_WARNING, RULE_BREACH, RULE_OK, PROFIT_TARGET)
+ * @param outJson  Receives the event data object
+ *
+ * @return JSON length, 0 if no event is queued, -1 if not open,
+ *         -5 if a buffer is too small (the event stays queued)
+ */
+HEDGEEDGE_API int __stdcall RulesNextEvent(int handle, char* outType, int typeLen, char* outJson, int jsonLen);
+
+/**
+ * Rule states, anchors and limits as JSON.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall RulesStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Close a rule engine handle.
+ */
+HEDGEEDGE_API void __stdcall RulesClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_RULES_H
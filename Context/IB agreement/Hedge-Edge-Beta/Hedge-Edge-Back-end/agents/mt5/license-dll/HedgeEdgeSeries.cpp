@@ -0,0 +1,760 @@
+// ============================================================================
+// Hedge Edge Equity Time Series
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Column encodings (bit streams, most significant bit first):
+//
+//   time   first sample: 64 bits raw. Then the delta-of-delta D:
+//            '0'              D == 0
+//            '10'   + 7 bits  D in [-64, 63]
+//            '110'  + 9 bits  D in [-256, 255]
+//            '1110' + 12 bits D in [-2048, 2047]
+//            '1111' + 64 bits anything else
+//
+//   value  first sample: 64 bits raw. Then X = bits ^ previous bits:
+//            '0'                               X == 0
+//            '10' + meaningful bits            X fits the previous window
+//            '11' + 5 bits leading zeros
+//                 + 6 bits window length (0 = 64) + meaningful bits
+// ============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeJson.h"
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeSeries.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const size_t VALUE_COLUMNS = SERIES_COLUMNS - 1;
+
+    inline uint64_t Align8(uint64_t value)
+    {
+        return (value + 7) & ~static_cast<uint64_t>(7);
+    }
+
+    int LeadingZeros(uint64_t value)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return 63 - static_cast<int>(index);
+#else
+        return __builtin_clzll(value);
+#endif
+    }
+
+    int TrailingZeros(uint64_t value)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(value);
+#endif
+    }
+
+    inline uint64_t DoubleBits(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    inline double BitsDouble(uint64_t bits)
+    {
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    inline double Column(const SeriesSample& sample, size_t column)
+    {
+        switch (column)
+        {
+            case 0:  return sample.balance;
+            case 1:  return sample.equity;
+            case 2:  return sample.margin;
+            default: return sample.floatingPnL;
+        }
+    }
+
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(std::string& out) : m_out(out) { m_out.clear(); }
+
+        void Write(uint64_t value, int count)
+        {
+            while (count > 0)
+            {
+                int space = 8 - m_bits;
+                int take = count < space ? count : space;
+                uint32_t chunk = static_cast<uint32_t>(value >> (count - take)) & ((1u << take) - 1);
+                m_current = static_cast<uint8_t>(m_current | (chunk << (space - take)));
+                m_bits += take;
+                count -= take;
+                if (m_bits == 8)
+                {
+                    m_out.push_back(static_cast<char>(m_current));
+                    m_current = 0;
+                    m_bits = 0;
+                }
+            }
+        }
+
+        void Finish()
+        {
+            if (m_bits > 0) m_out.push_back(static_cast<char>(m_current));
+            m_current = 0;
+            m_bits = 0;
+        }
+
+    private:
+        std::string& m_out;
+        uint8_t      m_current = 0;
+        int          m_bits = 0;
+    };
+
+    class BitReader
+    {
+    public:
+        BitReader(const char* data, size_t size)
+            : m_data(reinterpret_cast<const uint8_t*>(data)), m_size(size) {}
+
+        // False once the stream is exhausted; `value` is then 0
+        bool Read(int count, uint64_t& value)
+        {
+            value = 0;
+            while (count > 0)
+            {
+                if (m_byte >= m_size) return false;
+                int available = 8 - m_bit;
+                int take = count < available ? count : available;
+                uint32_t chunk = (m_data[m_byte] >> (available - take)) & ((1u << take) - 1);
+                value = (value << take) | chunk;
+                m_bit += take;
+                count -= take;
+                if (m_bit == 8)
+                {
+                    m_byte++;
+                    m_bit = 0;
+                }
+            }
+            return true;
+        }
+
+        bool Bit(uint64_t& value) { return Read(1, value); }
+
+    private:
+        const uint8_t* m_data;
+        size_t         m_size;
+        size_t         m_byte = 0;
+        int            m_bit = 0;
+    };
+
+    inline bool Fits(int64_t value, int bits)
+    {
+        int64_t limit = int64_t(1) << (bits - 1);
+        return value >= -limit && value < limit;
+    }
+
+    inline int64_t SignExtend(uint64_t value, int bits)
+    {
+        uint64_t sign = uint64_t(1) << (bits - 1);
+        return static_cast<int64_t>((value ^ sign) - sign);
+    }
+
+    void EncodeTimes(const std::vector<SeriesSample>& samples, std::string& out)
+    {
+        BitWriter writer(out);
+        int64_t previous = 0;
+        int64_t previousDelta = 0;
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            int64_t time = samples[i].timeMs;
+            if (i == 0)
+            {
+                writer.Write(static_cast<uint64_t>(time), 64);
+                previous = time;
+                continue;
+            }
+
+            int64_t delta = time - previous;
+            int64_t dod = delta - previousDelta;
+            if (dod == 0)               writer.Write(0x0, 1);
+            else if (Fits(dod, 7))      { writer.Write(0x2, 2);  writer.Write(static_cast<uint64_t>(dod), 7); }
+            else if (Fits(dod, 9))      { writer.Write(0x6, 3);  writer.Write(static_cast<uint64_t>(dod), 9); }
+            else if (Fits(dod, 12))     { writer.Write(0xE, 4);  writer.Write(static_cast<uint64_t>(dod), 12); }
+            else                        { writer.Write(0xF, 4);  writer.Write(static_cast<uint64_t>(dod), 64); }
+
+            previous = time;
+            previousDelta = delta;
+        }
+        writer.Finish();
+    }
+
+    bool DecodeTimes(const char* data, size_t size, uint32_t count, int64_t* times)
+    {
+        BitReader reader(data, size);
+        uint64_t bits = 0;
+        if (count == 0) return true;
+        if (!reader.Read(64, bits)) return false;
+        times[0] = static_cast<int64_t>(bits);
+
+        int64_t previousDelta = 0;
+        for (uint32_t i = 1; i < count; i++)
+        {
+            int width = 0;
+            for (int prefix = 0; prefix < 4; prefix++)
+            {
+                if (!reader.Bit(bits)) return false;
+                if (bits == 0)
+                {
+                    static const int WIDTHS[] = { 0, 7, 9, 12 };
+                    width = WIDTHS[prefix];
+                    break;
+                }
+                if (prefix == 3) width = 64;
+            }
+
+            int64_t dod = 0;
+            if (width > 0)
+            {
+                if (!reader.Read(width, bits)) return false;
+                dod = width == 64 ? static_cast<int64_t>(bits) : SignExtend(bits, width);
+            }
+            previousDelta += dod;
+            times[i] = times[i - 1] + previousDelta;
+        }
+        return true;
+    }
+
+    void EncodeValues(const std::vector<SeriesSample>& samples, size_t column, std::string& out)
+    {
+        BitWriter writer(out);
+        uint64_t previous = 0;
+        int windowLeading = -1;
+        int windowTrailing = 0;
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            uint64_t bits = DoubleBits(Column(samples[i], column));
+            if (i == 0)
+            {
+                writer.Write(bits, 64);
+                previous = bits;
+                continue;
+            }
+
+            uint64_t x = bits ^ previous;
+            previous = bits;
+            if (x == 0)
+            {
+                writer.Write(0x0, 1);
+                continue;
+            }
+
+            int leading = std::min(LeadingZeros(x), 31);
+            int trailing = TrailingZeros(x);
+            if (windowLeading >= 0 && leading >= windowLeading && trailing >= windowTrailing)
+            {
+                writer.Write(0x2, 2);
+                writer.Write(x >> windowTrailing, 64 - windowLeading - windowTrailing);
+                continue;
+            }
+
+            int length = 64 - leading - trailing;
+            writer.Write(0x3, 2);
+            writer.Write(static_cast<uint64_t>(leading), 5);
+            writer.Write(static_cast<uint64_t>(length & 63), 6);
+            writer.Write(x >> trailing, length);
+            windowLeading = leading;
+            windowTrailing = trailing;
+        }
+        writer.Finish();
+    }
+
+    bool DecodeValues(const char* data, size_t size, uint32_t count, double* values)
+    {
+        BitReader reader(data, size);
+        uint64_t bits = 0;
+        if (count == 0) return true;
+        if (!reader.Read(64, bits)) return false;
+        uint64_t previous = bits;
+        values[0] = BitsDouble(previous);
+
+        int windowLeading = 0;
+        int windowLength = 0;
+        for (uint32_t i = 1; i < count; i++)
+        {
+            if (!reader.Bit(bits)) return false;
+            if (bits != 0)
+            {
+                if (!reader.Bit(bits)) return false;
+                if (bits != 0)
+                {
+                    uint64_t leading = 0;
+                    uint64_t length = 0;
+                    if (!reader.Read(5, leading) || !reader.Read(6, length)) return false;
+                    windowLeading = static_cast<int>(leading);
+                    windowLength = length == 0 ? 64 : static_cast<int>(length);
+                    if (windowLeading + windowLength > 64) return false;
+                }
+                else if (windowLength == 0)
+                {
+                    return false;           // Window reuse before any window
+                }
+
+                uint64_t meaningful = 0;
+                if (!reader.Read(windowLength, meaningful)) return false;
+                previous ^= meaningful << (64 - windowLeading - windowLength);
+            }
+            values[i] = BitsDouble(previous);
+        }
+        return true;
+    }
+
+    // Decoded columns of one block
+    struct BlockColumns
+    {
+        int64_t times[SERIES_BLOCK_SAMPLES];
+        double  values[VALUE_COLUMNS][SERIES_BLOCK_SAMPLES];
+    };
+
+    bool DecodeBlock(const char* block, size_t available, BlockColumns& columns, uint32_t& count)
+    {
+        SeriesBlockHeader header;
+        if (available < sizeof(header)) return false;
+        std::memcpy(&header, block, sizeof(header));
+        if (header.magic != SERIES_BLOCK_MAGIC || header.count == 0 || header.count > SERIES_BLOCK_SAMPLES)
+        {
+            return false;
+        }
+
+        uint64_t offset = sizeof(header);
+        for (size_t column = 0; column < SERIES_COLUMNS; column++)
+        {
+            uint64_t bytes = header.columnBytes[column];
+            if (offset + bytes > available) return false;
+            const char* data = block + offset;
+            bool ok = column == 0
+                ? DecodeTimes(data, bytes, header.count, columns.times)
+                : DecodeValues(data, bytes, header.count, columns.values[column - 1]);
+            if (!ok) return false;
+            offset += Align8(bytes);
+        }
+        count = header.count;
+        return true;
+    }
+
+    // Bytes of a block on disk, or 0 if the header does not describe one
+    uint64_t BlockSize(const SeriesBlockHeader& header)
+    {
+        if (header.magic != SERIES_BLOCK_MAGIC || header.count == 0 || header.count > SERIES_BLOCK_SAMPLES)
+        {
+            return 0;
+        }
+        uint64_t size = sizeof(SeriesBlockHeader);
+        for (size_t column = 0; column < SERIES_COLUMNS; column++) size += Align8(header.columnBytes[column]);
+        return size;
+    }
+
+    // Buckets samples of [from, to] into equal-width points
+    class Downsampler
+    {
+    public:
+        Downsampler(int64_t from, int64_t to, size_t maxPoints, std::vector<SeriesPoint>& points)
+            : m_from(from), m_points(points)
+        {
+            uint64_t span = static_cast<uint64_t>(to - from) + 1;
+            m_width = maxPoints == 0 ? 1 : (span + maxPoints - 1) / maxPoints;
+        }
+
+        void Add(int64_t time, double balance, double equity, double margin, double floatingPnL)
+        {
+            uint64_t bucket = static_cast<uint64_t>(time - m_from) / m_width;
+            if (m_points.empty() || bucket != m_bucket)
+            {
+                m_points.emplace_back();
+                m_bucket = bucket;
+                m_points.back().equityMin = equity;
+                m_points.back().equityMax = equity;
+            }
+
+            SeriesPoint& point = m_points.back();
+            point.timeMs = time;
+            point.balance = balance;
+            point.equity = equity;
+            point.margin = margin;
+            point.floatingPnL = floatingPnL;
+            point.equityMin = std::min(point.equityMin, equity);
+            point.equityMax = std::max(point.equityMax, equity);
+            point.samples++;
+        }
+
+    private:
+        int64_t                   m_from;
+        uint64_t                  m_width = 1;
+        uint64_t                  m_bucket = 0;
+        std::vector<SeriesPoint>& m_points;
+    };
+
+    SeriesFileHeader* FileHeader(MappedFile& file)
+    {
+        return reinterpret_cast<SeriesFileHeader*>(file.Data());
+    }
+
+} // namespace
+
+std::string SeriesFileName(const std::string& accountId)
+{
+    std::string name;
+    name.reserve(accountId.size() + 5);
+    for (char c : accountId)
+    {
+        bool safe = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                    c == '.' || c == '_' || c == '-';
+        name += safe ? c : '_';
+    }
+    if (name.empty() || name[0] == '.') name.insert(name.begin(), '_');
+    return name + ".hets";
+}
+
+// ============================================================================
+// SeriesStore
+// ============================================================================
+
+SeriesStore::SeriesStore(std::string directory)
+    : m_directory(std::move(directory))
+{
+    while (m_directory.size() > 1 && (m_directory.back() == '/' || m_directory.back() == '\\'))
+    {
+        m_directory.pop_back();
+    }
+    if (!m_directory.empty()) MakeDirectory(m_directory);
+}
+
+SeriesStore::~SeriesStore()
+{
+    Close();
+}
+
+SeriesStore::Series* SeriesStore::Load(const std::string& accountId, bool create)
+{
+    auto found = m_series.find(accountId);
+    if (found != m_series.end()) return found->second.get();
+
+    std::string path = (m_directory.empty() ? std::string() : m_directory + "/") + SeriesFileName(accountId);
+    if (!create && !FileExists(path)) return nullptr;
+
+    std::unique_ptr<Series> series(new Series());
+    series->accountId = accountId;
+    bool created = false;
+    if (!series->file.Open(path, sizeof(SeriesFileHeader), &created)) return nullptr;
+
+    SeriesFileHeader* header = FileHeader(series->file);
+    if (created || header->magic != SERIES_FILE_MAGIC || header->version != SERIES_VERSION)
+    {
+        if (!created && header->magic != 0)
+        {
+            return nullptr;                 // Not ours (or a newer version): leave it alone
+        }
+        if (!series->file.Grow(SERIES_GROW_BYTES)) return nullptr;
+        header = FileHeader(series->file);
+        std::memset(header, 0, sizeof(*header));
+        header->magic = SERIES_FILE_MAGIC;
+        header->version = SERIES_VERSION;
+        header->dataEnd = sizeof(SeriesFileHeader);
+        std::strncpy(header->accountId, accountId.c_str(), sizeof(header->accountId) - 1);
+    }
+
+    // Rebuild the block index; stop at the first block that does not check out
+    uint64_t dataEnd = std::min<uint64_t>(header->dataEnd, series->file.Size());
+    uint64_t offset = sizeof(SeriesFileHeader);
+    uint64_t samples = 0;
+    while (offset + sizeof(SeriesBlockHeader) <= dataEnd)
+    {
+        SeriesBlockHeader block;
+        std::memcpy(&block, series->file.Data() + offset, sizeof(block));
+        uint64_t size = BlockSize(block);
+        if (size == 0 || offset + size > dataEnd || block.lastMs < block.firstMs ||
+            (!series->blocks.empty() && block.firstMs < series->blocks.back().lastMs))
+        {
+            break;
+        }
+        series->blocks.push_back(BlockIndex{ offset, block.firstMs, block.lastMs, block.count });
+        series->lastMs = block.lastMs;
+        samples += block.count;
+        offset += size;
+    }
+    header->dataEnd = offset;
+    header->samples = samples;
+    header->blocks = series->blocks.size();
+    series->samples = samples;
+
+    Series* result = series.get();
+    m_series.emplace(accountId, std::move(series));
+    return result;
+}
+
+bool SeriesStore::Append(const std::string& accountId, const SeriesSample& sample)
+{
+    Series* series = Load(accountId, true);
+    if (!series) return false;
+
+    if (sample.timeMs < series->lastMs)
+    {
+        m_dropped++;
+        return true;
+    }
+
+    // A block that could not be sealed earlier (file not growable) is retried first
+    if (series->open.size() >= SERIES_BLOCK_SAMPLES && !Seal(*series))
+    {
+        m_dropped++;
+        return false;
+    }
+
+    series->open.push_back(sample);
+    series->lastMs = sample.timeMs;
+    series->samples++;
+    m_appended++;
+    return series->open.size() < SERIES_BLOCK_SAMPLES || Seal(*series);
+}
+
+bool SeriesStore::Seal(Series& series)
+{
+    if (series.open.empty()) return true;
+
+    std::string encoded[SERIES_COLUMNS];
+    EncodeTimes(series.open, encoded[0]);
+    for (size_t column = 0; column < VALUE_COLUMNS; column++)
+    {
+        EncodeValues(series.open, column, encoded[column + 1]);
+    }
+
+    SeriesBlockHeader block = {};
+    block.magic = SERIES_BLOCK_MAGIC;
+    block.count = static_cast<uint32_t>(series.open.size());
+    block.firstMs = series.open.front().timeMs;
+    block.lastMs = series.open.back().timeMs;
+    block.equityMin = series.open.front().equity;
+    block.equityMax = series.open.front().equity;
+    for (const SeriesSample& sample : series.open)
+    {
+        block.equityMin = std::min(block.equityMin, sample.equity);
+        block.equityMax = std::max(block.equityMax, sample.equity);
+    }
+    uint64_t columnBytes = 0;
+    for (size_t column = 0; column < SERIES_COLUMNS; column++)
+    {
+        block.columnBytes[column] = static_cast<uint32_t>(encoded[column].size());
+        columnBytes += encoded[column].size();
+    }
+
+    uint64_t offset = FileHeader(series.file)->dataEnd;
+    uint64_t size = BlockSize(block);
+    if (offset + size > series.file.Size())
+    {
+        uint64_t grown = ((offset + size) / SERIES_GROW_BYTES + 1) * SERIES_GROW_BYTES;
+        if (!series.file.Grow(static_cast<size_t>(grown))) return false;
+    }
+
+    // Block first, then the header that makes it visible
+    char* out = series.file.Data() + offset;
+    std::memset(out, 0, static_cast<size_t>(size));
+    std::memcpy(out, &block, sizeof(block));
+    uint64_t position = sizeof(block);
+    for (size_t column = 0; column < SERIES_COLUMNS; column++)
+    {
+        std::memcpy(out + position, encoded[column].data(), encoded[column].size());
+        position += Align8(encoded[column].size());
+    }
+
+    SeriesFileHeader* header = FileHeader(series.file);
+    header->dataEnd = offset + size;
+    header->samples += block.count;
+    header->blocks++;
+
+    series.blocks.push_back(BlockIndex{ offset, block.firstMs, block.lastMs, block.count });
+    m_sealed++;
+    m_encodedBytes += columnBytes;
+    m_encodedSamples += block.count;
+    series.open.clear();
+    return true;
+}
+
+bool SeriesStore::Query(const std::string& accountId, int64_t fromMs, int64_t toMs, size_t maxPoints,
+                        std::vector<SeriesPoint>& points)
+{
+    points.clear();
+    m_queries++;
+    Series* series = Load(accountId, false);
+    if (!series) return false;
+    if (series->samples == 0 || fromMs > toMs) return true;
+
+    // Clamp to the data held so open-ended ranges still bucket sensibly
+    int64_t first = series->blocks.empty() ? series->open.front().timeMs : series->blocks.front().firstMs;
+    fromMs = std::max(fromMs, first);
+    toMs = std::min(toMs, series->lastMs);
+    if (fromMs > toMs) return true;
+
+    Downsampler downsampler(fromMs, toMs, maxPoints, points);
+    BlockColumns columns;
+
+    // First block that can overlap: blocks are in time order
+    auto begin = std::lower_bound(series->blocks.begin(), series->blocks.end(), fromMs,
+                                  [](const BlockIndex& block, int64_t time) { return block.lastMs < time; });
+    m_blocksSkipped += static_cast<uint64_t>(begin - series->blocks.begin());
+
+    for (auto block = begin; block != series->blocks.end(); ++block)
+    {
+        if (block->firstMs > toMs)
+        {
+            m_blocksSkipped += static_cast<uint64_t>(series->blocks.end() - block);
+            break;
+        }
+
+        uint32_t count = 0;
+        const char* data = series->file.Data() + block->offset;
+        if (!DecodeBlock(data, series->file.Size() - block->offset, columns, count)) return false;
+        m_blocksDecoded++;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            int64_t time = columns.times[i];
+            if (time < fromMs) continue;
+            if (time > toMs) break;
+            downsampler.Add(time, columns.values[0][i], columns.values[1][i],
+                            columns.values[2][i], columns.values[3][i]);
+        }
+    }
+
+    for (const SeriesSample& sample : series->open)
+    {
+        if (sample.timeMs < fromMs) continue;
+        if (sample.timeMs > toMs) break;
+        downsampler.Add(sample.timeMs, sample.balance, sample.equity, sample.margin, sample.floatingPnL);
+    }
+    return true;
+}
+
+std::string SeriesStore::QueryJson(const std::string& accountId, int64_t fromMs, int64_t toMs, size_t maxPoints)
+{
+    std::vector<SeriesPoint> points;
+    bool found = Query(accountId, fromMs, toMs, maxPoints, points);
+
+    uint64_t samples = 0;
+    for (const SeriesPoint& point : points) samples += point.samples;
+
+    std::string json = "{\"accountId\":";
+    AppendJsonString(json, accountId);
+    json += ",\"found\":";
+    json += found ? "true" : "false";
+    json += ",\"from\":";
+    AppendInt(json, fromMs);
+    json += ",\"to\":";
+    AppendInt(json, toMs);
+    json += ",\"samples\":";
+    AppendUInt(json, samples);
+    json += ",\"points\":[";
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        const SeriesPoint& point = points[i];
+        if (i > 0) json += ',';
+        json += "{\"t\":";
+        AppendInt(json, point.timeMs);
+        json += ",\"balance\":";
+        AppendFixed(json, point.balance, 2);
+        json += ",\"equity\":";
+        AppendFixed(json, point.equity, 2);
+        json += ",\"equityMin\":";
+        AppendFixed(json, point.equityMin, 2);
+        json += ",\"equityMax\":";
+        AppendFixed(json, point.equityMax, 2);
+        json += ",\"margin\":";
+        AppendFixed(json, point.margin, 2);
+        json += ",\"floatingPnL\":";
+        AppendFixed(json, point.floatingPnL, 2);
+        json += ",\"n\":";
+        AppendUInt(json, point.samples);
+        json += "}";
+    }
+    json += "]}";
+    return json;
+}
+
+void SeriesStore::Flush()
+{
+    for (auto& entry : m_series)
+    {
+        Seal(*entry.second);
+        entry.second->file.Flush();
+    }
+}
+
+void SeriesStore::Close()
+{
+    Flush();
+    m_series.clear();
+}
+
+std::string SeriesStore::StatsJson() const
+{
+    uint64_t samples = 0;
+    uint64_t blocks = 0;
+    uint64_t open = 0;
+    for (const auto& entry : m_series)
+    {
+        samples += entry.second->samples;
+        blocks += entry.second->blocks.size();
+        open += entry.second->open.size();
+    }
+
+    // Against the 40 bytes a raw sample takes (timestamp + four doubles)
+    double bytesPerSample = m_encodedSamples
+        ? static_cast<double>(m_encodedBytes) / static_cast<double>(m_encodedSamples) : 0.0;
+
+    std::string json = "{\"accounts\":";
+    AppendUInt(json, m_series.size());
+    json += ",\"samples\":";
+    AppendUInt(json, samples);
+    json += ",\"blocks\":";
+    AppendUInt(json, blocks);
+    json += ",\"openSamples\":";
+    AppendUInt(json, open);
+    json += ",\"appended\":";
+    AppendUInt(json, m_appended);
+    json += ",\"dropped\":";
+    AppendUInt(json, m_dropped);
+    json += ",\"sealed\":";
+    AppendUInt(json, m_sealed);
+    json += ",\"bytesPerSample\":";
+    AppendFixed(json, bytesPerSample, 2);
+    json += ",\"compressionRatio\":";
+    AppendFixed(json, bytesPerSample > 0.0 ? 40.0 / bytesPerSample : 0.0, 2);
+    json += ",\"queries\":";
+    AppendUInt(json, m_queries);
+    json += ",\"blocksSkipped\":";
+    AppendUInt(json, m_blocksSkipped);
+    json += ",\"blocksDecoded\":";
+    AppendUInt(json, m_blocksDecoded);
+    json += "}";
+    return json;
+}
+
+} // namespace hedgeedge
@@ -0,0 +1,165 @@
+// ============================================================================
+// Hedge Edge Equity Time Series
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Compressed, columnar store for account equity curves. Each account has
+// one memory-mapped file "<dir>/<accountId>.hets" of sealed blocks; a block
+// holds up to SERIES_BLOCK_SAMPLES heartbeat samples with every field in
+// its own column:
+//
+//   time     delta-of-delta, variable bit width (regular heartbeats cost
+//            one bit per sample)
+//   values   XOR against the previous value of the column, only the
+//            meaningful bits stored (an unchanged balance costs one bit)
+//
+// Block headers carry the time range and the equity min / max, so range
+// queries skip whole blocks without decoding them and downsample the rest
+// in a single streaming pass into at most `maxPoints` buckets.
+//
+// The block being filled stays in memory and is sealed when full, on
+// Flush() and on Close(); a crash loses at most that block. A file whose
+// tail is torn is truncated back to its last complete block on open.
+//
+// Not synchronized: owned by the thread that receives the heartbeats.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_SERIES_H
+#define HEDGE_EDGE_SERIES_H
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeShm.h"
+
+namespace hedgeedge {
+
+constexpr uint32_t SERIES_FILE_MAGIC    = 0x53544548; // "HETS"
+constexpr uint32_t SERIES_BLOCK_MAGIC   = 0x4B424548; // "HEBK"
+constexpr uint32_t SERIES_VERSION       = 1;
+constexpr size_t   SERIES_BLOCK_SAMPLES = 256;
+constexpr size_t   SERIES_COLUMNS       = 5;          // time + 4 values
+constexpr size_t   SERIES_GROW_BYTES    = 1024 * 1024;
+
+struct SeriesSample
+{
+    int64_t timeMs = 0;                     // Unix milliseconds
+    double  balance = 0.0;
+    double  equity = 0.0;
+    double  margin = 0.0;
+    double  floatingPnL = 0.0;
+};
+
+// One downsampled bucket: last values plus the equity range inside it
+struct SeriesPoint
+{
+    int64_t  timeMs = 0;                    // Last sample of the bucket
+    double   balance = 0.0;
+    double   equity = 0.0;
+    double   margin = 0.0;
+    double   floatingPnL = 0.0;
+    double   equityMin = 0.0;
+    double   equityMax = 0.0;
+    uint32_t samples = 0;
+};
+
+struct SeriesFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t dataEnd;                       // Offset one past the last sealed block
+    uint64_t samples;
+    uint64_t blocks;
+    char     accountId[32];
+};
+
+struct SeriesBlockHeader
+{
+    uint32_t magic;
+    uint32_t count;
+    int64_t  firstMs;
+    int64_t  lastMs;
+    double   equityMin;
+    double   equityMax;
+    uint32_t columnBytes[SERIES_COLUMNS];   // Encoded bytes per column (each 8-aligned on disk)
+    uint32_t reserved;
+};
+
+static_assert(sizeof(SeriesFileHeader) == 64, "series file header must stay 64 bytes");
+static_assert(sizeof(SeriesBlockHeader) == 64, "series block header must stay 64 bytes");
+
+class SeriesStore
+{
+public:
+    // Files live in `directory`, which is created if missing
+    explicit SeriesStore(std::string directory);
+    ~SeriesStore();
+
+    SeriesStore(const SeriesStore&) = delete;
+    SeriesStore& operator=(const SeriesStore&) = delete;
+
+    // Append one sample; samples older than the account's last are dropped.
+    // Returns false if the account file cannot be opened or grown.
+    bool Append(const std::string& accountId, const SeriesSample& sample);
+
+    // Samples of [fromMs, toMs], downsampled to at most `maxPoints` buckets
+    // of equal width (0 = every sample). Includes the unsealed block.
+    bool Query(const std::string& accountId, int64_t fromMs, int64_t toMs, size_t maxPoints,
+               std::vector<SeriesPoint>& points);
+
+    // {"accountId":..,"from":..,"to":..,"samples":..,"points":[...]}
+    std::string QueryJson(const std::string& accountId, int64_t fromMs, int64_t toMs, size_t maxPoints);
+
+    // Seal every open block and flush the files
+    void Flush();
+    void Close();
+
+    std::string StatsJson() const;
+
+private:
+    struct BlockIndex
+    {
+        uint64_t offset;
+        int64_t  firstMs;
+        int64_t  lastMs;
+        uint32_t count;
+    };
+
+    struct Series
+    {
+        std::string               accountId;
+        MappedFile                file;
+        std::vector<BlockIndex>   blocks;
+        std::vector<SeriesSample> open;     // Block being filled
+        int64_t                   lastMs = INT64_MIN;
+        uint64_t                  samples = 0;
+    };
+
+    Series* Load(const std::string& accountId, bool create);
+    bool    Seal(Series& series);
+
+    std::string m_directory;
+    std::map<std::string, std::unique_ptr<Series>> m_series;
+    uint64_t    m_appended = 0;
+    uint64_t    m_dropped = 0;
+    uint64_t    m_sealed = 0;
+    uint64_t    m_encodedBytes = 0;         // Column bytes of the blocks sealed by this process
+    uint64_t    m_encodedSamples = 0;
+    uint64_t    m_queries = 0;
+    uint64_t    m_blocksSkipped = 0;
+    uint64_t    m_blocksDecoded = 0;
+};
+
+// File name for an account: characters outside [A-Za-z0-9._-] become '_'
+std::string SeriesFileName(const std::string& accountId);
+
+} // namespace hedgeedge
+
+#endif // __cplusplus
+
+#endif // HEDGE_EDGE_SERIES_H
@@ -0,0 +1,870 @@
+// ============================================================================
+// Hedge Edge Shared-Memory Transport
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Single-writer / multi-reader byte ring in named shared memory.
+//
+// Protocol (one writer, no locks):
+//   1. Writer stores reservePos = pos + claim, then a release fence
+//   2. Writer copies the record (optionally a PAD record to wrap)
+//   3. Writer stores commitPos = pos + claim (release) and wakes readers
+// A reader copies a record at its cursor < commitPos and afterwards checks
+// reservePos; if the writer has claimed more than `capacity` bytes past the
+// cursor, the copy may be torn and the reader resynchronises to commitPos.
+// Lost records show up as gaps in the per-record sequence numbers.
+// ============================================================================
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <climits>
+    #include <fcntl.h>
+    #include <linux/futex.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeShm.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    inline uint64_t Align8(uint64_t value)
+    {
+        return (value + 7) & ~static_cast<uint64_t>(7);
+    }
+
+#ifdef _WIN32
+    std::wstring Widen(const std::string& text)
+    {
+        // Segment names are plain ASCII
+        return std::wstring(text.begin(), text.end());
+    }
+
+    std::wstring WidenUtf8(const std::string& text)
+    {
+        int length = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
+        if (length <= 0) return std::wstring();
+        std::wstring wide(static_cast<size_t>(length), L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, &wide[0], length);
+        return wide;
+    }
+
+    std::wstring ReaderEventName(const std::string& ringName, int slot)
+    {
+        return Widen(SharedObjectName(ringName) + ".r" + std::to_string(slot));
+    }
+#else
+    long Futex(std::atomic<uint32_t>* word, int op, uint32_t value, const timespec* timeout)
+    {
+        // Non-private futex: the word lives in memory shared between processes
+        return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), op, value, timeout, nullptr, 0);
+    }
+#endif
+
+    char* RingData(ShmRingHeader* header)
+    {
+        return reinterpret_cast<char*>(header) + sizeof(ShmRingHeader);
+    }
+
+} // namespace
+
+// ============================================================================
+// SharedSegment
+// ============================================================================
+
+std::string SharedObjectName(const std::string& name)
+{
+#ifdef _WIN32
+    return "Local\\" + name;
+#else
+    return "/" + name;
+#endif
+}
+
+SharedSegment::~SharedSegment()
+{
+    Close();
+}
+
+bool SharedSegment::Create(const std::string& name, size_t size, bool* created)
+{
+    Close();
+    bool existed = false;
+
+#ifdef _WIN32
+    std::wstring wideName = Widen(SharedObjectName(name));
+    HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+                                        static_cast<DWORD>(size & 0xFFFFFFFFu),
+                                        wideName.c_str());
+    if (!mapping) return false;
+    existed = (::GetLastError() == ERROR_ALREADY_EXISTS);
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    // An existing section keeps its original size; report what is mapped
+    MEMORY_BASIC_INFORMATION info = {};
+    VirtualQuery(view, &info, sizeof(info));
+    m_mapping = mapping;
+    m_data = view;
+    m_size = existed ? static_cast<size_t>(info.RegionSize) : size;
+#else
+    std::string objectName = SharedObjectName(name);
+    int fd = shm_open(objectName.c_str(), O_RDWR | O_CREAT, 0600);
+    if (fd < 0) return false;
+
+    struct stat st = {};
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    existed = st.st_size > 0;
+    if (static_cast<size_t>(st.st_size) < size)
+    {
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            close(fd);
+            return false;
+        }
+    }
+    else
+    {
+        size = static_cast<size_t>(st.st_size);
+    }
+
+    void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    m_data = view;
+    m_size = size;
+#endif
+
+    m_name = name;
+    if (created) *created = !existed;
+    return true;
+}
+
+bool SharedSegment::Open(const std::string& name)
+{
+    Close();
+
+#ifdef _WIN32
+    std::wstring wideName = Widen(SharedObjectName(name));
+    HANDLE mapping = OpenFileMappingW(FILE_MAP_ALL_ACCESS, FALSE, wideName.c_str());
+    if (!mapping) return false;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    MEMORY_BASIC_INFORMATION info = {};
+    VirtualQuery(view, &info, sizeof(info));
+    m_mapping = mapping;
+    m_data = view;
+    m_size = static_cast<size_t>(info.RegionSize);
+#else
+    std::string objectName = SharedObjectName(name);
+    int fd = shm_open(objectName.c_str(), O_RDWR, 0600);
+    if (fd < 0) return false;
+
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    m_data = view;
+    m_size = size;
+#endif
+
+    m_name = name;
+    return true;
+}
+
+void SharedSegment::Close(bool removeName)
+{
+    if (!m_data) return;
+
+#ifdef _WIN32
+    // Windows removes the section once the last handle closes
+    (void)removeName;
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+#else
+    munmap(m_data, m_size);
+    if (removeName)
+    {
+        shm_unlink(SharedObjectName(m_name).c_str());
+    }
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+// ============================================================================
+// MappedFile
+// ============================================================================
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::string& path, size_t minSize, bool* created)
+{
+    Close();
+    size_t size = 0;
+
+#ifdef _WIN32
+    std::wstring widePath = WidenUtf8(path);
+    if (widePath.empty()) return false;
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                              nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0) return false;
+
+    struct stat st = {};
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    m_fd = fd;
+    size = static_cast<size_t>(st.st_size);
+#endif
+
+    if (created) *created = (size == 0);
+    m_path = path;
+    if (!Map(size < minSize ? minSize : size))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::Map(size_t size)
+{
+    if (size == 0) return false;
+
+#ifdef _WIN32
+    // The section extends the file to `size` when it is larger
+    HANDLE mapping = CreateFileMappingW(static_cast<HANDLE>(m_file), nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+                                        static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+    if (!mapping) return false;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+    m_mapping = mapping;
+#else
+    struct stat st = {};
+    if (fstat(m_fd, &st) != 0) return false;
+    if (static_cast<size_t>(st.st_size) < size && ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+    {
+        return false;
+    }
+
+    void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (view == MAP_FAILED) return false;
+#endif
+
+    m_data = view;
+    m_size = size;
+    return true;
+}
+
+void MappedFile::Unmap()
+{
+    if (!m_data) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+#else
+    munmap(m_data, m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+bool MappedFile::Grow(size_t size)
+{
+    if (!m_data) return false;
+    if (size <= m_size) return true;
+
+    size_t previous = m_size;
+    Unmap();
+    if (Map(size)) return true;
+
+    // Keep the file usable at its old size
+    Map(previous);
+    return false;
+}
+
+bool MappedFile::Flush()
+{
+    if (!m_data) return false;
+
+#ifdef _WIN32
+    return FlushViewOfFile(m_data, 0) && FlushFileBuffers(static_cast<HANDLE>(m_file));
+#else
+    return msync(m_data, m_size, MS_SYNC) == 0;
+#endif
+}
+
+void MappedFile::Close()
+{
+    Unmap();
+
+#ifdef _WIN32
+    if (m_file)
+    {
+        CloseHandle(static_cast<HANDLE>(m_file));
+        m_file = nullptr;
+    }
+#else
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+#endif
+
+    m_path.clear();
+}
+
+// ============================================================================
+// ShmRingWriter
+// ============================================================================
+
+std::string ShmRingName(int port)
+{
+    return "HedgeEdge.Ring." + std::to_string(port);
+}
+
+bool ShmRingWriter::Create(const std::string& name, size_t capacityBytes)
+{
+    Close();
+
+    uint64_t capacity = 1;
+    while (capacity < capacityBytes) capacity <<= 1;
+
+    bool created = false;
+    if (!m_segment.Create(name, sizeof(ShmRingHeader) + capacity, &created))
+    {
+        return false;
+    }
+
+    // A section reused from a previous writer cannot grow on Windows; use
+    // the largest power of two that fits what is actually mapped.
+    uint64_t available = m_segment.Size() - sizeof(ShmRingHeader);
+    while (capacity > available) capacity >>= 1;
+    if (capacity < 4096)
+    {
+        m_segment.Close(true);
+        return false;
+    }
+
+    m_header = static_cast<ShmRingHeader*>(m_segment.Data());
+    if (created)
+    {
+        new (m_header) ShmRingHeader();
+    }
+
+    // Invalidate attached readers first, then publish the new layout
+    m_header->writerAlive.store(0, std::memory_order_release);
+    m_header->magic = SHM_RING_MAGIC;
+    m_header->version = SHM_RING_VERSION;
+    m_header->capacity = capacity;
+    m_header->generation = WallMicros();
+    m_header->writerPid = CurrentProcessId();
+    m_header->reservePos.store(0, std::memory_order_relaxed);
+    m_header->commitPos.store(0, std::memory_order_relaxed);
+    m_header->sequence.store(0, std::memory_order_relaxed);
+    m_header->writerAlive.store(1, std::memory_order_release);
+
+    m_ring = RingData(m_header);
+    m_capacity = capacity;
+    m_published = 0;
+    return true;
+}
+
+void ShmRingWriter::Close()
+{
+    if (!m_header) return;
+
+    m_header->writerAlive.store(0, std::memory_order_release);
+    WakeReaders();
+
+#ifdef _WIN32
+    for (auto& evt : m_events)
+    {
+        if (evt) CloseHandle(evt);
+        evt = nullptr;
+    }
+#endif
+
+    m_segment.Close(true);
+    m_header = nullptr;
+    m_ring = nullptr;
+    m_capacity = 0;
+}
+
+int ShmRingWriter::Publish(const char* topic, size_t topicLength, const char* data, size_t length)
+{
+    if (!m_header) return -1;
+    if (!data || length == 0 || topicLength > 0xFFFF) return -5;
+
+    uint64_t recordBytes = Align8(sizeof(ShmRecordHeader) + topicLength + length);
+    if (recordBytes > MaxMessage()) return -5;
+
+    uint64_t pos = m_header->commitPos.load(std::memory_order_relaxed);
+    uint64_t offset = pos & (m_capacity - 1);
+    uint64_t remaining = m_capacity - offset;
+    bool wrap = remaining < recordBytes;
+    uint64_t claim = wrap ? remaining + recordBytes : recordBytes;
+
+    // Claim before overwriting so readers can detect torn copies
+    m_header->reservePos.store(pos + claim, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (wrap)
+    {
+        // Readers skip a tail shorter than a header implicitly
+        if (remaining >= sizeof(ShmRecordHeader))
+        {
+            ShmRecordHeader pad = {};
+            pad.flags = SHM_RECORD_PAD;
+            std::memcpy(m_ring + offset, &pad, sizeof(pad));
+        }
+        offset = 0;
+    }
+
+    ShmRecordHeader record = {};
+    record.length = static_cast<uint32_t>(topicLength + length);
+    record.topicLength = static_cast<uint16_t>(topicLength);
+    record.sequence = m_header->sequence.load(std::memory_order_relaxed) + 1;
+    record.publishUs = WallMicros();
+
+    char* dst = m_ring + offset;
+    std::memcpy(dst, &record, sizeof(record));
+    if (topicLength) std::memcpy(dst + sizeof(record), topic, topicLength);
+    std::memcpy(dst + sizeof(record) + topicLength, data, length);
+
+    m_header->sequence.store(record.sequence, std::memory_order_relaxed);
+    m_header->commitPos.store(pos + claim, std::memory_order_release);
+    m_published++;
+
+    WakeReaders();
+    return 0;
+}
+
+void ShmRingWriter::WakeReaders()
+{
+#ifdef _WIN32
+    // Store (commitPos) then load (waitMask) against the reader's store
+    // (waitMask) then load (commitPos): only a full fence keeps both sides
+    // from missing each other
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t mask = m_header->waitMask.load(std::memory_order_seq_cst);
+    for (uint32_t slot = 0; mask != 0; ++slot, mask >>= 1)
+    {
+        if (!(mask & 1u)) continue;
+        if (!m_events[slot])
+        {
+            m_events[slot] = OpenEventW(EVENT_MODIFY_STATE, FALSE,
+                                        ReaderEventName(m_segment.Name(), static_cast<int>(slot)).c_str());
+        }
+        if (m_events[slot]) SetEvent(m_events[slot]);
+    }
+#else
+    m_header->wakeWord.fetch_add(1, std::memory_order_seq_cst);
+    if (m_header->waiters.load(std::memory_order_seq_cst) > 0)
+    {
+        Futex(&m_header->wakeWord, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+#endif
+}
+
+// ============================================================================
+// ShmRingReader
+// ============================================================================
+
+bool ShmRingReader::Attach(const std::string& name)
+{
+    Close();
+
+    if (!m_segment.Open(name)) return false;
+    if (m_segment.Size() < sizeof(ShmRingHeader))
+    {
+        m_segment.Close();
+        return false;
+    }
+
+    m_header = static_cast<ShmRingHeader*>(m_segment.Data());
+    if (m_header->magic != SHM_RING_MAGIC ||
+        m_header->version != SHM_RING_VERSION ||
+        m_header->writerAlive.load(std::memory_order_acquire) == 0 ||
+        sizeof(ShmRingHeader) + m_header->capacity > m_segment.Size())
+    {
+        m_header = nullptr;
+        m_segment.Close();
+        return false;
+    }
+
+    m_ring = RingData(m_header);
+    m_capacity = m_header->capacity;
+    m_generation = m_header->generation;
+    m_cursor = m_header->commitPos.load(std::memory_order_acquire);
+    m_lastSequence = m_header->sequence.load(std::memory_order_relaxed);
+    m_received = 0;
+    m_dropped = 0;
+
+#ifdef _WIN32
+    // Claim a wake-up slot, reclaiming slots of readers that died. The pid
+    // CAS from the value seen decides between two attaching readers; the
+    // loser rescans from the first slot (a bounded number of times).
+    uint32_t pid = CurrentProcessId();
+    int rescans = static_cast<int>(SHM_RING_MAX_READERS);
+    for (int slot = 0; slot < static_cast<int>(SHM_RING_MAX_READERS) && m_slot < 0; ++slot)
+    {
+        uint32_t bit = 1u << slot;
+        uint32_t mask = m_header->readerMask.load(std::memory_order_acquire);
+        uint32_t owner = m_header->readerPid[slot].load(std::memory_order_acquire);
+        if ((mask & bit) && IsProcessAlive(owner)) continue;
+        if ((mask & bit) || m_header->readerMask.compare_exchange_strong(mask, mask | bit))
+        {
+            if (m_header->readerPid[slot].compare_exchange_strong(owner, pid, std::memory_order_acq_rel))
+            {
+                m_slot = slot;
+                break;
+            }
+        }
+        if (rescans-- > 0) slot = -1;
+    }
+    if (m_slot >= 0)
+    {
+        m_event = CreateEventW(nullptr, FALSE, FALSE, ReaderEventName(name, m_slot).c_str());
+    }
+#endif
+
+    return true;
+}
+
+void ShmRingReader::Close()
+{
+    if (!m_header) return;
+
+#ifdef _WIN32
+    if (m_slot >= 0)
+    {
+        uint32_t bit = 1u << m_slot;
+        m_header->waitMask.fetch_and(~bit);
+        m_header->readerPid[m_slot].store(0, std::memory_order_relaxed);
+        m_header->readerMask.fetch_and(~bit);
+        m_slot = -1;
+    }
+    if (m_event)
+    {
+        CloseHandle(m_event);
+        m_event = nullptr;
+    }
+#endif
+
+    m_segment.Close();
+    m_header = nullptr;
+    m_ring = nullptr;
+}
+
+bool ShmRingReader::WriterAlive() const
+{
+    return m_header &&
+           m_header->writerAlive.load(std::memory_order_acquire) != 0 &&
+           !GenerationChanged() &&
+           IsProcessAlive(m_header->writerPid);
+}
+
+bool ShmRingReader::GenerationChanged() const
+{
+    return m_header && m_header->generation != m_generation;
+}
+
+void ShmRingReader::Wait(int timeoutMs)
+{
+#ifdef _WIN32
+    if (!m_event)
+    {
+        Sleep(static_cast<DWORD>(timeoutMs > 1 ? 1 : timeoutMs));
+        return;
+    }
+    uint32_t bit = 1u << m_slot;
+    m_header->waitMask.fetch_or(bit, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);    // Pairs with WakeReaders
+    if (m_header->commitPos.load(std::memory_order_seq_cst) == m_cursor)
+    {
+        WaitForSingleObject(m_event, static_cast<DWORD>(timeoutMs));
+    }
+    m_header->waitMask.fetch_and(~bit, std::memory_order_seq_cst);
+#else
+    uint32_t word = m_header->wakeWord.load(std::memory_order_seq_cst);
+    m_header->waiters.fetch_add(1, std::memory_order_seq_cst);
+    if (m_header->commitPos.load(std::memory_order_seq_cst) == m_cursor &&
+        m_header->writerAlive.load(std::memory_order_acquire) != 0)
+    {
+        timespec timeout = {};
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+        Futex(&m_header->wakeWord, FUTEX_WAIT, word, &timeout);
+    }
+    m_header->waiters.fetch_sub(1, std::memory_order_seq_cst);
+#endif
+}
+
+int ShmRingReader::Receive(char* topic, size_t topicCapacity, size_t* topicLength,
+                           char* data, size_t dataCapacity, int timeoutMs,
+                           uint64_t* publishUs)
+{
+    uint64_t deadline = timeoutMs > 0 ? NowMicros() + static_cast<uint64_t>(timeoutMs) * 1000 : 0;
+
+    for (;;)
+    {
+        if (!m_header || GenerationChanged()) return -1;
+
+        uint64_t commit = m_header->commitPos.load(std::memory_order_acquire);
+        if (m_cursor == commit)
+        {
+            uint64_t now = NowMicros();
+            if (now >= deadline || m_header->writerAlive.load(std::memory_order_acquire) == 0)
+            {
+                return 0;
+            }
+            int remainingMs = static_cast<int>((deadline - now + 999) / 1000);
+            // Spurious wake-ups just loop until the deadline
+            Wait(remainingMs);
+            continue;
+        }
+
+        // Lapped by the writer: everything up to commit is gone
+        if (commit - m_cursor > m_capacity)
+        {
+            m_cursor = commit;
+            continue;
+        }
+
+        uint64_t offset = m_cursor & (m_capacity - 1);
+        uint64_t remaining = m_capacity - offset;
+        if (remaining < sizeof(ShmRecordHeader))
+        {
+            m_cursor += remaining;
+            continue;
+        }
+
+        ShmRecordHeader record;
+        std::memcpy(&record, m_ring + offset, sizeof(record));
+
+        uint64_t recordBytes = Align8(sizeof(ShmRecordHeader) + record.length);
+        bool isPad = (record.flags & SHM_RECORD_PAD) != 0;
+        bool valid = isPad ||
+                     (record.topicLength <= record.length &&
+                      recordBytes <= remaining &&
+                      recordBytes <= MaxMessage());
+
+        size_t payloadLength = valid && !isPad ? record.length - record.topicLength : 0;
+        bool fits = valid && !isPad &&
+                    record.topicLength < topicCapacity &&
+                    payloadLength <= dataCapacity;
+        if (fits)
+        {
+            const char* src = m_ring + offset + sizeof(ShmRecordHeader);
+            std::memcpy(topic, src, record.topicLength);
+            std::memcpy(data, src + record.topicLength, payloadLength);
+        }
+
+        // Seqlock-style validation: was the record overwritten while copying?
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t reserve = m_header->reservePos.load(std::memory_order_relaxed);
+        if (reserve - m_cursor > m_capacity || !valid)
+        {
+            m_cursor = m_header->commitPos.load(std::memory_order_acquire);
+            continue;
+        }
+
+        if (isPad)
+        {
+            m_cursor += remaining;
+            continue;
+        }
+
+        if (record.sequence > m_lastSequence + 1)
+        {
+            m_dropped += record.sequence - m_lastSequence - 1;
+        }
+        m_lastSequence = record.sequence;
+        m_cursor += recordBytes;
+
+        if (!fits) return -5;
+
+        topic[record.topicLength] = '\0';
+        if (topicLength) *topicLength = record.topicLength;
+        if (publishUs) *publishUs = record.publishUs;
+        m_received++;
+        return static_cast<int>(payloadLength);
+    }
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    struct RingHandle
+    {
+        std::unique_ptr<hedgeedge::ShmRingWriter> writer;
+        std::unique_ptr<hedgeedge::ShmRingReader> reader;
+    };
+
+    hedgeedge::HandleTable<RingHandle> g_rings;
+
+    const int MIN_CAPACITY_KB = 256;
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall ShmRingCreate(int port, int capacityKB)
+{
+    if (port <= 0) return -5;
+    if (capacityKB < MIN_CAPACITY_KB) capacityKB = MIN_CAPACITY_KB;
+
+    auto ring = std::make_shared<RingHandle>();
+    ring->writer.reset(new hedgeedge::ShmRingWriter());
+    if (!ring->writer->Create(hedgeedge::ShmRingName(port),
+                              static_cast<size_t>(capacityKB) * 1024))
+    {
+        return -1;
+    }
+    return g_rings.Add(std::move(ring));
+}
+
+HEDGEEDGE_API int __stdcall ShmRingPublish(int handle, const char* topic, int topicLen,
+                                           const char* data, int dataLen)
+{
+    auto ring = g_rings.Get(handle);
+    if (!ring || !ring->writer) return -1;
+    if (topicLen < 0 || dataLen <= 0 || (topicLen > 0 && !topic)) return -5;
+
+    return ring->writer->Publish(topic, static_cast<size_t>(topicLen),
+                                 data, static_cast<size_t>(dataLen));
+}
+
+HEDGEEDGE_API int __stdcall ShmRingAttach(int port)
+{
+    if (port <= 0) return -5;
+
+    auto ring = std::make_shared<RingHandle>();
+    ring->reader.reset(new hedgeedge::ShmRingReader());
+    if (!ring->reader->Attach(hedgeedge::ShmRingName(port)))
+    {
+        return -1;
+    }
+    return g_rings.Add(std::move(ring));
+}
+
+HEDGEEDGE_API int __stdcall ShmRingReceive(int handle, char* outTopic, int topicLen,
+                                           char* outData, int dataLen, int timeoutMs)
+{
+    auto ring = g_rings.Get(handle);
+    if (!ring || !ring->reader) return -1;
+    if (!outTopic || topicLen <= 0 || !outData || dataLen <= 0) return -5;
+
+    return ring->reader->Receive(outTopic, static_cast<size_t>(topicLen), nullptr,
+                                 outData, static_cast<size_t>(dataLen), timeoutMs);
+}
+
+HEDGEEDGE_API int __stdcall ShmRingWriterAlive(int handle)
+{
+    auto ring = g_rings.Get(handle);
+    if (!ring || !ring->reader) return 0;
+    return ring->reader->WriterAlive() ? 1 : 0;
+}
+
+HEDGEEDGE_API int __stdcall ShmRingMaxMessage(int handle)
+{
+    auto ring = g_rings.Get(handle);
+    if (!ring) return 0;
+    if (ring->writer) return static_cast<int>(ring->writer->MaxMessage());
+    if (ring->reader) return static_cast<int>(ring->reader->MaxMessage());
+    return 0;
+}
+
+HEDGEEDGE_API long long __stdcall ShmRingDropped(int handle)
+{
+    auto ring = g_rings.Get(handle);
+    if (!ring || !ring->reader) return 0;
+    return static_cast<long long>(ring->reader->Dropped());
+}
+
+HEDGEEDGE_API void __stdcall ShmRingClose(int handle)
+{
+    // Ring is destroyed (and unmapped) when the last in-flight call releases it
+    g_rings.Remove(handle);
+}
+
+} // extern "C"
@@ -0,0 +1,331 @@
+// ============================================================================
+// Hedge Edge Shared-Memory Transport
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Same-host transport between HE_Prop (single writer) and any number of
+// HE_Hedge readers. Messages are published into a named shared-memory byte
+// ring with per-record sequence numbers; readers are woken through a futex
+// (Linux) or a per-reader named event (Windows). ZMQ TCP remains the
+// fallback whenever the ring is not available.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_SHM_H
+#define HEDGE_EDGE_SHM_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace hedgeedge {
+
+// ============================================================================
+// Named Shared Memory Segment
+// ============================================================================
+// Thin RAII wrapper over CreateFileMapping (Windows) and shm_open (POSIX).
+// Names are given without platform prefix, e.g. "HedgeEdge.Ring.51810".
+
+class SharedSegment
+{
+public:
+    SharedSegment() = default;
+    ~SharedSegment();
+
+    SharedSegment(const SharedSegment&) = delete;
+    SharedSegment& operator=(const SharedSegment&) = delete;
+
+    // Create (or reuse) a segment of at least `size` bytes. Returns false on
+    // failure. `created` reports whether the segment did not exist before.
+    bool Create(const std::string& name, size_t size, bool* created = nullptr);
+
+    // Map an existing segment in full. Returns false if it does not exist.
+    bool Open(const std::string& name);
+
+    // Unmap; the owner may also remove the name so new readers cannot attach.
+    void Close(bool removeName = false);
+
+    void*  Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+    bool   IsOpen() const { return m_data != nullptr; }
+    const std::string& Name() const { return m_name; }
+
+private:
+    std::string m_name;
+    void*       m_data = nullptr;
+    size_t      m_size = 0;
+#ifdef _WIN32
+    void*       m_mapping = nullptr;
+#endif
+};
+
+// Platform object name for a segment ("Local\\..." on Windows, "/..." on POSIX)
+std::string SharedObjectName(const std::string& name);
+
+// ============================================================================
+// Memory-Mapped File
+// ============================================================================
+// A file on disk mapped read/write in full. Grow() extends the file and
+// remaps it, so pointers into Data() are invalid afterwards. Paths are UTF-8.
+
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Open (or create) `path` and map at least `minSize` bytes. `created`
+    // reports whether the file was new or empty.
+    bool Open(const std::string& path, size_t minSize, bool* created = nullptr);
+
+    // Extend the file to `size` bytes and remap; no-op if already that large
+    bool Grow(size_t size);
+
+    // Write dirty pages back to the file
+    bool Flush();
+
+    void Close();
+
+    char*  Data() const { return static_cast<char*>(m_data); }
+    size_t Size() const { return m_size; }
+    bool   IsOpen() const { return m_data != nullptr; }
+    const std::string& Path() const { return m_path; }
+
+private:
+    bool Map(size_t size);
+    void Unmap();
+
+    std::string m_path;
+    void*       m_data = nullptr;
+    size_t      m_size = 0;
+#ifdef _WIN32
+    void*       m_file = nullptr;
+    void*       m_mapping = nullptr;
+#else
+    int         m_fd = -1;
+#endif
+};
+
+// ============================================================================
+// Ring Layout
+// ============================================================================
+
+constexpr uint32_t SHM_RING_MAGIC       = 0x48455247; // "HERG"
+constexpr uint32_t SHM_RING_VERSION     = 1;
+constexpr uint32_t SHM_RING_MAX_READERS = 32;
+constexpr uint16_t SHM_RECORD_PAD       = 0x0001;
+
+struct alignas(64) ShmRingHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;                          // Data bytes (power of two)
+    uint64_t generation;                        // Changes every time a writer (re)creates the ring
+    uint32_t writerPid;
+    std::atomic<uint32_t> writerAlive;
+
+    alignas(64) std::atomic<uint64_t> reservePos; // Bytes claimed by the writer
+    std::atomic<uint64_t> commitPos;              // Bytes visible to readers
+    std::atomic<uint64_t> sequence;               // Last committed record sequence
+
+    alignas(64) std::atomic<uint32_t> wakeWord;   // Futex word (bumped per publish)
+    std::atomic<uint32_t> waiters;                // Readers blocked on the futex
+    std::atomic<uint32_t> readerMask;             // Windows: allocated reader slots
+    std::atomic<uint32_t> waitMask;               // Windows: readers waiting on their event
+    std::atomic<uint32_t> readerPid[SHM_RING_MAX_READERS]; // Claimed by CAS
+};
+
+struct ShmRecordHeader
+{
+    uint32_t length;        // Topic + payload bytes
+    uint16_t topicLength;
+    uint16_t flags;
+    uint64_t sequence;
+    uint64_t publishUs;     // WallMicros() at publish time
+};
+
+// Segment name for a master data port
+std::string ShmRingName(int port);
+
+// ============================================================================
+// Ring Writer (HE_Prop)
+// ============================================================================
+
+class ShmRingWriter
+{
+public:
+    ~ShmRingWriter() { Close(); }
+
+    bool Create(const std::string& name, size_t capacityBytes);
+    void Close();
+
+    // Publish one message. Returns 0 on success, -5 if the message can never
+    // fit (larger than a quarter of the ring), -1 if not created.
+    int Publish(const char* topic, size_t topicLength, const char* data, size_t length);
+
+    size_t   MaxMessage() const { return m_capacity / 4; }
+    uint64_t Published() const  { return m_published; }
+
+private:
+    void WakeReaders();
+
+    SharedSegment  m_segment;
+    ShmRingHeader* m_header = nullptr;
+    char*          m_ring = nullptr;
+    uint64_t       m_capacity = 0;
+    uint64_t       m_published = 0;
+#ifdef _WIN32
+    void*          m_events[SHM_RING_MAX_READERS] = {};
+#endif
+};
+
+// ============================================================================
+// Ring Reader (HE_Hedge, tools)
+// ============================================================================
+
+class ShmRingReader
+{
+public:
+    ~ShmRingReader() { Close(); }
+
+    bool Attach(const std::string& name);
+    void Close();
+
+    // Receive the next message. Returns payload length (>0), 0 when nothing
+    // arrived within `timeoutMs`, -1 if detached, -5 if the caller buffers
+    // were too small (message skipped). Overruns resynchronise silently and
+    // are counted in Dropped().
+    int Receive(char* topic, size_t topicCapacity, size_t* topicLength,
+                char* data, size_t dataCapacity, int timeoutMs,
+                uint64_t* publishUs = nullptr);
+
+    bool     WriterAlive() const;
+    bool     GenerationChanged() const;
+    size_t   MaxMessage() const { return m_capacity / 4; }
+    uint64_t Received() const   { return m_received; }
+    uint64_t Dropped() const    { return m_dropped; }
+
+private:
+    void Wait(int timeoutMs);
+
+    SharedSegment  m_segment;
+    ShmRingHeader* m_header = nullptr;
+    const char*    m_ring = nullptr;
+    uint64_t       m_capacity = 0;
+    uint64_t       m_generation = 0;
+    uint64_t       m_cursor = 0;
+    uint64_t       m_lastSequence = 0;
+    uint64_t       m_received = 0;
+    uint64_t       m_dropped = 0;
+#ifdef _WIN32
+    int            m_slot = -1;
+    void*          m_event = nullptr;
+#endif
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Return Codes (in addition to HedgeEdgeLicense.h)
+// ============================================================================
+//
+//  >0 = Handle / byte count
+//   0 = Success / no message
+//  -1 = Handle not open or ring not available
+//  -5 = Parameter error or buffer too small
+//
+// ============================================================================
+
+// ============================================================================
+// Writer (Master EA)
+// ============================================================================
+
+/**
+ * Create the shared-memory ring for a master data port.
+ *
+ * @param port        Master PUB port (ring is named after it)
+ * @param capacityKB  Ring size in KB (rounded up to a power of two, min 256)
+ *
+ * @return Handle (>0) on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall ShmRingCreate(int port, int capacityKB);
+
+/**
+ * Publish a message into the ring.
+ *
+ * @param handle  Writer handle from ShmRingCreate
+ * @param topic   Topic bytes (UTF-8, e.g. "EVENT")
+ * @param topicLen Topic length in bytes
+ * @param data    Payload bytes (UTF-8 JSON)
+ * @param dataLen Payload length in bytes
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall ShmRingPublish(int handle, const char* topic, int topicLen,
+                                           const char* data, int dataLen);
+
+// ============================================================================
+// Reader (Slave EA)
+// ============================================================================
+
+/**
+ * Attach to the ring published by a master on the same host.
+ *
+ * @param port  Master PUB port
+ *
+ * @return Handle (>0) on success, -1 if no ring exists for that port
+ */
+HEDGEEDGE_API int __stdcall ShmRingAttach(int port);
+
+/**
+ * Receive the next message.
+ *
+ * @param handle     Reader handle from ShmRingAttach
+ * @param outTopic   Buffer for the topic (null-terminated)
+ * @param topicLen   Size of the topic buffer
+ * @param outData    Buffer for the payload (not null-terminated)
+ * @param dataLen    Size of the payload buffer
+ * @param timeoutMs  0 = poll, >0 = block up to this long for a message
+ *
+ * @return Payload length (>0), 0 if none, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall ShmRingReceive(int handle, char* outTopic, int topicLen,
+                                           char* outData, int dataLen, int timeoutMs);
+
+/**
+ * Check whether the ring's writer process is alive and has not restarted
+ * since this reader attached.
+ *
+ * @return 1 if alive, 0 otherwise
+ */
+HEDGEEDGE_API int __stdcall ShmRingWriterAlive(int handle);
+
+/**
+ * Largest payload the ring accepts (size receive buffers with this).
+ */
+HEDGEEDGE_API int __stdcall ShmRingMaxMessage(int handle);
+
+/**
+ * Messages this reader lost to ring overruns since attaching.
+ */
+HEDGEEDGE_API long long __stdcall ShmRingDropped(int handle);
+
+/**
+ * Close a writer or reader handle.
+ */
+HEDGEEDGE_API void __stdcall ShmRingClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_SHM_H
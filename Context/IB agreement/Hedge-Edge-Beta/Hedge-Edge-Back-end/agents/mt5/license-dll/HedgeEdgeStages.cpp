@@ -0,0 +1,208 @@
+// ============================================================================
+// Hedge Edge Pipeline Stage Timers
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <cstring>
+#include <memory>
+
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeJson.h"
+#include "HedgeEdgeStages.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// StageTimers
+// ============================================================================
+
+int StageTimers::AddStage(const std::string& label, uint64_t outlierNs)
+{
+    for (size_t i = 0; i < m_stages.size(); i++)
+    {
+        if (m_stages[i].label == label) return static_cast<int>(i);
+    }
+    if (m_stages.size() >= MAX_STAGES) return -1;
+
+    m_stages.emplace_back();
+    m_stages.back().label = label;
+    m_stages.back().outlierNs = outlierNs;
+    m_stages.back().windows = std::make_unique<WindowedHistogram>();
+    return static_cast<int>(m_stages.size()) - 1;
+}
+
+void StageTimers::Begin(int stage)
+{
+    if (stage < 0 || stage >= static_cast<int>(m_stages.size())) return;
+    m_stages[stage].startNs = NowNanos();
+}
+
+uint64_t StageTimers::End(int stage)
+{
+    if (stage < 0 || stage >= static_cast<int>(m_stages.size())) return 0;
+
+    Stage& timed = m_stages[stage];
+    if (timed.startNs == 0) return 0;
+
+    uint64_t end = NowNanos();
+    uint64_t duration = end - timed.startNs;
+    timed.durations.Record(duration);
+    timed.windows->Record(duration, end / 1000);
+    if (timed.outlierNs > 0 && duration >= timed.outlierNs)
+    {
+        timed.outliers++;
+        timed.lastOutlierWallUs = WallMicros();
+    }
+    return duration;
+}
+
+std::string StageTimers::StatsJson() const
+{
+    std::string json = "{\"name\":";
+    AppendJsonString(json, m_name);
+    json += ",\"unit\":\"ns\",\"stages\":{";
+    for (size_t i = 0; i < m_stages.size(); i++)
+    {
+        const Stage& stage = m_stages[i];
+        if (i) json += ",";
+        AppendJsonString(json, stage.label);
+        json += ":";
+
+        std::string histogram = stage.durations.Json();
+        histogram.pop_back();
+        json += histogram;
+        json += ",\"outliers\":";
+        AppendUInt(json, stage.outliers);
+        json += ",\"outlierNs\":";
+        AppendUInt(json, stage.outlierNs);
+        json += ",\"lastOutlierAtUs\":";
+        AppendUInt(json, stage.lastOutlierWallUs);
+        json += "}";
+    }
+    json += "}}";
+    return json;
+}
+
+std::string StageTimers::WindowsJson() const
+{
+    uint64_t nowUs = NowMicros();
+    std::string json = "{\"unit\":\"ns\",\"stages\":{";
+    for (size_t i = 0; i < m_stages.size(); i++)
+    {
+        if (i) json += ",";
+        AppendJsonString(json, m_stages[i].label);
+        json += ":";
+        json += m_stages[i].windows->WindowsJson(nowUs);
+    }
+    json += "}}";
+    return json;
+}
+
+double StageTimers::WindowMean(int stage, uint64_t spanUs) const
+{
+    if (stage < 0 || stage >= static_cast<int>(m_stages.size())) return 0.0;
+
+    Histogram window;
+    m_stages[stage].windows->Window(spanUs, NowMicros(), window);
+    return window.Mean();
+}
+
+void StageTimers::Reset()
+{
+    for (Stage& stage : m_stages)
+    {
+        stage.durations.Reset();
+        stage.windows->Reset();
+        stage.outliers = 0;
+        stage.lastOutlierWallUs = 0;
+    }
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    hedgeedge::HandleTable<hedgeedge::StageTimers> g_stageTimers;
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall StageTimersCreate(const char* name)
+{
+    return g_stageTimers.Add(std::make_shared<hedgeedge::StageTimers>(name ? name : ""));
+}
+
+HEDGEEDGE_API int __stdcall StageTimersAdd(int handle, const char* label, int outlierUs)
+{
+    auto timers = g_stageTimers.Get(handle);
+    if (!timers) return -1;
+    if (!label || !*label || outlierUs < 0) return -5;
+
+    int id = timers->AddStage(label, static_cast<uint64_t>(outlierUs) * 1000);
+    return id >= 0 ? id : -5;
+}
+
+HEDGEEDGE_API void __stdcall StageBegin(int handle, int stage)
+{
+    auto timers = g_stageTimers.Get(handle);
+    if (timers) timers->Begin(stage);
+}
+
+HEDGEEDGE_API long long __stdcall StageEnd(int handle, int stage)
+{
+    auto timers = g_stageTimers.Get(handle);
+    return timers ? static_cast<long long>(timers->End(stage)) : 0;
+}
+
+HEDGEEDGE_API int __stdcall StageTimersStats(int handle, char* outJson, int jsonLen)
+{
+    auto timers = g_stageTimers.Get(handle);
+    if (!timers) return -1;
+    if (!outJson || jsonLen <= 0) return -5;
+
+    std::string json = timers->StatsJson();
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API int __stdcall StageTimersWindows(int handle, char* outJson, int jsonLen)
+{
+    auto timers = g_stageTimers.Get(handle);
+    if (!timers) return -1;
+    if (!outJson || jsonLen <= 0) return -5;
+
+    std::string json = timers->WindowsJson();
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API double __stdcall StageWindowMean(int handle, int stage, int windowSeconds)
+{
+    auto timers = g_stageTimers.Get(handle);
+    if (!timers || windowSeconds <= 0 || windowSeconds > 3600) return 0.0;
+    return timers->WindowMean(stage, static_cast<uint64_t>(windowSeconds) * 1000000);
+}
+
+HEDGEEDGE_API void __stdcall StageTimersReset(int handle)
+{
+    auto timers = g_stageTimers.Get(handle);
+    if (timers) timers->Reset();
+}
+
+HEDGEEDGE_API void __stdcall StageTimersClose(int handle)
+{
+    g_stageTimers.Remove(handle);
+}
+
+} // extern "C"
@@ -0,0 +1,155 @@
+// ============================================================================
+// Hedge Edge Pipeline Stage Timers
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Splits the time an EA spends on one copy into named stages (queueing,
+// JSON extraction, lot sizing, OrderSend, map updates, ...). The EA brackets
+// each stage with Begin / End; End records the elapsed nanoseconds into the
+// stage's histogram and counts it as an outlier past the stage's threshold.
+//
+// Stages may nest and overlap: each keeps its own start time. End may be
+// called more than once per Begin and then records the time since that same
+// Begin, which measures queueing: Begin at the start of a drain pass, End as
+// each message is picked up.
+//
+// Besides the lifetime histogram every stage keeps sliding 1 min / 15 min /
+// 1 h windows, which is what snapshots and status responses report: a
+// lifetime aggregate flattens a spike that happened five minutes ago.
+//
+// Single-threaded: every call comes from the owning EA thread.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_STAGES_H
+#define HEDGE_EDGE_STAGES_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeHistogram.h"
+
+namespace hedgeedge {
+
+class StageTimers
+{
+public:
+    static constexpr int MAX_STAGES = 32;
+
+    explicit StageTimers(const std::string& name) : m_name(name) {}
+
+    // Register a stage once; returns its id or -1 if the table is full.
+    // Durations of at least `outlierNs` count as outliers (0 = none).
+    int AddStage(const std::string& label, uint64_t outlierNs);
+
+    void Begin(int stage);
+
+    // Records the time since the stage's last Begin; returns it in
+    // nanoseconds (0 if the stage was never begun)
+    uint64_t End(int stage);
+
+    // {"name":..,"unit":"ns","stages":{"<label>":{histogram,"outliers":N,
+    //   "outlierNs":T,"lastOutlierAtUs":W},...}}
+    std::string StatsJson() const;
+
+    // {"unit":"ns","stages":{"<label>":{"1m":{..},"15m":{..},"1h":{..}},...}}
+    std::string WindowsJson() const;
+
+    // Mean of the last `spanUs` in nanoseconds (0 if empty or unknown stage)
+    double WindowMean(int stage, uint64_t spanUs) const;
+
+    void Reset();
+
+private:
+    struct Stage
+    {
+        std::string label;
+        uint64_t    outlierNs = 0;
+        uint64_t    startNs = 0;            // 0 = not begun
+        Histogram   durations;
+        std::unique_ptr<WindowedHistogram> windows;
+        uint64_t    outliers = 0;
+        uint64_t    lastOutlierWallUs = 0;
+    };
+
+    std::string        m_name;
+    std::vector<Stage> m_stages;
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Stage Timers
+// ============================================================================
+
+/**
+ * Create a stage timer set for one EA.
+ *
+ * @param name  Null-terminated name, e.g. "HE_Hedge"
+ *
+ * @return Handle (>0) on success
+ */
+HEDGEEDGE_API int __stdcall StageTimersCreate(const char* name);
+
+/**
+ * Register a stage (call once per stage at init).
+ *
+ * @param label      Null-terminated stage name, e.g. "orderSend"
+ * @param outlierUs  Durations from this many microseconds on count as
+ *                   outliers (0 = none)
+ *
+ * @return Stage id (>=0), -1 if not open, -5 if the stage table is full
+ */
+HEDGEEDGE_API int __stdcall StageTimersAdd(int handle, const char* label, int outlierUs);
+
+/**
+ * Mark the start / end of a stage on the EA thread. StageEnd returns the
+ * stage's duration in nanoseconds (0 if not begun or not open).
+ */
+HEDGEEDGE_API void __stdcall StageBegin(int handle, int stage);
+HEDGEEDGE_API long long __stdcall StageEnd(int handle, int stage);
+
+/**
+ * Per-stage histograms (nanoseconds) and outlier counts.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall StageTimersStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Per-stage 1m / 15m / 1h windows (nanoseconds): count, p50, p99, p999,
+ * max and mean of each.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall StageTimersWindows(int handle, char* outJson, int jsonLen);
+
+/**
+ * Mean duration of a stage over the last `windowSeconds` (1..3600), in
+ * nanoseconds. 0 if the window is empty or the handle / stage is unknown.
+ */
+HEDGEEDGE_API double __stdcall StageWindowMean(int handle, int stage, int windowSeconds);
+
+/**
+ * Clear histograms and outlier counts (stages stay registered).
+ */
+HEDGEEDGE_API void __stdcall StageTimersReset(int handle);
+
+/**
+ * Close a stage timer handle.
+ */
+HEDGEEDGE_API void __stdcall StageTimersClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_STAGES_H
@@ -0,0 +1,1555 @@
+// ============================================================================
+// Hedge Edge Native ZMQ Transport
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeTransport.h"
+#include "HedgeEdgeZmq.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const int LINGER_MS = 100;
+
+    void SetError(std::string* error, const std::string& what)
+    {
+        if (error) *error = what + ": " + ZmqLastError();
+    }
+
+    bool SetString(void* socket, int option, const std::string& value)
+    {
+        return Zmq()->setsockopt(socket, option, value.data(), value.size()) == 0;
+    }
+
+    void AppendStats(std::string& json, const std::map<std::string, TopicStats>& stats)
+    {
+        json += "\"topics\":{";
+        bool first = true;
+        for (const auto& entry : stats)
+        {
+            if (!first) json += ",";
+            first = false;
+            const TopicStats& s = entry.second;
+            json += "\"" + entry.first + "\":{";
+            json += "\"messages\":" + std::to_string(s.messages);
+            json += ",\"compressed\":" + std::to_string(s.compressed);
+            json += ",\"rawBytes\":" + std::to_string(s.rawBytes);
+            json += ",\"wireBytes\":" + std::to_string(s.wireBytes);
+            json += ",\"errors\":" + std::to_string(s.errors);
+            json += ",\"dropped\":" + std::to_string(s.dropped);
+            json += "}";
+        }
+        json += "}";
+    }
+
+    void CloseSocket(void*& context, void*& socket)
+    {
+        if (socket) Zmq()->close(socket);
+        if (context) Zmq()->ctx_term(context);
+        socket = nullptr;
+        context = nullptr;
+    }
+
+    // XPUB / ROUTER bound on tcp://*:port, or nullptr
+    void* BindServer(void* context, int type, int port, const std::string& curveSecretKey, int sndHwm,
+                     std::string* error)
+    {
+        void* socket = Zmq()->socket(context, type);
+        if (!socket)
+        {
+            SetError(error, type == ZMQ_ROUTER ? "ROUTER socket" : "XPUB socket");
+            return nullptr;
+        }
+
+        ZmqSetInt(socket, ZMQ_LINGER, LINGER_MS);
+        ZmqSetInt(socket, ZMQ_SNDHWM, sndHwm);
+        if (!curveSecretKey.empty())
+        {
+            if (!ZmqSetInt(socket, ZMQ_CURVE_SERVER, 1) ||
+                !SetString(socket, ZMQ_CURVE_SECRETKEY, curveSecretKey))
+            {
+                SetError(error, "CURVE server key");
+                Zmq()->close(socket);
+                return nullptr;
+            }
+        }
+
+        std::string endpoint = "tcp://*:" + std::to_string(port);
+        if (Zmq()->bind(socket, endpoint.c_str()) != 0)
+        {
+            SetError(error, "bind " + endpoint);
+            Zmq()->close(socket);
+            return nullptr;
+        }
+        return socket;
+    }
+
+    // SUB / DEALER connected to `endpoint` with optional CURVE client keys, or nullptr
+    void* ConnectClient(void* context, int type, const std::string& endpoint, const std::string& serverKey,
+                        const std::string& clientPublicKey, const std::string& clientSecretKey,
+                        int rcvHwm, std::string* error)
+    {
+        void* socket = Zmq()->socket(context, type);
+        if (!socket)
+        {
+            SetError(error, type == ZMQ_DEALER ? "DEALER socket" : "SUB socket");
+            return nullptr;
+        }
+
+        ZmqSetInt(socket, ZMQ_LINGER, LINGER_MS);
+        ZmqSetInt(socket, ZMQ_RCVHWM, rcvHwm);
+        if (!serverKey.empty())
+        {
+            if (!SetString(socket, ZMQ_CURVE_SERVERKEY, serverKey) ||
+                !SetString(socket, ZMQ_CURVE_PUBLICKEY, clientPublicKey) ||
+                !SetString(socket, ZMQ_CURVE_SECRETKEY, clientSecretKey))
+            {
+                SetError(error, "CURVE client keys");
+                Zmq()->close(socket);
+                return nullptr;
+            }
+        }
+
+        if (Zmq()->connect(socket, endpoint.c_str()) != 0)
+        {
+            SetError(error, "connect " + endpoint);
+            Zmq()->close(socket);
+            return nullptr;
+        }
+        return socket;
+    }
+
+    // Bound on indices whose copy from the other stream never arrived (HWM drop)
+    const int64_t MAX_PENDING_INDICES = 4096;
+
+    // Monitored port: acknowledge every N messages, after a short delay, and
+    // as a keepalive (a restarted master answers an unknown id with BYE)
+    const uint64_t ACK_EVERY = 32;
+    const uint64_t ACK_DELAY_US = 100000;
+    const uint64_t ACK_KEEPALIVE_US = 1000000;
+    const uint64_t STUCK_EVICT_US = 5000000;   // Lagging and silent this long
+    const size_t   MAX_LAG_ALERTS = 256;
+    const size_t   MAX_FAREWELLS = 1024;
+
+    std::string HexId(const std::string& id)
+    {
+        static const char DIGITS[] = "0123456789abcdef";
+        std::string hex;
+        for (unsigned char c : id)
+        {
+            hex += DIGITS[c >> 4];
+            hex += DIGITS[c & 15];
+        }
+        return hex;
+    }
+
+    bool StartsWith(const char* data, size_t length, const char* prefix)
+    {
+        size_t prefixLength = std::strlen(prefix);
+        return length >= prefixLength && std::memcmp(data, prefix, prefixLength) == 0;
+    }
+
+} // namespace
+
+std::vector<std::string> SplitTopics(const std::string& csv)
+{
+    std::vector<std::string> topics;
+    size_t start = 0;
+    while (start <= csv.size())
+    {
+        size_t end = csv.find(',', start);
+        if (end == std::string::npos) end = csv.size();
+
+        size_t first = csv.find_first_not_of(" \t", start);
+        size_t last = csv.find_last_not_of(" \t", end == 0 ? 0 : end - 1);
+        if (first != std::string::npos && first < end && last != std::string::npos && last >= first)
+        {
+            topics.push_back(csv.substr(first, last - first + 1));
+        }
+        start = end + 1;
+    }
+    return topics;
+}
+
+bool IsPriorityEvent(const char* data, size_t length)
+{
+    static const char PREFIX[] = "{\"type\":\"POSITION_";
+    return length >= sizeof(PREFIX) - 1 && std::memcmp(data, PREFIX, sizeof(PREFIX) - 1) == 0;
+}
+
+int64_t EventIndex(const char* data, size_t length)
+{
+    static const char KEY[] = "\"eventIndex\":";
+    const char* end = data + length;
+    const char* key = std::search(data, end, KEY, KEY + sizeof(KEY) - 1);
+    if (key == end) return -1;
+
+    int64_t index = 0;
+    bool digits = false;
+    for (const char* p = key + sizeof(KEY) - 1; p < end && *p >= '0' && *p <= '9'; p++)
+    {
+        index = index * 10 + (*p - '0');
+        digits = true;
+    }
+    return digits ? index : -1;
+}
+
+// ============================================================================
+// Publisher
+// ============================================================================
+
+bool Publisher::Bind(int port, const std::string& curveSecretKey, int sndHwm, std::string* error)
+{
+    Close();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const ZmqApi* zmq = Zmq();
+    if (!zmq)
+    {
+        if (error) *error = "libzmq not available";
+        return false;
+    }
+
+    m_context = zmq->ctx_new();
+    m_main.socket = m_context ? BindServer(m_context, ZMQ_XPUB, port, curveSecretKey, sndHwm > 0 ? sndHwm : 1000,
+                                           error)
+                              : nullptr;
+    if (!m_main.socket)
+    {
+        if (!m_context) SetError(error, "ZMQ context");
+        CloseSocket(m_context, m_main.socket);
+        return false;
+    }
+    m_curveSecretKey = curveSecretKey;
+    return true;
+}
+
+void Publisher::Close()
+{
+    StopFlusher();
+    StopHeartbeat();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_main.socket && !m_context) return;
+
+    if (m_batch.Count()) FlushBatch();
+    if (m_priority.socket) Zmq()->close(m_priority.socket);
+    m_priority.socket = nullptr;
+    m_priority.subscriptions.clear();
+    if (m_monitor.socket) Zmq()->close(m_monitor.socket);
+    m_monitor.socket = nullptr;
+    m_monitor.peers.clear();
+    m_monitor.farewells.clear();
+    CloseSocket(m_context, m_main.socket);
+    m_main.subscriptions.clear();
+}
+
+bool Publisher::SetPriorityLane(int port, int sndHwm, std::string* error)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_context)
+    {
+        if (error) *error = "publisher not bound";
+        return false;
+    }
+
+    if (m_priority.socket) Zmq()->close(m_priority.socket);
+    m_priority.subscriptions.clear();
+    m_priority.socket = BindServer(m_context, ZMQ_XPUB, port, m_curveSecretKey, sndHwm > 0 ? sndHwm : 10000,
+                                   error);
+    return m_priority.socket != nullptr;
+}
+
+bool Publisher::SetMonitoredPort(int port, int sndHwm, std::string* error)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_context)
+    {
+        if (error) *error = "publisher not bound";
+        return false;
+    }
+
+    if (m_monitor.socket) Zmq()->close(m_monitor.socket);
+    m_monitor.peers.clear();
+    m_monitor.farewells.clear();
+    m_monitor.socket = BindServer(m_context, ZMQ_ROUTER, port, m_curveSecretKey, sndHwm > 0 ? sndHwm : 10000,
+                                  error);
+    if (!m_monitor.socket) return false;
+
+    // Report a full queue (EAGAIN) or a departed peer instead of dropping silently
+    ZmqSetInt(m_monitor.socket, ZMQ_ROUTER_MANDATORY, 1);
+    return true;
+}
+
+void Publisher::SetLagPolicy(const LagPolicy& policy)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_monitor.policy = policy;
+}
+
+bool Publisher::NextLagAlert(std::string& json)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_monitor.socket) DrainPeers();
+    if (m_monitor.alerts.empty()) return false;
+
+    json = std::move(m_monitor.alerts.front());
+    m_monitor.alerts.pop_front();
+    return true;
+}
+
+bool Publisher::SetCompression(Codec codec, const std::string& dictionary, int level,
+                               const std::vector<std::string>& topics)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_compressedTopics.clear();
+    if (!m_compressor.Configure(codec, dictionary, level)) return false;
+    if (codec != Codec::None)
+    {
+        m_compressedTopics.insert(topics.begin(), topics.end());
+    }
+    return true;
+}
+
+void Publisher::DrainSubscriptions(Lane& lane)
+{
+    for (;;)
+    {
+        ZmqFrame frame;
+        if (frame.Receive(lane.socket, ZMQ_DONTWAIT) < 0) break;
+        if (frame.Size() == 0) continue;
+
+        // Non-verbose XPUB reports only the first subscribe / last unsubscribe
+        std::string topic(frame.Data() + 1, frame.Size() - 1);
+        if (frame.Data()[0] == 1) lane.subscriptions.insert(topic);
+        else if (frame.Data()[0] == 0) lane.subscriptions.erase(topic);
+    }
+}
+
+bool Publisher::Subscribed(const std::set<std::string>& subscriptions, const std::string& prefix,
+                           size_t minLength)
+{
+    for (const std::string& subscription : subscriptions)
+    {
+        if (subscription.size() >= minLength &&
+            subscription.size() <= prefix.size() &&
+            prefix.compare(0, subscription.size(), subscription) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Publisher::Send(Lane& lane, const std::string& prefix, const char* data, size_t length)
+{
+    m_buffer.assign(prefix);
+    m_buffer.append(data, length);
+    return Zmq()->send(lane.socket, m_buffer.data(), m_buffer.size(), ZMQ_DONTWAIT) >= 0;
+}
+
+void Publisher::SetBatching(const std::string& topic, int windowMs, size_t maxEvents, size_t maxBytes,
+                            const std::string& envelope)
+{
+    StopFlusher();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_batch.Count()) FlushBatch();
+
+    m_batchTopic = windowMs > 0 ? topic : std::string();
+    m_batchWindowUs = static_cast<uint64_t>(windowMs > 0 ? windowMs : 0) * 1000;
+    m_batchMaxEvents = maxEvents > 0 ? maxEvents : 1;
+    m_batchMaxBytes = maxBytes;
+    m_batch.SetEnvelope(envelope);
+
+    if (!m_batchTopic.empty())
+    {
+        m_stopFlusher = false;
+        m_flusher = std::thread(&Publisher::FlushLoop, this);
+    }
+}
+
+void Publisher::StopFlusher()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopFlusher = true;
+    }
+    m_flushWake.notify_all();
+    if (m_flusher.joinable()) m_flusher.join();
+}
+
+void Publisher::FlushLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopFlusher)
+    {
+        if (m_batch.Count() == 0)
+        {
+            m_flushWake.wait(lock);
+            continue;
+        }
+
+        uint64_t now = NowMicros();
+        if (now >= m_batchDeadlineUs)
+        {
+            FlushBatch();
+            continue;
+        }
+        m_flushWake.wait_for(lock, std::chrono::microseconds(m_batchDeadlineUs - now));
+    }
+}
+
+bool Publisher::FlushBatch()
+{
+    ArenaScope scope(m_arena);
+    size_t count = m_batch.Count();
+    std::string_view frame = m_batch.Take(m_arena);
+    if (!m_main.socket || count == 0) return false;
+
+    m_batchedEvents += count;
+    return PublishVariants(m_main, m_batchTopic + BATCH_TOPIC_SUFFIX, frame.data(), frame.size());
+}
+
+void Publisher::SetHeartbeat(int intervalMs, const std::string& envelope)
+{
+    StopHeartbeat();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_heartbeatIntervalUs = static_cast<uint64_t>(intervalMs > 0 ? intervalMs : 0) * 1000;
+    m_heartbeatEnvelope = envelope;
+    if (m_heartbeatIntervalUs)
+    {
+        m_stopHeartbeat = false;
+        m_heartbeat = std::thread(&Publisher::HeartbeatLoop, this);
+    }
+}
+
+void Publisher::UpdateHeartbeat(const std::string& fields, int64_t eventIndex, int64_t serverTime)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_heartbeatFields = fields;
+    m_heartbeatIndex = eventIndex;
+    m_serverTime = serverTime;
+    m_serverTimeUs = NowMicros();
+}
+
+uint64_t Publisher::EaStallMs() const
+{
+    uint64_t touched = m_eaTouchUs.load(std::memory_order_relaxed);
+    uint64_t now = NowMicros();
+    return touched && now > touched ? (now - touched) / 1000 : 0;
+}
+
+void Publisher::StopHeartbeat()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopHeartbeat = true;
+    }
+    m_heartbeatWake.notify_all();
+    if (m_heartbeat.joinable()) m_heartbeat.join();
+}
+
+std::string_view Publisher::BuildHeartbeat()
+{
+    // Broker time keeps running while the EA thread is blocked
+    int64_t serverTime = m_serverTime + static_cast<int64_t>((NowMicros() - m_serverTimeUs) / 1000000);
+    char timestamp[FORMAT_TIME_CHARS];
+    size_t timestampLength = FormatServerTime(timestamp, serverTime);
+    char number[FORMAT_INT_CHARS];
+
+    ArenaString json{ArenaAllocator<char>(m_arena)};
+    json.reserve(256 + m_heartbeatEnvelope.size() + m_heartbeatFields.size());
+    json += "{\"type\":\"HEARTBEAT\",\"eventIndex\":";
+    json.append(number, FormatInt(number, m_heartbeatIndex));
+    json += ",\"timestamp\":\"";
+    json.append(timestamp, timestampLength);
+    json += "\"";
+    if (!m_heartbeatEnvelope.empty())
+    {
+        json += ",";
+        json.append(m_heartbeatEnvelope);
+    }
+    json += ",\"data\":{";
+    json.append(m_heartbeatFields);
+    json += ",\"serverTime\":\"";
+    json.append(timestamp, timestampLength);
+    json += "\",\"serverTimeUnix\":";
+    json.append(number, FormatInt(number, serverTime));
+    json += ",\"eaStallMs\":";
+    json.append(number, FormatUInt(number, EaStallMs()));
+    json += "}}";
+
+    // The characters stay in the arena until the caller's scope ends
+    return std::string_view(json.data(), json.size());
+}
+
+void Publisher::HeartbeatLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t next = NowMicros();
+    while (!m_stopHeartbeat)
+    {
+        uint64_t now = NowMicros();
+        if (now < next)
+        {
+            m_heartbeatWake.wait_for(lock, std::chrono::microseconds(next - now));
+            continue;
+        }
+        next = now + m_heartbeatIntervalUs;
+
+        if (m_heartbeatFields.empty() || !m_main.socket) continue;
+        ArenaScope scope(m_arena);
+        std::string_view heartbeat = BuildHeartbeat();
+        DrainSubscriptions(m_main);
+        PublishLocked("EVENT", heartbeat.data(), heartbeat.size());
+        m_heartbeatsSent++;
+    }
+}
+
+bool Publisher::Publish(const std::string& topic, const char* data, size_t length)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_main.socket) return false;
+
+    DrainSubscriptions(m_main);
+    return PublishLocked(topic, data, length);
+}
+
+bool Publisher::PublishLocked(const std::string& topic, const char* data, size_t length)
+{
+    // Trades go out on the lane first; the data port copy follows as usual
+    bool ok = true;
+    if (m_priority.socket && topic == "EVENT" && IsPriorityEvent(data, length))
+    {
+        DrainSubscriptions(m_priority);
+        ok = PublishVariants(m_priority, topic, data, length);
+    }
+
+    bool batching = !m_batchTopic.empty();
+    if (batching && topic != m_batchTopic)
+    {
+        // Keep cross-topic order: a SNAPSHOT never overtakes batched events
+        if (m_batch.Count()) FlushBatch();
+        return PublishVariants(m_main, topic, data, length) && ok;
+    }
+
+    ok = PublishVariants(m_main, topic, data, length) && ok;
+    if (!batching) return ok;
+
+    std::string batchTopic = m_batchTopic + BATCH_TOPIC_SUFFIX;
+    std::string plainBatch = batchTopic + "|";
+    std::string compressedBatch = batchTopic + COMPRESSED_TOPIC_SUFFIX + "|";
+    if (!Subscribed(m_main.subscriptions, plainBatch, topic.size() + 1) &&
+        !Subscribed(m_main.subscriptions, compressedBatch, topic.size() + 1) &&
+        !MonitoredSubscribed(plainBatch, topic.size() + 1) &&
+        !MonitoredSubscribed(compressedBatch, topic.size() + 1))
+    {
+        return ok;
+    }
+
+    if (m_batch.Count() == 0)
+    {
+        m_batchDeadlineUs = NowMicros() + m_batchWindowUs;
+        m_flushWake.notify_one();
+    }
+    m_batch.Add(data, length);
+    if (m_batch.Count() >= m_batchMaxEvents || (m_batchMaxBytes && m_batch.Bytes() >= m_batchMaxBytes))
+    {
+        ok = FlushBatch() && ok;
+    }
+    return ok;
+}
+
+bool Publisher::PublishVariants(Lane& lane, const std::string& topic, const char* data, size_t length)
+{
+    TopicStats& stats = lane.stats[topic];
+    stats.messages++;
+    stats.rawBytes += length;
+
+    bool ok = true;
+    std::string plainPrefix = topic + "|";
+    if (Subscribed(lane.subscriptions, plainPrefix, 0))
+    {
+        if (Send(lane, plainPrefix, data, length)) stats.wireBytes += plainPrefix.size() + length;
+        else { stats.errors++; ok = false; }
+    }
+
+    // Only encoded when a subscriber explicitly asked for "TOPIC.Z"
+    if (m_compressedTopics.count(topic))
+    {
+        std::string zPrefix = topic + COMPRESSED_TOPIC_SUFFIX + "|";
+        if (Subscribed(lane.subscriptions, zPrefix, topic.size() + 1))
+        {
+            m_buffer.assign(zPrefix);
+            if (m_compressor.Compress(data, length, m_buffer) &&
+                Zmq()->send(lane.socket, m_buffer.data(), m_buffer.size(), ZMQ_DONTWAIT) >= 0)
+            {
+                stats.compressed++;
+                stats.wireBytes += m_buffer.size();
+            }
+            else
+            {
+                stats.errors++;
+                ok = false;
+            }
+        }
+    }
+
+    // The monitored port carries everything the data port does
+    if (&lane == &m_main && m_monitor.socket) ok = PublishMonitored(topic, data, length) && ok;
+    return ok;
+}
+
+void Publisher::DrainPeers()
+{
+    for (;;)
+    {
+        // ROUTER: routing id frame, then the peer's (single-frame) message
+        ZmqFrame identity;
+        if (identity.Receive(m_monitor.socket, ZMQ_DONTWAIT) < 0) break;
+        ZmqFrame body;
+        if (body.Receive(m_monitor.socket, ZMQ_DONTWAIT) < 0) break;
+
+        std::string id(identity.Data(), identity.Size());
+        const char* bytes = body.Data();
+        size_t size = body.Size();
+        if (size == 0) continue;
+
+        if (StartsWith(bytes, size, MONITOR_HELLO))
+        {
+            Peer& peer = m_monitor.peers[id];
+            peer = Peer();
+            peer.lastAckUs = NowMicros();
+            m_monitor.farewells.erase(id);
+            continue;
+        }
+
+        auto it = m_monitor.peers.find(id);
+        if (it == m_monitor.peers.end())
+        {
+            // Evicted, or said HELLO to a master that has since restarted
+            auto farewell = m_monitor.farewells.find(id);
+            if (farewell != m_monitor.farewells.end() && farewell->second) continue;
+            if (m_monitor.farewells.size() >= MAX_FAREWELLS) m_monitor.farewells.clear();
+            m_monitor.farewells[id] = SendToPeer(id, std::string(MONITOR_BYE_TOPIC) + "|{\"reason\":\"unknown\"}");
+            continue;
+        }
+
+        Peer& peer = it->second;
+        if (bytes[0] == 1 || bytes[0] == 0)
+        {
+            std::string filter(bytes + 1, size - 1);
+            if (bytes[0] == 1) peer.subscriptions.insert(filter);
+            else peer.subscriptions.erase(filter);
+        }
+        else if (StartsWith(bytes, size, MONITOR_ACK_PREFIX))
+        {
+            uint64_t consumed = 0;
+            for (size_t i = sizeof(MONITOR_ACK_PREFIX) - 1; i < size && bytes[i] >= '0' && bytes[i] <= '9'; i++)
+            {
+                consumed = consumed * 10 + static_cast<uint64_t>(bytes[i] - '0');
+            }
+            peer.acked = std::min(consumed, peer.sent);
+            peer.lastAckUs = NowMicros();
+            UpdateLag(id, peer, false);
+        }
+    }
+}
+
+bool Publisher::MonitoredSubscribed(const std::string& prefix, size_t minLength) const
+{
+    for (const auto& entry : m_monitor.peers)
+    {
+        if (Subscribed(entry.second.subscriptions, prefix, minLength)) return true;
+    }
+    return false;
+}
+
+bool Publisher::SendToPeer(const std::string& id, const std::string& frame)
+{
+    // With ROUTER_MANDATORY the routing id frame fails for a full queue or a gone peer
+    if (Zmq()->send(m_monitor.socket, id.data(), id.size(), ZMQ_SNDMORE | ZMQ_DONTWAIT) < 0) return false;
+    return Zmq()->send(m_monitor.socket, frame.data(), frame.size(), ZMQ_DONTWAIT) >= 0;
+}
+
+void Publisher::UpdateLag(const std::string& id, Peer& peer, bool queueFull)
+{
+    uint64_t lag = peer.sent - peer.acked;
+    peer.maxLag = std::max(peer.maxLag, lag);
+
+    uint64_t threshold = m_monitor.policy.lagThreshold;
+    if (!peer.lagging && (queueFull || lag >= threshold))
+    {
+        peer.lagging = true;
+        Alert(id, peer, "lagging", queueFull ? "queueFull" : "lag");
+    }
+    else if (peer.lagging && !queueFull && lag < threshold / 2)
+    {
+        peer.lagging = false;
+        Alert(id, peer, "recovered", "lag");
+    }
+}
+
+void Publisher::Evict(std::map<std::string, Peer>::iterator& it, const char* reason)
+{
+    Alert(it->first, it->second, "evicted", reason);
+    m_monitor.evicted++;
+
+    // Delivered after everything already queued; retried on the peer's next ACK if the queue is full
+    std::string bye = std::string(MONITOR_BYE_TOPIC) + "|{\"reason\":\"" + reason + "\"}";
+    if (m_monitor.farewells.size() >= MAX_FAREWELLS) m_monitor.farewells.clear();
+    m_monitor.farewells[it->first] = SendToPeer(it->first, bye);
+    it = m_monitor.peers.erase(it);
+}
+
+void Publisher::Alert(const std::string& id, const Peer& peer, const char* event, const char* reason)
+{
+    if (!m_monitor.policy.alert) return;
+
+    uint64_t dropped = 0;
+    for (const auto& entry : peer.dropped) dropped += entry.second;
+
+    std::string json = "{\"event\":\"";
+    json += event;
+    json += "\",\"reason\":\"";
+    json += reason;
+    json += "\",\"subscriber\":\"" + HexId(id) + "\"";
+    json += ",\"lag\":" + std::to_string(peer.sent - peer.acked);
+    json += ",\"maxLag\":" + std::to_string(peer.maxLag);
+    json += ",\"dropped\":" + std::to_string(dropped);
+    json += ",\"atUs\":" + std::to_string(WallMicros()) + "}";
+
+    if (m_monitor.alerts.size() >= MAX_LAG_ALERTS)
+    {
+        m_monitor.alerts.pop_front();
+        m_monitor.alertsDropped++;
+    }
+    m_monitor.alerts.push_back(std::move(json));
+}
+
+bool Publisher::PublishMonitored(const std::string& topic, const char* data, size_t length)
+{
+    DrainPeers();
+    if (m_monitor.peers.empty()) return true;
+
+    TopicStats& stats = m_monitor.stats[topic];
+    stats.messages++;
+    stats.rawBytes += length;
+
+    const LagPolicy& policy = m_monitor.policy;
+    std::string plainPrefix = topic + "|";
+    std::string zPrefix = topic + COMPRESSED_TOPIC_SUFFIX + "|";
+    bool compressible = m_compressedTopics.count(topic) > 0;
+    bool snapshot = topic == "SNAPSHOT";
+    bool plainBuilt = false;
+    int  zState = 0;                        // 0 = not built, 1 = in m_monitorBuffer, -1 = failed
+
+    bool ok = true;
+    for (auto it = m_monitor.peers.begin(); it != m_monitor.peers.end();)
+    {
+        Peer& peer = it->second;
+        bool compressed = compressible && Subscribed(peer.subscriptions, zPrefix, topic.size() + 1);
+        if (!compressed && !Subscribed(peer.subscriptions, plainPrefix, 0))
+        {
+            ++it;
+            continue;
+        }
+
+        UpdateLag(it->first, peer, false);
+        if (policy.evict && peer.sent - peer.acked >= policy.evictLag)
+        {
+            Evict(it, "lag");
+            continue;
+        }
+        if (policy.evict && peer.lagging && NowMicros() - peer.lastAckUs >= STUCK_EVICT_US)
+        {
+            Evict(it, "stuck");
+            continue;
+        }
+        if (snapshot && peer.lagging && policy.shedSnapshots)
+        {
+            // Snapshots go first: the next one after recovery supersedes it
+            peer.dropped[topic]++;
+            stats.dropped++;
+            ++it;
+            continue;
+        }
+
+        if (compressed && zState == 0)
+        {
+            m_monitorBuffer.assign(zPrefix);
+            zState = m_compressor.Compress(data, length, m_monitorBuffer) ? 1 : -1;
+        }
+        if (compressed && zState < 0)
+        {
+            stats.errors++;
+            ok = false;
+            ++it;
+            continue;
+        }
+        if (!compressed && !plainBuilt)
+        {
+            m_buffer.assign(plainPrefix);
+            m_buffer.append(data, length);
+            plainBuilt = true;
+        }
+
+        const std::string& frame = compressed ? m_monitorBuffer : m_buffer;
+        if (SendToPeer(it->first, frame))
+        {
+            peer.sent++;
+            stats.wireBytes += frame.size();
+            if (compressed) stats.compressed++;
+            ++it;
+            continue;
+        }
+
+        if (Zmq()->errno_() != EAGAIN)
+        {
+            Alert(it->first, peer, "gone", "disconnected");
+            it = m_monitor.peers.erase(it);
+            continue;
+        }
+
+        // Its queue is full: this subscriber loses the message, nobody else does
+        peer.dropped[topic]++;
+        stats.dropped++;
+        UpdateLag(it->first, peer, true);
+        ++it;
+    }
+    return ok;
+}
+
+std::string Publisher::StatsJson()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_main.socket) DrainSubscriptions(m_main);
+    if (m_priority.socket) DrainSubscriptions(m_priority);
+
+    std::string json = "{";
+    json += "\"codec\":\"" + std::string(CodecName(m_compressor.GetCodec())) + "\"";
+    json += ",\"dictId\":" + std::to_string(m_compressor.DictId());
+    json += ",\"subscriptions\":" + std::to_string(m_main.subscriptions.size());
+    json += ",\"batchedEvents\":" + std::to_string(m_batchedEvents);
+    json += ",\"heartbeats\":" + std::to_string(m_heartbeatsSent);
+    json += ",\"eaStallMs\":" + std::to_string(EaStallMs());
+    json += ",\"arena\":" + m_arena.StatsJson();
+    json += ",";
+    AppendStats(json, m_main.stats);
+    if (m_priority.socket)
+    {
+        json += ",\"priorityLane\":{\"subscriptions\":" + std::to_string(m_priority.subscriptions.size()) + ",";
+        AppendStats(json, m_priority.stats);
+        json += "}";
+    }
+    if (m_monitor.socket)
+    {
+        DrainPeers();
+        uint64_t now = NowMicros();
+        json += ",\"monitored\":{\"subscribers\":" + std::to_string(m_monitor.peers.size());
+        json += ",\"evicted\":" + std::to_string(m_monitor.evicted);
+        json += ",\"alertsDropped\":" + std::to_string(m_monitor.alertsDropped) + ",";
+        AppendStats(json, m_monitor.stats);
+        json += ",\"peers\":[";
+        bool first = true;
+        for (const auto& entry : m_monitor.peers)
+        {
+            const Peer& peer = entry.second;
+            if (!first) json += ",";
+            first = false;
+            json += "{\"id\":\"" + HexId(entry.first) + "\"";
+            json += ",\"lag\":" + std::to_string(peer.sent - peer.acked);
+            json += ",\"maxLag\":" + std::to_string(peer.maxLag);
+            json += ",\"lagging\":" + std::string(peer.lagging ? "true" : "false");
+            json += ",\"sent\":" + std::to_string(peer.sent);
+            json += ",\"lastAckMs\":" + std::to_string((now - peer.lastAckUs) / 1000);
+            json += ",\"dropped\":{";
+            bool firstTopic = true;
+            for (const auto& dropped : peer.dropped)
+            {
+                if (!firstTopic) json += ",";
+                firstTopic = false;
+                json += "\"" + dropped.first + "\":" + std::to_string(dropped.second);
+            }
+            json += "}}";
+        }
+        json += "]}";
+    }
+    json += "}";
+    return json;
+}
+
+// ============================================================================
+// Subscriber
+// ============================================================================
+
+bool Subscriber::Connect(const std::string& endpoint, const std::string& serverKey,
+                         const std::string& clientPublicKey, const std::string& clientSecretKey,
+                         int rcvHwm, std::string* error)
+{
+    return Open(ZMQ_SUB, endpoint, serverKey, clientPublicKey, clientSecretKey, rcvHwm, error);
+}
+
+bool Subscriber::ConnectMonitored(const std::string& endpoint, const std::string& serverKey,
+                                  const std::string& clientPublicKey, const std::string& clientSecretKey,
+                                  int rcvHwm, std::string* error)
+{
+    if (!Open(ZMQ_DEALER, endpoint, serverKey, clientPublicKey, clientSecretKey, rcvHwm, error)) return false;
+
+    // Queued on the DEALER until the connection is up
+    m_monitored = true;
+    Hello();
+    return true;
+}
+
+bool Subscriber::Open(int type, const std::string& endpoint, const std::string& serverKey,
+                      const std::string& clientPublicKey, const std::string& clientSecretKey,
+                      int rcvHwm, std::string* error)
+{
+    Close();
+
+    const ZmqApi* zmq = Zmq();
+    if (!zmq)
+    {
+        if (error) *error = "libzmq not available";
+        return false;
+    }
+
+    if (!m_sharedContext) m_context = zmq->ctx_new();
+    m_socket = m_context ? ConnectClient(m_context, type, endpoint, serverKey, clientPublicKey, clientSecretKey,
+                                         rcvHwm > 0 ? rcvHwm : 10000, error)
+                         : nullptr;
+    if (!m_socket)
+    {
+        if (!m_context) SetError(error, "ZMQ context");
+        CloseSockets();
+        return false;
+    }
+    m_serverKey = serverKey;
+    m_clientPublicKey = clientPublicKey;
+    m_clientSecretKey = clientSecretKey;
+    return true;
+}
+
+void Subscriber::Close()
+{
+    if (!m_socket && (!m_context || m_sharedContext)) return;
+
+    if (m_laneSocket) Zmq()->close(m_laneSocket);
+    m_laneSocket = nullptr;
+    CloseSockets();
+    m_topics.clear();
+    m_laneDelivered.clear();
+    m_mainDelivered.clear();
+    m_lastLaneIndex = m_lastMainIndex = -1;
+    m_pending.clear();
+    m_pendingNext = 0;
+    m_monitored = false;
+    m_consumed = m_acked = 0;
+}
+
+void Subscriber::CloseSockets()
+{
+    if (!m_sharedContext)
+    {
+        CloseSocket(m_context, m_socket);
+        return;
+    }
+    if (m_socket) Zmq()->close(m_socket);
+    m_socket = nullptr;
+}
+
+bool Subscriber::ConnectPriorityLane(const std::string& endpoint, bool compressed, int rcvHwm,
+                                     std::string* error)
+{
+    if (!m_context)
+    {
+        if (error) *error = "subscriber not connected";
+        return false;
+    }
+
+    if (m_laneSocket) Zmq()->close(m_laneSocket);
+    m_laneSocket = ConnectClient(m_context, ZMQ_SUB, endpoint, m_serverKey, m_clientPublicKey,
+                                 m_clientSecretKey, rcvHwm > 0 ? rcvHwm : 10000, error);
+    if (!m_laneSocket) return false;
+
+    m_laneCompressed = compressed;
+    std::string filter = std::string("EVENT") + (compressed ? COMPRESSED_TOPIC_SUFFIX : "") + "|";
+    if (!SetString(m_laneSocket, ZMQ_SUBSCRIBE, filter))
+    {
+        SetError(error, "lane subscribe");
+        Zmq()->close(m_laneSocket);
+        m_laneSocket = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void Subscriber::LoadDictionary(const std::string& dictionary)
+{
+    m_dictionary = dictionary;
+    if (CodecAvailable(Codec::Zstd)) m_zstd.Configure(Codec::Zstd, dictionary, 3);
+    if (CodecAvailable(Codec::Lz4)) m_lz4.Configure(Codec::Lz4, dictionary, 1);
+}
+
+bool Subscriber::Subscribe(const std::string& topic, bool compressed)
+{
+    if (!m_socket) return false;
+
+    auto it = m_topics.find(topic);
+    if (it != m_topics.end())
+    {
+        if (it->second == compressed) return true;
+        Unsubscribe(topic);
+    }
+
+    std::string filter = topic + (compressed ? COMPRESSED_TOPIC_SUFFIX : "") + "|";
+    if (!SetFilter(filter, true)) return false;
+    m_topics[topic] = compressed;
+    return true;
+}
+
+bool Subscriber::Unsubscribe(const std::string& topic)
+{
+    if (!m_socket) return false;
+
+    auto it = m_topics.find(topic);
+    if (it == m_topics.end()) return true;
+
+    std::string filter = topic + (it->second ? COMPRESSED_TOPIC_SUFFIX : "") + "|";
+    m_topics.erase(it);
+    return SetFilter(filter, false);
+}
+
+bool Subscriber::SetFilter(const std::string& filter, bool subscribe)
+{
+    if (!m_monitored) return SetString(m_socket, subscribe ? ZMQ_SUBSCRIBE : ZMQ_UNSUBSCRIBE, filter);
+
+    // Same frame an XPUB would see
+    std::string message(1, subscribe ? '\x01' : '\x00');
+    message += filter;
+    return Zmq()->send(m_socket, message.data(), message.size(), ZMQ_DONTWAIT) >= 0;
+}
+
+void Subscriber::Hello()
+{
+    m_consumed = m_acked = 0;
+    m_ackedAtUs = NowMicros();
+    Zmq()->send(m_socket, MONITOR_HELLO, sizeof(MONITOR_HELLO) - 1, ZMQ_DONTWAIT);
+    for (const auto& entry : m_topics)
+    {
+        SetFilter(entry.first + (entry.second ? COMPRESSED_TOPIC_SUFFIX : "") + "|", true);
+    }
+}
+
+void Subscriber::Acknowledge()
+{
+    uint64_t now = NowMicros();
+    uint64_t pending = m_consumed - m_acked;
+    if (pending < ACK_EVERY && now - m_ackedAtUs < (pending ? ACK_DELAY_US : ACK_KEEPALIVE_US)) return;
+
+    std::string ack = MONITOR_ACK_PREFIX + std::to_string(m_consumed);
+    if (Zmq()->send(m_socket, ack.data(), ack.size(), ZMQ_DONTWAIT) >= 0) m_acked = m_consumed;
+    m_ackedAtUs = now;
+}
+
+bool Subscriber::Compressed(const std::string& topic) const
+{
+    auto it = m_topics.find(topic);
+    return it != m_topics.end() && it->second;
+}
+
+int Subscriber::ReadFrame(void* socket, std::string& topic, std::string& data)
+{
+    ZmqFrame frame;
+    if (frame.Receive(socket, ZMQ_DONTWAIT) < 0) return 0;
+
+    const char* bytes = frame.Data();
+    size_t size = frame.Size();
+    const char* bar = static_cast<const char*>(std::memchr(bytes, '|', size));
+    if (!bar)
+    {
+        topic.clear();
+        data.assign(bytes, size);
+        return 1;
+    }
+
+    topic.assign(bytes, bar);
+    const char* payload = bar + 1;
+    size_t payloadSize = size - (payload - bytes);
+
+    size_t suffixLength = sizeof(COMPRESSED_TOPIC_SUFFIX) - 1;
+    bool compressed = topic.size() > suffixLength &&
+                      topic.compare(topic.size() - suffixLength, suffixLength, COMPRESSED_TOPIC_SUFFIX) == 0;
+    if (compressed) topic.resize(topic.size() - suffixLength);
+
+    TopicStats& stats = m_stats[topic];
+    stats.messages++;
+    stats.wireBytes += size;
+
+    if (!compressed)
+    {
+        data.assign(payload, payloadSize);
+        stats.rawBytes += payloadSize;
+        return 1;
+    }
+
+    Codec codec = payloadSize > 0 ? static_cast<Codec>(static_cast<unsigned char>(payload[0])) : Codec::None;
+    Compressor& compressor = codec == Codec::Lz4 ? m_lz4 : m_zstd;
+    if (!compressor.Decompress(payload, payloadSize, data))
+    {
+        stats.errors++;
+        return -4;
+    }
+
+    stats.compressed++;
+    stats.rawBytes += data.size();
+    return 1;
+}
+
+bool Subscriber::FirstDelivery(std::set<int64_t>& delivered, std::set<int64_t>& other, int64_t& last,
+                               int64_t index)
+{
+    if (index < 0) return true;
+
+    // Each stream is in order: going backwards means the master restarted
+    if (index < last)
+    {
+        m_laneDelivered.clear();
+        m_mainDelivered.clear();
+        m_lastLaneIndex = m_lastMainIndex = -1;
+    }
+    last = index;
+
+    if (other.erase(index))
+    {
+        m_duplicates++;
+        return false;
+    }
+    delivered.insert(index);
+    if (static_cast<int64_t>(delivered.size()) > MAX_PENDING_INDICES) delivered.erase(delivered.begin());
+    return true;
+}
+
+int Subscriber::ReceiveLane(std::string& topic, std::string& data)
+{
+    for (;;)
+    {
+        int rc = ReadFrame(m_laneSocket, topic, data);
+        if (rc == -4)
+        {
+            // Wrong dictionary: plain lane from now on (the data port has the event)
+            SetString(m_laneSocket, ZMQ_UNSUBSCRIBE, std::string("EVENT") + COMPRESSED_TOPIC_SUFFIX + "|");
+            SetString(m_laneSocket, ZMQ_SUBSCRIBE, "EVENT|");
+            m_laneCompressed = false;
+            continue;
+        }
+        if (rc <= 0) return rc;
+
+        if (FirstDelivery(m_laneDelivered, m_mainDelivered, m_lastLaneIndex,
+                          EventIndex(data.data(), data.size())))
+        {
+            m_laneEvents++;
+            return 1;
+        }
+    }
+}
+
+int Subscriber::Receive(std::string& topic, std::string& data, int timeoutMs)
+{
+    const ZmqApi* zmq = Zmq();
+    if (!m_socket || !zmq) return -1;
+    if (m_monitored) Acknowledge();
+
+    if (m_laneSocket)
+    {
+        // Trades overtake anything already queued from the data port
+        if (ReceiveLane(topic, data) > 0) return 1;
+        if (m_pendingNext < m_pending.size()) return NextPending(topic, data);
+    }
+
+    if (timeoutMs > 0)
+    {
+        ZmqPollItem items[2] = { { m_socket, 0, ZMQ_POLLIN, 0 }, { m_laneSocket, 0, ZMQ_POLLIN, 0 } };
+        if (zmq->poll(items, m_laneSocket ? 2 : 1, timeoutMs) <= 0) return 0;
+        if (m_laneSocket && ReceiveLane(topic, data) > 0) return 1;
+    }
+
+    for (;;)
+    {
+        int rc = ReadFrame(m_socket, topic, data);
+        if (m_monitored && rc != 0)
+        {
+            if (topic == MONITOR_BYE_TOPIC)
+            {
+                // Evicted: everything queued before the BYE has been read
+                m_evictions++;
+                Hello();
+                continue;
+            }
+            m_consumed++;
+        }
+        if (rc == -4)
+        {
+            // Wrong dictionary or missing codec: take the plain stream from now on
+            Subscribe(topic, false);
+            return -4;
+        }
+        if (rc <= 0 || !m_laneSocket) return rc;
+
+        std::string batchTopic = std::string("EVENT") + BATCH_TOPIC_SUFFIX;
+        if (topic == batchTopic)
+        {
+            // Unpacked here so each event can be matched against the lane.
+            // The previous batch was fully handed out, so its arena is free.
+            m_arena.Reset();
+            m_pendingNext = 0;
+            if (!UnpackBatch(data.data(), data.size(), m_arena, m_pending))
+            {
+                m_pending.clear();
+                m_stats[topic].errors++;
+                continue;
+            }
+
+            size_t kept = 0;
+            for (std::string_view event : m_pending)
+            {
+                if (!IsPriorityEvent(event.data(), event.size()) ||
+                    FirstDelivery(m_mainDelivered, m_laneDelivered, m_lastMainIndex,
+                                  EventIndex(event.data(), event.size())))
+                {
+                    m_pending[kept++] = event;
+                }
+            }
+            m_pending.resize(kept);
+            if (m_pending.empty()) continue;
+
+            return NextPending(topic, data);
+        }
+
+        if (topic != "EVENT" || !IsPriorityEvent(data.data(), data.size()) ||
+            FirstDelivery(m_mainDelivered, m_laneDelivered, m_lastMainIndex,
+                          EventIndex(data.data(), data.size())))
+        {
+            return 1;
+        }
+    }
+}
+
+int Subscriber::NextPending(std::string& topic, std::string& data)
+{
+    std::string_view event = m_pending[m_pendingNext++];
+    topic = "EVENT";
+    data.assign(event.data(), event.size());
+    return 1;
+}
+
+std::string Subscriber::StatsJson()
+{
+    std::string json = "{";
+    json += "\"dictId\":" + std::to_string(DictionaryId(m_dictionary));
+    if (m_laneSocket)
+    {
+        json += ",\"priorityLane\":{\"compressed\":" + std::string(m_laneCompressed ? "true" : "false");
+        json += ",\"events\":" + std::to_string(m_laneEvents);
+        json += ",\"duplicatesDropped\":" + std::to_string(m_duplicates) + "}";
+        json += ",\"arena\":" + m_arena.StatsJson();
+    }
+    if (m_monitored)
+    {
+        json += ",\"monitored\":{\"consumed\":" + std::to_string(m_consumed);
+        json += ",\"evictions\":" + std::to_string(m_evictions) + "}";
+    }
+    json += ",";
+    AppendStats(json, m_stats);
+    json += "}";
+    return json;
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    struct TransportHandle
+    {
+        std::unique_ptr<hedgeedge::Publisher>  publisher;
+        std::unique_ptr<hedgeedge::Subscriber> subscriber;
+        std::string                            topic;
+        std::string                            data;
+    };
+
+    hedgeedge::HandleTable<TransportHandle> g_transports;
+
+    std::string Text(const char* value)
+    {
+        return value ? std::string(value) : std::string();
+    }
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall TransportPublisherCreate(int port, const char* curveSecretKey, int sndHwm)
+{
+    if (port <= 0) return -5;
+    if (!hedgeedge::Zmq()) return -1;
+
+    auto transport = std::make_shared<TransportHandle>();
+    transport->publisher.reset(new hedgeedge::Publisher());
+    if (!transport->publisher->Bind(port, Text(curveSecretKey), sndHwm))
+    {
+        return -2;
+    }
+    return g_transports.Add(std::move(transport));
+}
+
+HEDGEEDGE_API int __stdcall TransportSetCompression(int handle, int codec, const char* dict, int dictLen,
+                                                    int level, const char* topicsCsv,
+                                                    unsigned int* outDictId)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (codec < 0 || codec > static_cast<int>(hedgeedge::Codec::Lz4) || dictLen < 0 || (dictLen > 0 && !dict))
+    {
+        return -5;
+    }
+
+    std::string dictionary = dictLen > 0 ? std::string(dict, static_cast<size_t>(dictLen)) : std::string();
+    if (!transport->publisher->SetCompression(static_cast<hedgeedge::Codec>(codec), dictionary, level,
+                                              hedgeedge::SplitTopics(Text(topicsCsv))))
+    {
+        return -4;
+    }
+    if (outDictId) *outDictId = transport->publisher->DictId();
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall TransportSetBatching(int handle, int windowMs, int maxEvents, int maxBytes,
+                                                 const char* envelope)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (windowMs < 0 || maxEvents < 0 || maxBytes < 0) return -5;
+
+    transport->publisher->SetBatching("EVENT", windowMs, static_cast<size_t>(maxEvents),
+                                      static_cast<size_t>(maxBytes), Text(envelope));
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall TransportSetHeartbeat(int handle, int intervalMs, const char* envelope)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (intervalMs < 0) return -5;
+
+    transport->publisher->SetHeartbeat(intervalMs, Text(envelope));
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall TransportUpdateHeartbeat(int handle, const char* fields, long long eventIndex,
+                                                     long long serverTime)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (!fields || !*fields) return -5;
+
+    transport->publisher->UpdateHeartbeat(fields, eventIndex, serverTime);
+    return 0;
+}
+
+HEDGEEDGE_API void __stdcall TransportTouch(int handle)
+{
+    auto transport = g_transports.Get(handle);
+    if (transport && transport->publisher) transport->publisher->Touch();
+}
+
+HEDGEEDGE_API int __stdcall TransportSetPriorityLane(int handle, int port, int sndHwm)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (port <= 0 || sndHwm < 0) return -5;
+
+    return transport->publisher->SetPriorityLane(port, sndHwm) ? 0 : -2;
+}
+
+HEDGEEDGE_API int __stdcall TransportSetMonitoredPort(int handle, int port, int sndHwm)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (port <= 0 || sndHwm < 0) return -5;
+
+    return transport->publisher->SetMonitoredPort(port, sndHwm) ? 0 : -2;
+}
+
+HEDGEEDGE_API int __stdcall TransportSetLagPolicy(int handle, int policies, int lagThreshold, int evictLag)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (policies < 0 || policies > 7 || lagThreshold <= 0 || evictLag < 0) return -5;
+    if ((policies & 2) && evictLag == 0) return -5;
+
+    hedgeedge::LagPolicy policy;
+    policy.shedSnapshots = (policies & 1) != 0;
+    policy.evict = (policies & 2) != 0;
+    policy.alert = (policies & 4) != 0;
+    policy.lagThreshold = static_cast<uint64_t>(lagThreshold);
+    policy.evictLag = static_cast<uint64_t>(evictLag);
+    transport->publisher->SetLagPolicy(policy);
+    return 0;
+}
+
+HEDGEEDGE_API int __stdcall TransportNextLagAlert(int handle, char* outJson, int jsonLen)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (!outJson || jsonLen <= 0) return -5;
+
+    std::string json;
+    if (!transport->publisher->NextLagAlert(json)) return 0;
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API int __stdcall TransportPublish(int handle, const char* topic, int topicLen,
+                                             const char* data, int dataLen)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->publisher) return -1;
+    if (!topic || topicLen <= 0 || !data || dataLen < 0) return -5;
+
+    std::string topicText(topic, static_cast<size_t>(topicLen));
+    return transport->publisher->Publish(topicText, data, static_cast<size_t>(dataLen)) ? 0 : -2;
+}
+
+HEDGEEDGE_API int __stdcall TransportSubscriberCreate(const char* endpoint, const char* serverKey,
+                                                      const char* clientPublicKey,
+                                                      const char* clientSecretKey, int rcvHwm)
+{
+    if (!endpoint || !*endpoint) return -5;
+    if (!hedgeedge::Zmq()) return -1;
+
+    auto transport = std::make_shared<TransportHandle>();
+    transport->subscriber.reset(new hedgeedge::Subscriber());
+    if (!transport->subscriber->Connect(endpoint, Text(serverKey), Text(clientPublicKey),
+                                        Text(clientSecretKey), rcvHwm))
+    {
+        return -2;
+    }
+    return g_transports.Add(std::move(transport));
+}
+
+HEDGEEDGE_API int __stdcall TransportSubscriberCreateMonitored(const char* endpoint, const char* serverKey,
+                                                               const char* clientPublicKey,
+                                                               const char* clientSecretKey, int rcvHwm)
+{
+    if (!endpoint || !*endpoint) return -5;
+    if (!hedgeedge::Zmq()) return -1;
+
+    auto transport = std::make_shared<TransportHandle>();
+    transport->subscriber.reset(new hedgeedge::Subscriber());
+    if (!transport->subscriber->ConnectMonitored(endpoint, Text(serverKey), Text(clientPublicKey),
+                                                 Text(clientSecretKey), rcvHwm))
+    {
+        return -2;
+    }
+    return g_transports.Add(std::move(transport));
+}
+
+HEDGEEDGE_API int __stdcall TransportConnectPriorityLane(int handle, const char* endpoint, int compressed,
+                                                         int rcvHwm)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->subscriber) return -1;
+    if (!endpoint || !*endpoint || rcvHwm < 0) return -5;
+
+    return transport->subscriber->ConnectPriorityLane(endpoint, compressed != 0, rcvHwm) ? 0 : -2;
+}
+
+HEDGEEDGE_API unsigned int __stdcall TransportLoadDictionary(int handle, const char* dict, int dictLen)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->subscriber || dictLen < 0 || (dictLen > 0 && !dict)) return 0;
+
+    std::string dictionary = dictLen > 0 ? std::string(dict, static_cast<size_t>(dictLen)) : std::string();
+    transport->subscriber->LoadDictionary(dictionary);
+    return hedgeedge::DictionaryId(dictionary);
+}
+
+HEDGEEDGE_API int __stdcall TransportSubscribe(int handle, const char* topic, int compressed)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->subscriber) return -1;
+    if (!topic || !*topic) return -5;
+
+    return transport->subscriber->Subscribe(topic, compressed != 0) ? 0 : -2;
+}
+
+HEDGEEDGE_API int __stdcall TransportReceive(int handle, char* outTopic, int topicLen,
+                                             char* outData, int dataLen, int timeoutMs)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->subscriber) return -1;
+    if (!outTopic || topicLen <= 0 || !outData || dataLen <= 0) return -5;
+
+    int rc = transport->subscriber->Receive(transport->topic, transport->data, timeoutMs);
+    if (rc <= 0) return rc;
+
+    if (transport->topic.size() >= static_cast<size_t>(topicLen) ||
+        transport->data.size() > static_cast<size_t>(dataLen))
+    {
+        return -5;
+    }
+    std::memcpy(outTopic, transport->topic.c_str(), transport->topic.size() + 1);
+    std::memcpy(outData, transport->data.data(), transport->data.size());
+    return static_cast<int>(transport->data.size());
+}
+
+HEDGEEDGE_API int __stdcall TransportTopicCompressed(int handle, const char* topic)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport || !transport->subscriber || !topic) return 0;
+    return transport->subscriber->Compressed(topic) ? 1 : 0;
+}
+
+HEDGEEDGE_API int __stdcall TransportStats(int handle, char* outJson, int jsonLen)
+{
+    auto transport = g_transports.Get(handle);
+    if (!transport) return -1;
+    if (!outJson || jsonLen <= 0) return -5;
+
+    std::string json = transport->publisher ? transport->publisher->StatsJson()
+                                            : transport->subscriber->StatsJson();
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API void __stdcall TransportClose(int handle)
+{
+    g_transports.Remove(handle);
+}
+
+} // extern "C"
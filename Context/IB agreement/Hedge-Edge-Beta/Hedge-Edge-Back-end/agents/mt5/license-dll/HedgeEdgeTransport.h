@@ -0,0 +1,605 @@
+// ============================================================================
+// Hedge Edge Native ZMQ Transport
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Native replacement for the MQL PUB/SUB data path, used when a master is
+// consumed across a WAN. The publisher binds an XPUB socket so it can see
+// which topic variants are subscribed:
+//
+//   "EVENT|{json}"      plain topic (app, local hedges, older hedges)
+//   "EVENT.Z|<frame>"   compressed variant (HedgeEdgeCompress.h frame)
+//
+// Compression is negotiated per topic: the master lists the topics it is
+// willing to compress, a hedge subscribes to "TOPIC.Z|" for the ones it
+// wants compressed, and each variant is only encoded when subscribed.
+// A hedge whose dictionary does not match falls back to the plain topic.
+//
+// Events can also be batched: a subscriber of "EVENT.B" receives bursts as
+// one HedgeEdgeBatch.h frame, flushed after a short window or a size limit.
+//
+// Heartbeats can be sent by a publisher thread instead of the EA's OnTimer, so
+// a blocked EA thread does not look like a dead master. The EA pushes its
+// latest account figures and touches the publisher from every handler; each
+// heartbeat reports "eaStallMs", the time since the last touch.
+//
+// Priority lane: POSITION_* events are also sent on a second XPUB socket with
+// its own port and high-water mark, so a trade is never queued behind a large
+// SNAPSHOT. The data port still carries every message; a lane subscriber
+// reads the lane first and drops the data-port copy by eventIndex.
+//
+// Monitored port: XPUB drops silently at a subscriber's high-water mark, so
+// the master cannot tell a slow subscriber from a healthy one. The
+// monitored port serves the same stream from a ROUTER socket to native
+// subscribers (DEALER) that send their subscriptions as XPUB-style frames
+// and acknowledge what they consumed ("ACK|<count>"). Messages queued to a
+// subscriber but not acknowledged are its lag. Each subscriber has its own
+// queue, and the lag policy applies per subscriber: SNAPSHOTs are withheld
+// first, then the laggard is evicted (sent "BYE|"; it says HELLO again once
+// it has read everything queued before), and lag changes are queued as
+// alerts. A stuck subscriber stops acknowledging altogether; it is evicted
+// even when its queue holds fewer messages than the eviction lag. Withheld and undeliverable
+// messages are counted per topic, so a stuck dashboard shows up in the stats
+// instead of silently costing hedges their trade events.
+//
+// Batch frames, heartbeats and unpacked batch events are built in a scratch
+// arena owned by the publisher / subscriber, reset per batch or heartbeat.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_TRANSPORT_H
+#define HEDGE_EDGE_TRANSPORT_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "HedgeEdgeArena.h"
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgeCompress.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+struct TopicStats
+{
+    uint64_t messages = 0;      // Plain + compressed sends (or receives)
+    uint64_t compressed = 0;    // Of which compressed
+    uint64_t rawBytes = 0;      // Payload bytes before compression
+    uint64_t wireBytes = 0;     // Bytes on the wire (topic prefix included)
+    uint64_t errors = 0;        // Send failures / decode failures
+    uint64_t dropped = 0;       // Monitored port: withheld from or not queued for a subscriber
+};
+
+// What the monitored port does about a subscriber that falls behind
+struct LagPolicy
+{
+    bool     shedSnapshots = true;  // Withhold SNAPSHOTs from a lagging subscriber
+    bool     evict = true;          // Evict at evictLag, or lagging with no ACK for 5 s
+    bool     alert = true;          // Queue lagging / recovered / evicted alerts
+    uint64_t lagThreshold = 1000;   // Unacknowledged messages from which a subscriber lags
+    uint64_t evictLag = 8000;       // Unacknowledged messages that evict
+};
+
+// Monitored port frames besides XPUB-style subscriptions ("\x01EVENT|")
+constexpr char MONITOR_HELLO[] = "HELLO|";         // Subscriber: (re)start, subscriptions follow
+constexpr char MONITOR_ACK_PREFIX[] = "ACK|";      // Subscriber: "ACK|<messages consumed>"
+constexpr char MONITOR_BYE_TOPIC[] = "BYE";        // Publisher: "BYE|{reason}", say HELLO again
+
+// Split "A,B , C" into trimmed, non-empty topics
+std::vector<std::string> SplitTopics(const std::string& csv);
+
+// Events carried by the priority lane ({"type":"POSITION_...)
+bool IsPriorityEvent(const char* data, size_t length);
+
+// "eventIndex" of an event, or -1 if absent
+int64_t EventIndex(const char* data, size_t length);
+
+// ============================================================================
+// Publisher (HE_Prop)
+// ============================================================================
+// Called from the EA thread; the batch flush thread shares the socket under
+// the publisher mutex.
+
+class Publisher
+{
+public:
+    ~Publisher() { Close(); }
+
+    // Bind an XPUB socket on tcp://*:port. `curveSecretKey` is a Z85 server
+    // secret key (empty = no CURVE).
+    bool Bind(int port, const std::string& curveSecretKey, int sndHwm, std::string* error = nullptr);
+    void Close();
+
+    // Select codec, dictionary and the topics that may be compressed
+    bool SetCompression(Codec codec, const std::string& dictionary, int level,
+                        const std::vector<std::string>& topics);
+
+    // Batch `topic` for "TOPIC.B" subscribers: flushed `windowMs` after the
+    // first event, or at `maxEvents` / `maxBytes`. `envelope` is the text
+    // shared by every event (see HedgeEdgeBatch.h). windowMs <= 0 disables.
+    void SetBatching(const std::string& topic, int windowMs, size_t maxEvents, size_t maxBytes,
+                     const std::string& envelope);
+
+    // Bind the priority lane on tcp://*:port (same CURVE key as Bind). Its
+    // high-water mark is independent of the data port's.
+    bool SetPriorityLane(int port, int sndHwm, std::string* error = nullptr);
+
+    // Send "HEARTBEAT" events every `intervalMs` from a publisher thread
+    // (<= 0 stops). `envelope` as in SetBatching.
+    void SetHeartbeat(int intervalMs, const std::string& envelope);
+
+    // Latest heartbeat figures: the data object's fields without braces and
+    // without serverTime/serverTimeUnix, which are derived from `serverTime`
+    // (broker time, seconds) plus the time elapsed since this call.
+    void UpdateHeartbeat(const std::string& fields, int64_t eventIndex, int64_t serverTime);
+
+    // EA thread liveness, called from every handler (lock-free)
+    void Touch() { m_eaTouchUs.store(NowMicros(), std::memory_order_relaxed); }
+
+    // Milliseconds since the last Touch (0 if never touched)
+    uint64_t EaStallMs() const;
+
+    // Bind the monitored port on tcp://*:port (same CURVE key as Bind)
+    bool SetMonitoredPort(int port, int sndHwm, std::string* error = nullptr);
+    void SetLagPolicy(const LagPolicy& policy);
+
+    // Oldest queued lag alert as JSON; false if none
+    bool NextLagAlert(std::string& json);
+
+    // Send one message as each subscribed variant. Returns false if a send failed.
+    bool Publish(const std::string& topic, const char* data, size_t length);
+
+    // Per-topic statistics as JSON
+    std::string StatsJson();
+
+    uint32_t DictId() const { return m_compressor.DictId(); }
+
+private:
+    struct Lane
+    {
+        void*                 socket = nullptr;
+        std::set<std::string> subscriptions;     // XPUB: first subscribe / last unsubscribe
+        std::map<std::string, TopicStats> stats;
+    };
+
+    struct Peer
+    {
+        std::set<std::string> subscriptions;
+        uint64_t sent = 0;                       // Queued since the peer subscribed
+        uint64_t acked = 0;                      // Consumed, as last acknowledged
+        uint64_t maxLag = 0;
+        bool     lagging = false;
+        uint64_t lastAckUs = 0;
+        std::map<std::string, uint64_t> dropped; // Per topic
+    };
+
+    struct Monitor
+    {
+        void*                       socket = nullptr;
+        std::map<std::string, Peer> peers;       // By routing id
+        std::map<std::string, bool> farewells;   // Evicted / unknown ids: BYE delivered?
+        std::map<std::string, TopicStats> stats;
+        LagPolicy                   policy;
+        uint64_t                    evicted = 0;
+        std::deque<std::string>     alerts;
+        uint64_t                    alertsDropped = 0;
+    };
+
+    void DrainSubscriptions(Lane& lane);
+    static bool Subscribed(const std::set<std::string>& subscriptions, const std::string& prefix,
+                           size_t minLength);
+    bool Send(Lane& lane, const std::string& prefix, const char* data, size_t length);
+    bool PublishVariants(Lane& lane, const std::string& topic, const char* data, size_t length);
+    void DrainPeers();
+    bool MonitoredSubscribed(const std::string& prefix, size_t minLength) const;
+    bool SendToPeer(const std::string& id, const std::string& frame);
+    void UpdateLag(const std::string& id, Peer& peer, bool queueFull);
+    void Evict(std::map<std::string, Peer>::iterator& it, const char* reason);
+    void Alert(const std::string& id, const Peer& peer, const char* event, const char* reason);
+    bool PublishMonitored(const std::string& topic, const char* data, size_t length);
+    bool PublishLocked(const std::string& topic, const char* data, size_t length);
+    bool FlushBatch();
+    void StopFlusher();
+    void FlushLoop();
+    void StopHeartbeat();
+    void HeartbeatLoop();
+    std::string_view BuildHeartbeat();
+
+    std::mutex            m_mutex;
+    void*                 m_context = nullptr;
+    Lane                  m_main;               // Data port: every message
+    Lane                  m_priority;           // Priority lane: POSITION_* events only
+    Monitor               m_monitor;            // Monitored port: acknowledged, per-subscriber lag
+    std::string           m_monitorBuffer;
+    std::string           m_curveSecretKey;
+    Compressor            m_compressor;
+    std::set<std::string> m_compressedTopics;
+    std::string           m_buffer;
+    Arena                 m_arena;              // Batch frames and heartbeats (under m_mutex)
+
+    EventBatch            m_batch;
+    std::string           m_batchTopic;         // e.g. "EVENT" (empty = off)
+    uint64_t              m_batchWindowUs = 0;
+    size_t                m_batchMaxEvents = 0;
+    size_t                m_batchMaxBytes = 0;
+    uint64_t              m_batchDeadlineUs = 0;
+    uint64_t              m_batchedEvents = 0;
+    std::thread           m_flusher;
+    std::condition_variable m_flushWake;
+    bool                  m_stopFlusher = false;
+
+    uint64_t              m_heartbeatIntervalUs = 0;
+    std::string           m_heartbeatEnvelope;
+    std::string           m_heartbeatFields;    // Empty until the EA pushed figures
+    int64_t               m_heartbeatIndex = 0;
+    int64_t               m_serverTime = 0;
+    uint64_t              m_serverTimeUs = 0;   // NowMicros() when m_serverTime was pushed
+    uint64_t              m_heartbeatsSent = 0;
+    std::atomic<uint64_t> m_eaTouchUs{0};
+    std::thread           m_heartbeat;
+    std::condition_variable m_heartbeatWake;
+    bool                  m_stopHeartbeat = false;
+};
+
+// ============================================================================
+// Subscriber (HE_Hedge, tools)
+// ============================================================================
+// Single-threaded: every call comes from the owning thread.
+
+class Subscriber
+{
+public:
+    Subscriber() = default;
+    // Sockets on a context shared with other subscribers (one I/O thread for
+    // many masters). The context stays owned by the caller.
+    explicit Subscriber(void* sharedContext) : m_context(sharedContext), m_sharedContext(sharedContext != nullptr) {}
+    ~Subscriber() { Close(); }
+
+    Subscriber(const Subscriber&) = delete;
+    Subscriber& operator=(const Subscriber&) = delete;
+
+    // Connect a SUB socket. CURVE keys are Z85 (all empty = no CURVE).
+    bool Connect(const std::string& endpoint, const std::string& serverKey,
+                 const std::string& clientPublicKey, const std::string& clientSecretKey,
+                 int rcvHwm, std::string* error = nullptr);
+    void Close();
+
+    // Also receive POSITION_* events from the master's priority lane. Lane
+    // messages are returned before anything queued on the data port, and the
+    // data-port copy of an event is dropped (EVENT.B batches are unpacked to
+    // "EVENT" messages for this).
+    bool ConnectPriorityLane(const std::string& endpoint, bool compressed, int rcvHwm,
+                             std::string* error = nullptr);
+
+    // Connect to the master's monitored port instead (Connect's arguments).
+    // Subscriptions and acknowledgements go to the master; after an eviction
+    // the queued messages are delivered and then the topics are subscribed
+    // again.
+    bool ConnectMonitored(const std::string& endpoint, const std::string& serverKey,
+                          const std::string& clientPublicKey, const std::string& clientSecretKey,
+                          int rcvHwm, std::string* error = nullptr);
+
+    // Dictionary used for compressed topics (must match the master's)
+    void LoadDictionary(const std::string& dictionary);
+
+    // Subscribe to a topic, switching between plain and compressed variants
+    bool Subscribe(const std::string& topic, bool compressed);
+    bool Unsubscribe(const std::string& topic);
+
+    // Receive one message (compressed variants are decoded and reported under
+    // their plain topic). Returns 1 on a message, 0 on timeout, -1 if not
+    // connected, -4 on a decode failure (the topic falls back to plain).
+    int Receive(std::string& topic, std::string& data, int timeoutMs);
+
+    // True if `topic` is currently received compressed
+    bool Compressed(const std::string& topic) const;
+
+    std::string StatsJson();
+
+    // Sockets for an external zmq_poll (then Receive with timeoutMs = 0)
+    void* Socket() const { return m_socket; }
+    void* LaneSocket() const { return m_laneSocket; }
+
+private:
+    bool Open(int type, const std::string& endpoint, const std::string& serverKey,
+              const std::string& clientPublicKey, const std::string& clientSecretKey,
+              int rcvHwm, std::string* error);
+    void CloseSockets();
+    bool SetFilter(const std::string& filter, bool subscribe);
+    void Hello();
+    void Acknowledge();
+    int  ReadFrame(void* socket, std::string& topic, std::string& data);
+    bool FirstDelivery(std::set<int64_t>& delivered, std::set<int64_t>& other, int64_t& last,
+                       int64_t index);
+    int  ReceiveLane(std::string& topic, std::string& data);
+    int  NextPending(std::string& topic, std::string& data);
+
+    void*       m_context = nullptr;
+    bool        m_sharedContext = false;
+    void*       m_socket = nullptr;
+    std::string m_serverKey;
+    std::string m_clientPublicKey;
+    std::string m_clientSecretKey;
+    std::string m_dictionary;
+    Compressor  m_zstd;
+    Compressor  m_lz4;
+    std::map<std::string, bool> m_topics;
+    std::map<std::string, TopicStats> m_stats;
+
+    bool        m_monitored = false;           // DEALER on the monitored port
+    uint64_t    m_consumed = 0;                // Messages read since (re)subscribing
+    uint64_t    m_acked = 0;
+    uint64_t    m_ackedAtUs = 0;
+    uint64_t    m_evictions = 0;
+
+    void*       m_laneSocket = nullptr;
+    bool        m_laneCompressed = false;
+    std::set<int64_t> m_laneDelivered;         // Delivered from the lane, data-port copy pending
+    std::set<int64_t> m_mainDelivered;         // Delivered from the data port, lane copy pending
+    int64_t     m_lastLaneIndex = -1;
+    int64_t     m_lastMainIndex = -1;
+    uint64_t    m_laneEvents = 0;
+    uint64_t    m_duplicates = 0;
+    Arena       m_arena;                       // Events of the batch being handed out
+    std::vector<std::string_view> m_pending;   // Unpacked batch events (in m_arena)
+    size_t      m_pendingNext = 0;             // First one not yet returned
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Return Codes (in addition to HedgeEdgeLicense.h)
+// ============================================================================
+//
+//  >0 = Handle / byte count
+//   0 = Success / no message
+//  -1 = Handle not open or libzmq not available
+//  -2 = Socket error (bind/connect/send)
+//  -4 = Codec unavailable or decode failure
+//  -5 = Parameter error or buffer too small
+//
+// ============================================================================
+
+// ============================================================================
+// Publisher (Master EA)
+// ============================================================================
+
+/**
+ * Bind the native publisher on the master data port.
+ *
+ * @param port            Data port (replaces the MQL PUB socket)
+ * @param curveSecretKey  Z85 server secret key, or empty string for no CURVE
+ * @param sndHwm          Send high-water mark (messages per subscriber)
+ *
+ * @return Handle (>0) on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportPublisherCreate(int port, const char* curveSecretKey, int sndHwm);
+
+/**
+ * Enable compression for a set of topics.
+ *
+ * @param handle      Publisher handle
+ * @param codec       1 = zstd, 2 = lz4 (0 disables compression)
+ * @param dict        Dictionary bytes (may be empty)
+ * @param dictLen     Dictionary length in bytes
+ * @param level       zstd level / LZ4 acceleration
+ * @param topicsCsv   Null-terminated comma list, e.g. "SNAPSHOT,EVENT"
+ * @param outDictId   Receives the dictionary id advertised to hedges
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSetCompression(int handle, int codec, const char* dict, int dictLen,
+                                                    int level, const char* topicsCsv,
+                                                    unsigned int* outDictId);
+
+/**
+ * Batch events for "EVENT.B" subscribers.
+ *
+ * @param handle     Publisher handle
+ * @param windowMs   Flush delay after the first event of a burst (0 = off)
+ * @param maxEvents  Flush immediately at this many events
+ * @param maxBytes   Flush immediately at this many payload bytes
+ * @param envelope   Null-terminated envelope text shared by every event
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSetBatching(int handle, int windowMs, int maxEvents, int maxBytes,
+                                                 const char* envelope);
+
+/**
+ * Send HEARTBEAT events from a publisher thread, independent of the EA thread.
+ *
+ * @param handle      Publisher handle
+ * @param intervalMs  Heartbeat interval (0 = stop)
+ * @param envelope    Null-terminated envelope text shared by every event
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSetHeartbeat(int handle, int intervalMs, const char* envelope);
+
+/**
+ * Push the latest heartbeat figures (sent from the next heartbeat on).
+ *
+ * @param fields      Null-terminated data fields without braces, e.g. "\"balance\":100.00,..."
+ * @param eventIndex  EA event index carried by native heartbeats
+ * @param serverTime  Broker server time (TimeCurrent) in seconds
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportUpdateHeartbeat(int handle, const char* fields, long long eventIndex,
+                                                     long long serverTime);
+
+/**
+ * Mark the EA thread as alive (call at the start of OnTick/OnTimer).
+ */
+HEDGEEDGE_API void __stdcall TransportTouch(int handle);
+
+/**
+ * Bind the priority lane for POSITION_* events.
+ *
+ * @param handle  Publisher handle
+ * @param port    Lane port (e.g. 51813)
+ * @param sndHwm  Lane send high-water mark (the data port keeps its own)
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSetPriorityLane(int handle, int port, int sndHwm);
+
+/**
+ * Bind the monitored port (ROUTER) for subscribers that acknowledge what
+ * they consumed, so their lag is known.
+ *
+ * @param handle  Publisher handle
+ * @param port    Monitored port (e.g. 51814)
+ * @param sndHwm  Per-subscriber send high-water mark
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSetMonitoredPort(int handle, int port, int sndHwm);
+
+/**
+ * Set what the monitored port does about lagging subscribers.
+ *
+ * @param handle        Publisher handle
+ * @param policies      1 = withhold SNAPSHOTs, 2 = evict, 4 = alert (bit mask)
+ * @param lagThreshold  Unacknowledged messages from which a subscriber lags
+ * @param evictLag      Unacknowledged messages that evict (> 0 when evicting)
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSetLagPolicy(int handle, int policies, int lagThreshold, int evictLag);
+
+/**
+ * Take the oldest lag alert, e.g.
+ * {"event":"lagging","subscriber":"006b8b4567","lag":1000,...}
+ *
+ * @return JSON length, 0 if none, negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall TransportNextLagAlert(int handle, char* outJson, int jsonLen);
+
+/**
+ * Publish one message to every subscribed variant of its topic.
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportPublish(int handle, const char* topic, int topicLen,
+                                             const char* data, int dataLen);
+
+// ============================================================================
+// Subscriber (Slave EA)
+// ============================================================================
+
+/**
+ * Connect a native subscriber to a master data port.
+ *
+ * @param endpoint         e.g. "tcp://10.0.0.5:51810" (null-terminated)
+ * @param serverKey        Master Z85 public key, or empty for no CURVE
+ * @param clientPublicKey  Client Z85 public key (CURVE only)
+ * @param clientSecretKey  Client Z85 secret key (CURVE only)
+ * @param rcvHwm           Receive high-water mark
+ *
+ * @return Handle (>0) on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSubscriberCreate(const char* endpoint, const char* serverKey,
+                                                      const char* clientPublicKey,
+                                                      const char* clientSecretKey, int rcvHwm);
+
+/**
+ * Connect a native subscriber to a master's monitored port (arguments as
+ * TransportSubscriberCreate). The master tracks this subscriber's lag.
+ *
+ * @return Handle (>0) on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSubscriberCreateMonitored(const char* endpoint, const char* serverKey,
+                                                               const char* clientPublicKey,
+                                                               const char* clientSecretKey, int rcvHwm);
+
+/**
+ * Connect to the master's priority lane (same CURVE keys as the subscriber).
+ *
+ * @param endpoint    e.g. "tcp://10.0.0.5:51813" (null-terminated)
+ * @param compressed  1 = receive "EVENT.Z" on the lane, 0 = plain
+ * @param rcvHwm      Lane receive high-water mark
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportConnectPriorityLane(int handle, const char* endpoint, int compressed,
+                                                         int rcvHwm);
+
+/**
+ * Load the compression dictionary (must be the master's dictionary).
+ *
+ * @return Dictionary id (as advertised by the master), 0 for an empty dictionary
+ */
+HEDGEEDGE_API unsigned int __stdcall TransportLoadDictionary(int handle, const char* dict, int dictLen);
+
+/**
+ * Subscribe to a topic.
+ *
+ * @param topic       Null-terminated topic, e.g. "SNAPSHOT"
+ * @param compressed  1 = receive the ".Z" variant, 0 = plain
+ *
+ * @return 0 on success, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportSubscribe(int handle, const char* topic, int compressed);
+
+/**
+ * Receive the next message (compressed topics are decoded transparently).
+ *
+ * @param outTopic   Buffer for the plain topic (null-terminated)
+ * @param topicLen   Size of the topic buffer
+ * @param outData    Buffer for the payload (not null-terminated)
+ * @param dataLen    Size of the payload buffer
+ * @param timeoutMs  0 = poll, >0 = block up to this long
+ *
+ * @return Payload length (>0), 0 if none, negative error code on failure
+ */
+HEDGEEDGE_API int __stdcall TransportReceive(int handle, char* outTopic, int topicLen,
+                                             char* outData, int dataLen, int timeoutMs);
+
+/**
+ * Check whether a topic is currently received compressed.
+ *
+ * @return 1 if compressed, 0 if plain or not subscribed
+ */
+HEDGEEDGE_API int __stdcall TransportTopicCompressed(int handle, const char* topic);
+
+// ============================================================================
+// Common
+// ============================================================================
+
+/**
+ * Per-topic statistics as JSON (messages, compressed, rawBytes, wireBytes).
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall TransportStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Close a publisher or subscriber handle.
+ */
+HEDGEEDGE_API void __stdcall TransportClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_TRANSPORT_H
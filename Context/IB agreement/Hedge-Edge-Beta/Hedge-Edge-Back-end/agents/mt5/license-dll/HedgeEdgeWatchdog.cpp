@@ -0,0 +1,328 @@
+// ============================================================================
+// Hedge Edge EA Thread Watchdog
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include "HedgeEdgeHandles.h"
+#include "HedgeEdgeWatchdog.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    const int POLL_INTERVAL_MS = 10;
+
+    std::string EscapeJson(const std::string& text)
+    {
+        std::string out;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\') out += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20) out += c;
+        }
+        return out;
+    }
+
+    // One thread polls every open watchdog; it exits with the last one
+    class WatchdogService
+    {
+    public:
+        // Reached when the DLL unloads without a WatchdogClose for every handle.
+        // On Windows this runs under the loader lock, which the exiting thread
+        // needs, so it is signalled and detached; Unregister does the real join.
+        ~WatchdogService()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            if (m_thread.joinable()) m_thread.detach();
+        }
+
+        void Register(const std::shared_ptr<Watchdog>& watchdog)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_watchdogs.push_back(watchdog);
+            if (!m_thread.joinable())
+            {
+                m_stop = false;
+                m_thread = std::thread(&WatchdogService::Run, this);
+            }
+        }
+
+        void Unregister(const std::shared_ptr<Watchdog>& watchdog)
+        {
+            std::thread finished;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_watchdogs.erase(std::remove(m_watchdogs.begin(), m_watchdogs.end(), watchdog),
+                                  m_watchdogs.end());
+                if (!m_watchdogs.empty()) return;
+                m_stop = true;
+                finished = std::move(m_thread);
+            }
+            m_wake.notify_all();
+            if (finished.joinable()) finished.join();
+        }
+
+    private:
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!m_stop)
+            {
+                std::vector<std::shared_ptr<Watchdog>> watchdogs = m_watchdogs;
+                lock.unlock();
+                for (const auto& watchdog : watchdogs) watchdog->Poll();
+                lock.lock();
+                m_wake.wait_for(lock, std::chrono::milliseconds(POLL_INTERVAL_MS));
+            }
+        }
+
+        std::mutex                             m_mutex;
+        std::condition_variable                m_wake;
+        std::vector<std::shared_ptr<Watchdog>> m_watchdogs;
+        std::thread                            m_thread;
+        bool                                   m_stop = false;
+    };
+
+    WatchdogService g_service;
+
+} // namespace
+
+// ============================================================================
+// Watchdog
+// ============================================================================
+
+Watchdog::Watchdog(const std::string& name, uint64_t stallThresholdUs, size_t topN)
+    : m_name(name), m_stallUs(stallThresholdUs), m_topN(topN)
+{
+}
+
+int Watchdog::AddLabel(const std::string& label)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = 0; i < m_labels.size(); i++)
+    {
+        if (m_labels[i] == label) return static_cast<int>(i);
+    }
+    if (m_labels.size() >= MAX_LABELS) return -1;
+    m_labels.push_back(label);
+    m_stats[m_labels.size() - 1].windows = std::make_unique<WindowedHistogram>();
+    return static_cast<int>(m_labels.size()) - 1;
+}
+
+void Watchdog::Enter(int label)
+{
+    if (label < 0 || label >= MAX_LABELS) return;
+    m_activeStartUs.store(NowMicros(), std::memory_order_relaxed);
+    m_activeLabel.store(label, std::memory_order_release);
+}
+
+void Watchdog::Leave()
+{
+    int label = m_activeLabel.exchange(-1, std::memory_order_acq_rel);
+    if (label < 0) return;
+
+    uint64_t start = m_activeStartUs.load(std::memory_order_relaxed);
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) >= RING_SIZE)
+    {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    m_ring[head & (RING_SIZE - 1)] = Sample{ label, start, NowMicros() - start };
+    m_head.store(head + 1, std::memory_order_release);
+}
+
+void Watchdog::Record(const Sample& sample, uint64_t nowUs, uint64_t wallNowUs)
+{
+    LabelStats& stats = m_stats[sample.label];
+    stats.durations.Record(sample.durationUs);
+    if (stats.windows) stats.windows->Record(sample.durationUs, sample.startUs + sample.durationUs);
+    if (sample.durationUs < m_stallUs) return;
+
+    stats.stalls++;
+    if (m_topN == 0) return;
+    if (m_slowest.size() >= m_topN && sample.durationUs <= m_slowest.back().durationUs) return;
+
+    Slow slow{ sample.label, sample.durationUs, wallNowUs - (nowUs - sample.startUs) };
+    auto position = std::upper_bound(m_slowest.begin(), m_slowest.end(), slow,
+                                     [](const Slow& a, const Slow& b) { return a.durationUs > b.durationUs; });
+    m_slowest.insert(position, slow);
+    if (m_slowest.size() > m_topN) m_slowest.pop_back();
+}
+
+void Watchdog::Poll()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t now = NowMicros();
+    uint64_t wallNow = WallMicros();
+
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    for (; tail != head; tail++) Record(m_ring[tail & (RING_SIZE - 1)], now, wallNow);
+    m_tail.store(tail, std::memory_order_release);
+
+    // A handler still running past the threshold is counted once, now
+    int label = m_activeLabel.load(std::memory_order_acquire);
+    uint64_t start = m_activeStartUs.load(std::memory_order_relaxed);
+    if (label >= 0 && now - start >= m_stallUs && (label != m_flaggedLabel || start != m_flaggedStartUs))
+    {
+        m_flaggedLabel = label;
+        m_flaggedStartUs = start;
+        m_inFlightStalls++;
+    }
+}
+
+std::string Watchdog::StatsJson()
+{
+    Poll();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t now = NowMicros();
+
+    std::string json = "{";
+    json += "\"name\":\"" + EscapeJson(m_name) + "\"";
+    json += ",\"stallThresholdUs\":" + std::to_string(m_stallUs);
+    json += ",\"dropped\":" + std::to_string(m_dropped.load(std::memory_order_relaxed));
+    json += ",\"inFlightStalls\":" + std::to_string(m_inFlightStalls);
+
+    int active = m_activeLabel.load(std::memory_order_acquire);
+    if (active >= 0 && active < static_cast<int>(m_labels.size()))
+    {
+        json += ",\"active\":{\"label\":\"" + EscapeJson(m_labels[active]) + "\"";
+        json += ",\"runningUs\":" + std::to_string(now - m_activeStartUs.load(std::memory_order_relaxed)) + "}";
+    }
+    else
+    {
+        json += ",\"active\":null";
+    }
+
+    json += ",\"handlers\":{";
+    for (size_t i = 0; i < m_labels.size(); i++)
+    {
+        if (i) json += ",";
+        std::string histogram = m_stats[i].durations.Json();
+        histogram.insert(histogram.size() - 1, ",\"stalls\":" + std::to_string(m_stats[i].stalls)
+                                               + ",\"windows\":" + m_stats[i].windows->WindowsJson(now));
+        json += "\"" + EscapeJson(m_labels[i]) + "\":" + histogram;
+    }
+    json += "}";
+
+    json += ",\"slowest\":[";
+    for (size_t i = 0; i < m_slowest.size(); i++)
+    {
+        const Slow& slow = m_slowest[i];
+        if (i) json += ",";
+        json += "{\"label\":\"" + EscapeJson(m_labels[slow.label]) + "\"";
+        json += ",\"durationUs\":" + std::to_string(slow.durationUs);
+        json += ",\"startedAtUs\":" + std::to_string(slow.wallUs) + "}";
+    }
+    json += "]}";
+    return json;
+}
+
+void Watchdog::Reset()
+{
+    Poll();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (LabelStats& stats : m_stats)
+    {
+        stats.durations.Reset();
+        if (stats.windows) stats.windows->Reset();
+        stats.stalls = 0;
+    }
+    m_slowest.clear();
+    m_inFlightStalls = 0;
+    m_dropped.store(0, std::memory_order_relaxed);
+}
+
+} // namespace hedgeedge
+
+// ============================================================================
+// Global State
+// ============================================================================
+
+namespace {
+    hedgeedge::HandleTable<hedgeedge::Watchdog> g_watchdogs;
+}
+
+// ============================================================================
+// Exported Functions
+// ============================================================================
+
+extern "C" {
+
+HEDGEEDGE_API int __stdcall WatchdogCreate(const char* name, int stallThresholdMs, int topN)
+{
+    if (stallThresholdMs <= 0 || topN < 0) return -5;
+
+    auto watchdog = std::make_shared<hedgeedge::Watchdog>(name ? name : "",
+                                                          static_cast<uint64_t>(stallThresholdMs) * 1000,
+                                                          static_cast<size_t>(topN));
+    hedgeedge::g_service.Register(watchdog);
+    return g_watchdogs.Add(std::move(watchdog));
+}
+
+HEDGEEDGE_API int __stdcall WatchdogLabel(int handle, const char* label)
+{
+    auto watchdog = g_watchdogs.Get(handle);
+    if (!watchdog) return -1;
+    if (!label || !*label) return -5;
+
+    int id = watchdog->AddLabel(label);
+    return id >= 0 ? id : -5;
+}
+
+HEDGEEDGE_API void __stdcall WatchdogEnter(int handle, int label)
+{
+    auto watchdog = g_watchdogs.Get(handle);
+    if (watchdog) watchdog->Enter(label);
+}
+
+HEDGEEDGE_API void __stdcall WatchdogLeave(int handle)
+{
+    auto watchdog = g_watchdogs.Get(handle);
+    if (watchdog) watchdog->Leave();
+}
+
+HEDGEEDGE_API int __stdcall WatchdogStats(int handle, char* outJson, int jsonLen)
+{
+    auto watchdog = g_watchdogs.Get(handle);
+    if (!watchdog) return -1;
+    if (!outJson || jsonLen <= 0) return -5;
+
+    std::string json = watchdog->StatsJson();
+    if (json.size() >= static_cast<size_t>(jsonLen)) return -5;
+    std::memcpy(outJson, json.c_str(), json.size() + 1);
+    return static_cast<int>(json.size());
+}
+
+HEDGEEDGE_API void __stdcall WatchdogReset(int handle)
+{
+    auto watchdog = g_watchdogs.Get(handle);
+    if (watchdog) watchdog->Reset();
+}
+
+HEDGEEDGE_API void __stdcall WatchdogClose(int handle)
+{
+    auto watchdog = g_watchdogs.Remove(handle);
+    if (watchdog) hedgeedge::g_service.Unregister(watchdog);
+}
+
+} // extern "C"
@@ -0,0 +1,155 @@
+// ============================================================================
+// Hedge Edge EA Thread Watchdog
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Measures how long each EA handler (OnTick, OnTimer, OnTradeTransaction, ...)
+// keeps the EA thread busy. The EA marks handler entry and exit; both calls
+// only store a timestamp, and the exit pushes one sample into a lock-free
+// ring. A shared watchdog thread drains the rings into per-handler
+// histograms (lifetime plus 1m / 15m / 1h windows), keeps the N slowest
+// invocations, and notices a handler that is still running past the stall
+// threshold.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_WATCHDOG_H
+#define HEDGE_EDGE_WATCHDOG_H
+
+#include "HedgeEdgePlatform.h"
+
+#ifdef __cplusplus
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeHistogram.h"
+
+namespace hedgeedge {
+
+class Watchdog
+{
+public:
+    static constexpr int    MAX_LABELS = 64;
+    static constexpr size_t RING_SIZE = 4096;      // Power of two
+
+    Watchdog(const std::string& name, uint64_t stallThresholdUs, size_t topN);
+
+    // Register a handler label once; returns its id or -1 if the table is full
+    int AddLabel(const std::string& label);
+
+    // EA thread only: wait-free
+    void Enter(int label);
+    void Leave();
+
+    // Watchdog thread: drain samples and check the handler in flight
+    void Poll();
+
+    std::string StatsJson();
+    void Reset();
+
+private:
+    struct Sample
+    {
+        int      label;
+        uint64_t startUs;
+        uint64_t durationUs;
+    };
+
+    struct Slow
+    {
+        int      label;
+        uint64_t durationUs;
+        uint64_t wallUs;       // When the invocation started
+    };
+
+    struct LabelStats
+    {
+        Histogram durations;
+        std::unique_ptr<WindowedHistogram> windows;  // Allocated by AddLabel
+        uint64_t  stalls = 0;
+    };
+
+    void Record(const Sample& sample, uint64_t nowUs, uint64_t wallNowUs);
+
+    std::string           m_name;
+    uint64_t              m_stallUs;
+    size_t                m_topN;
+
+    // Written by the EA thread
+    std::atomic<int>      m_activeLabel{-1};
+    std::atomic<uint64_t> m_activeStartUs{0};
+    std::array<Sample, RING_SIZE> m_ring{};
+    std::atomic<uint64_t> m_head{0};
+    std::atomic<uint64_t> m_tail{0};
+    std::atomic<uint64_t> m_dropped{0};
+
+    // Owned by the watchdog thread, read by StatsJson
+    std::mutex            m_mutex;
+    std::vector<std::string> m_labels;
+    std::array<LabelStats, MAX_LABELS> m_stats;
+    std::vector<Slow>     m_slowest;            // Sorted, longest first
+    uint64_t              m_inFlightStalls = 0; // Stalls noticed while running
+    int                   m_flaggedLabel = -1;
+    uint64_t              m_flaggedStartUs = 0;
+};
+
+} // namespace hedgeedge
+
+extern "C" {
+#endif // __cplusplus
+
+// ============================================================================
+// Watchdog
+// ============================================================================
+
+/**
+ * Create a watchdog for one EA thread.
+ *
+ * @param name              Null-terminated name, e.g. "HE_Prop"
+ * @param stallThresholdMs  Handler duration counted as a stall
+ * @param topN              Slowest invocations kept (e.g. 20)
+ *
+ * @return Handle (>0) on success, -5 on a parameter error
+ */
+HEDGEEDGE_API int __stdcall WatchdogCreate(const char* name, int stallThresholdMs, int topN);
+
+/**
+ * Register a handler label (call once per label at init).
+ *
+ * @return Label id (>=0), -1 if not open, -5 if the label table is full
+ */
+HEDGEEDGE_API int __stdcall WatchdogLabel(int handle, const char* label);
+
+/**
+ * Mark handler entry / exit on the EA thread.
+ */
+HEDGEEDGE_API void __stdcall WatchdogEnter(int handle, int label);
+HEDGEEDGE_API void __stdcall WatchdogLeave(int handle);
+
+/**
+ * Per-handler histograms (microseconds), stall counts and slowest invocations.
+ *
+ * @return JSON length, or negative error code (-5 if the buffer is too small)
+ */
+HEDGEEDGE_API int __stdcall WatchdogStats(int handle, char* outJson, int jsonLen);
+
+/**
+ * Clear histograms and slowest invocations.
+ */
+HEDGEEDGE_API void __stdcall WatchdogReset(int handle);
+
+/**
+ * Close a watchdog handle.
+ */
+HEDGEEDGE_API void __stdcall WatchdogClose(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEDGE_EDGE_WATCHDOG_H
@@ -0,0 +1,131 @@
+// ============================================================================
+// Hedge Edge ZeroMQ Runtime Binding
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+
+#include <cstdlib>
+#include <mutex>
+
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeZmq.h"
+
+namespace hedgeedge {
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+namespace {
+
+    ZmqApi g_api = {};
+    bool   g_loaded = false;
+    std::once_flag g_loadOnce;
+
+    template <typename T>
+    bool Bind(void* library, const char* name, T& slot)
+    {
+        slot = reinterpret_cast<T>(LibrarySymbol(library, name));
+        return slot != nullptr;
+    }
+
+    void LoadZmq()
+    {
+        void* library = nullptr;
+
+        const char* overridePath = std::getenv("HEDGEEDGE_LIBZMQ");
+        if (overridePath && *overridePath)
+        {
+            library = LoadSharedLibrary({ overridePath });
+        }
+        if (!library)
+        {
+#ifdef _WIN32
+            // Already mapped by the EA's #import, so this resolves to the same module
+            library = LoadSharedLibrary({ "libzmq.dll", "libzmq-mt-4_3_5.dll", "libzmq-mt-4_3_4.dll" });
+#elif defined(__APPLE__)
+            library = LoadSharedLibrary({ "libzmq.5.dylib", "libzmq.dylib" });
+#else
+            library = LoadSharedLibrary({ "libzmq.so.5", "libzmq.so" });
+#endif
+        }
+        if (!library) return;
+
+        bool ok = Bind(library, "zmq_version", g_api.version) &&
+                  Bind(library, "zmq_ctx_new", g_api.ctx_new) &&
+                  Bind(library, "zmq_ctx_term", g_api.ctx_term) &&
+                  Bind(library, "zmq_socket", g_api.socket) &&
+                  Bind(library, "zmq_close", g_api.close) &&
+                  Bind(library, "zmq_setsockopt", g_api.setsockopt) &&
+                  Bind(library, "zmq_getsockopt", g_api.getsockopt) &&
+                  Bind(library, "zmq_bind", g_api.bind) &&
+                  Bind(library, "zmq_connect", g_api.connect) &&
+                  Bind(library, "zmq_send", g_api.send) &&
+                  Bind(library, "zmq_recv", g_api.recv) &&
+                  Bind(library, "zmq_poll", g_api.poll) &&
+                  Bind(library, "zmq_errno", g_api.errno_) &&
+                  Bind(library, "zmq_strerror", g_api.strerror) &&
+                  Bind(library, "zmq_msg_init", g_api.msg_init) &&
+                  Bind(library, "zmq_msg_recv", g_api.msg_recv) &&
+                  Bind(library, "zmq_msg_close", g_api.msg_close) &&
+                  Bind(library, "zmq_msg_data", g_api.msg_data) &&
+                  Bind(library, "zmq_msg_size", g_api.msg_size);
+        if (!ok) return;
+
+        // zmq_msg_t grew to 64 bytes in 4.x; older runtimes are not supported
+        int major = 0, minor = 0, patch = 0;
+        g_api.version(&major, &minor, &patch);
+        g_loaded = major >= 4;
+    }
+
+} // namespace
+
+const ZmqApi* Zmq()
+{
+    std::call_once(g_loadOnce, LoadZmq);
+    return g_loaded ? &g_api : nullptr;
+}
+
+std::string ZmqLastError()
+{
+    const ZmqApi* zmq = Zmq();
+    if (!zmq) return "libzmq not available";
+    return zmq->strerror(zmq->errno_());
+}
+
+bool ZmqSetInt(void* socket, int option, int value)
+{
+    const ZmqApi* zmq = Zmq();
+    return zmq && zmq->setsockopt(socket, option, &value, sizeof(value)) == 0;
+}
+
+// ============================================================================
+// ZmqFrame
+// ============================================================================
+
+ZmqFrame::ZmqFrame()
+{
+    Zmq()->msg_init(&m_message);
+}
+
+ZmqFrame::~ZmqFrame()
+{
+    Zmq()->msg_close(&m_message);
+}
+
+int ZmqFrame::Receive(void* socket, int flags)
+{
+    return Zmq()->msg_recv(&m_message, socket, flags);
+}
+
+const char* ZmqFrame::Data()
+{
+    return static_cast<const char*>(Zmq()->msg_data(&m_message));
+}
+
+size_t ZmqFrame::Size() const
+{
+    return Zmq()->msg_size(&m_message);
+}
+
+} // namespace hedgeedge
@@ -0,0 +1,131 @@
+// ============================================================================
+// Hedge Edge ZeroMQ Runtime Binding
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// The native transport talks to the same libzmq the EAs already import
+// (MQL5/Libraries/libzmq.dll). It is bound at run time instead of linked so
+// HedgeEdgeLicense.dll keeps loading on terminals without ZeroMQ; set
+// HEDGEEDGE_LIBZMQ to an explicit library path to override the search.
+// ============================================================================
+
+#ifndef HEDGE_EDGE_ZMQ_H
+#define HEDGE_EDGE_ZMQ_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hedgeedge {
+
+// ============================================================================
+// ZeroMQ Constants (subset of zmq.h used by the native transport)
+// ============================================================================
+
+constexpr int ZMQ_PAIR   = 0;
+constexpr int ZMQ_PUB    = 1;
+constexpr int ZMQ_SUB    = 2;
+constexpr int ZMQ_REQ    = 3;
+constexpr int ZMQ_REP    = 4;
+constexpr int ZMQ_DEALER = 5;
+constexpr int ZMQ_ROUTER = 6;
+constexpr int ZMQ_XPUB   = 9;
+
+constexpr int ZMQ_ROUTING_ID     = 5;
+constexpr int ZMQ_SUBSCRIBE      = 6;
+constexpr int ZMQ_UNSUBSCRIBE    = 7;
+constexpr int ZMQ_RCVMORE        = 13;
+constexpr int ZMQ_LINGER         = 17;
+constexpr int ZMQ_SNDHWM         = 23;
+constexpr int ZMQ_RCVHWM         = 24;
+constexpr int ZMQ_RCVTIMEO       = 27;
+constexpr int ZMQ_SNDTIMEO       = 28;
+constexpr int ZMQ_ROUTER_MANDATORY = 33;
+constexpr int ZMQ_CURVE_SERVER   = 47;
+constexpr int ZMQ_CURVE_PUBLICKEY = 48;
+constexpr int ZMQ_CURVE_SECRETKEY = 49;
+constexpr int ZMQ_CURVE_SERVERKEY = 50;
+
+constexpr int ZMQ_DONTWAIT = 1;
+constexpr int ZMQ_SNDMORE  = 2;
+
+constexpr short ZMQ_POLLIN  = 1;
+constexpr short ZMQ_POLLOUT = 2;
+
+struct ZmqPollItem
+{
+    void*  socket;
+#ifdef _WIN32
+    uintptr_t fd;
+#else
+    int    fd;
+#endif
+    short  events;
+    short  revents;
+};
+
+// Opaque zmq_msg_t (64 bytes in every libzmq 4.x ABI)
+struct alignas(8) ZmqMessage
+{
+    unsigned char storage[64];
+};
+
+// ============================================================================
+// Function Table
+// ============================================================================
+
+struct ZmqApi
+{
+    void  (*version)(int* major, int* minor, int* patch);
+    void* (*ctx_new)();
+    int   (*ctx_term)(void* context);
+    void* (*socket)(void* context, int type);
+    int   (*close)(void* socket);
+    int   (*setsockopt)(void* socket, int option, const void* value, size_t length);
+    int   (*getsockopt)(void* socket, int option, void* value, size_t* length);
+    int   (*bind)(void* socket, const char* endpoint);
+    int   (*connect)(void* socket, const char* endpoint);
+    int   (*send)(void* socket, const void* data, size_t length, int flags);
+    int   (*recv)(void* socket, void* buffer, size_t length, int flags);
+    int   (*poll)(ZmqPollItem* items, int count, long timeoutMs);
+    int   (*errno_)();
+    const char* (*strerror)(int error);
+    int   (*msg_init)(ZmqMessage* message);
+    int   (*msg_recv)(ZmqMessage* message, void* socket, int flags);
+    int   (*msg_close)(ZmqMessage* message);
+    void* (*msg_data)(ZmqMessage* message);
+    size_t (*msg_size)(const ZmqMessage* message);
+};
+
+// Bound libzmq, or nullptr if it cannot be loaded (resolved once per process)
+const ZmqApi* Zmq();
+
+// Last libzmq error as text ("libzmq not available" if not loaded)
+std::string ZmqLastError();
+
+// Set an int socket option
+bool ZmqSetInt(void* socket, int option, int value);
+
+// Received message owning its zmq_msg_t
+class ZmqFrame
+{
+public:
+    ZmqFrame();
+    ~ZmqFrame();
+
+    ZmqFrame(const ZmqFrame&) = delete;
+    ZmqFrame& operator=(const ZmqFrame&) = delete;
+
+    // Returns bytes received, -1 on error / EAGAIN
+    int Receive(void* socket, int flags);
+
+    const char* Data();
+    size_t      Size() const;
+
+private:
+    ZmqMessage m_message;
+};
+
+} // namespace hedgeedge
+
+#endif // HEDGE_EDGE_ZMQ_H
@@ -13,12 +13,15 @@
 #   .\build_dll.ps1 -Clean       # Clean and rebuild
 #   .\build_dll.ps1 -Debug       # Build Debug x64
 #   .\build_dll.ps1 -Deploy      # Build and deploy to MT5 terminals
+#   .\build_dll.ps1 -Pgo         # Profile-guided Release build
 # ============================================================================
 
 param(
     [switch]$Clean,
     [switch]$Debug,
     [switch]$Deploy,
+    [switch]$Pgo,
+    [int]$PgoSeconds = 30,
     [switch]$Help
 )
 
@@ -26,6 +29,8 @@ param(
 $ScriptDir = Split-Path -Parent $MyInvocation.MyCommand.Path
 $BuildDir = Join-Path $ScriptDir "build"
 $BuildConfig = if ($Debug) { "Debug" } else { "Release" }
+$PgoDir = Join-Path $BuildDir "pgo"
+$PgoPort = 51830
 
 # Visual Studio versions to search for
 $VSVersions = @(
@@ -78,6 +83,8 @@ OPTIONS:
     -Clean      Clean the build directory before building
     -Debug      Build Debug configuration (default is Release)
     -Deploy     Build and deploy to all detected MT5 terminals
+    -Pgo        Profile-guided build: instrument, train, rebuild (Release)
+    -PgoSeconds Length of each training pass (default 30)
     -Help       Show this help message
 
 EXAMPLES:
@@ -85,11 +92,13 @@ EXAMPLES:
     .\build_dll.ps1 -Clean         # Clean rebuild
     .\build_dll.ps1 -Deploy        # Build and deploy to MT5
     .\build_dll.ps1 -Debug -Clean  # Clean Debug build
+    .\build_dll.ps1 -Pgo -Deploy   # Profile-guided build, then deploy
 
 PREREQUISITES:
     - Visual Studio 2019+ with C++ Desktop workload
     - CMake (included with Visual Studio)
     - Windows SDK
+    - -Pgo: libzmq.dll and libzstd.dll next to the tools or on PATH
 
 "@
 }
@@ -184,6 +193,8 @@ function Find-MT5Terminals {
 }
 
 function Build-DLL {
+    param([string[]]$ExtraArgs = @())
+    
     Write-Banner "Building Hedge Edge License DLL"
     
     # Find CMake
@@ -224,9 +235,8 @@ function Build-DLL {
     
     $configArgs = @(
         "-G", $generator,
-        "-A", "x64",
-        ".."
-    )
+        "-A", "x64"
+    ) + $ExtraArgs + @("..")
     
     & $CMakePath $configArgs
     
@@ -267,6 +277,112 @@ function Build-DLL {
     }
 }
 
+function Find-PgoRuntime {
+    # pgort140.dll (instrumented DLL runtime) and pgomgr.exe live in the
+    # MSVC x64 host tools directory
+    $programFiles = @($env:ProgramFiles, ${env:ProgramFiles(x86)})
+    
+    foreach ($pf in $programFiles) {
+        $vsPath = Join-Path $pf "Microsoft Visual Studio"
+        if (Test-Path $vsPath) {
+            $pgomgr = Get-ChildItem -Path $vsPath -Recurse -Filter "pgomgr.exe" -ErrorAction SilentlyContinue |
+                      Where-Object { $_.FullName -match "Hostx64\\x64" } |
+                      Sort-Object FullName -Descending |
+                      Select-Object -First 1
+            if ($pgomgr) {
+                return $pgomgr.DirectoryName
+            }
+        }
+    }
+    
+    return $null
+}
+
+function Invoke-PgoPass {
+    param(
+        [string]$Label,
+        [string[]]$GeneratorArgs,
+        [string[]]$TrainArgs
+    )
+    
+    $binDir = Join-Path $BuildDir "bin\$BuildConfig"
+    $loadGen = Join-Path $binDir "HedgeEdgeLoadGen.exe"
+    $trainer = Join-Path $binDir "HedgeEdgePgoTrain.exe"
+    
+    Write-Step "Training pass: $Label"
+    $master = Start-Process -FilePath $loadGen -PassThru -NoNewWindow `
+        -ArgumentList (@("--port", $PgoPort, "--seconds", ($PgoSeconds + 5)) + $GeneratorArgs)
+    Start-Sleep -Seconds 1
+    
+    & $trainer --connect "tcp://127.0.0.1:$PgoPort" --port ($PgoPort + 1) --seconds $PgoSeconds $TrainArgs | Out-Host
+    $trained = ($LASTEXITCODE -eq 0)
+    
+    $master.WaitForExit()
+    return $trained
+}
+
+function Build-Pgo {
+    Write-Banner "Profile-Guided Build"
+    
+    if ($Debug) {
+        Write-Error-Custom "-Pgo builds Release only"
+        return $false
+    }
+    
+    $pgoTools = Find-PgoRuntime
+    if (-not $pgoTools) {
+        Write-Error-Custom "pgomgr.exe / pgort140.dll not found (MSVC x64 build tools)"
+        return $false
+    }
+    Write-Info "PGO tools: $pgoTools"
+    $env:PATH = "$pgoTools;$env:PATH"
+    
+    # 1. Instrumented DLL
+    if (Test-Path $PgoDir) {
+        Remove-Item -Path $PgoDir -Recurse -Force
+    }
+    New-Item -ItemType Directory -Path $PgoDir -Force | Out-Null
+    
+    # Build-DLL also emits the CMake output; its result is the last value
+    if (@(Build-DLL -ExtraArgs @("-DHEDGEEDGE_PGO=GENERATE", "-DHEDGEEDGE_PGO_DIR=$PgoDir"))[-1] -ne $true) {
+        return $false
+    }
+    
+    # 2. Training: compressed stream, then batched bursts
+    $binDir = Join-Path $BuildDir "bin\$BuildConfig"
+    Get-ChildItem -Path @($binDir, $PgoDir) -Filter "HedgeEdgeLicense!*.pgc" -ErrorAction SilentlyContinue |
+        Remove-Item -Force
+    
+    $passes = @(
+        @{ Label = "compressed"; Generator = @("--rate", "2000", "--snapshot-ms", "250", "--compress", "zstd");
+           Train = @("--compressed") },
+        @{ Label = "batched"; Generator = @("--rate", "2000", "--shape", "burst", "--burst", "50", "--batch-ms", "5");
+           Train = @("--batched") }
+    )
+    foreach ($pass in $passes) {
+        if (-not (Invoke-PgoPass -Label $pass.Label -GeneratorArgs $pass.Generator -TrainArgs $pass.Train)) {
+            Write-Error-Custom "Training pass '$($pass.Label)' failed (is libzmq.dll on PATH?)"
+            return $false
+        }
+    }
+    
+    # 3. Merge the counts into the .pgd
+    $pgd = Join-Path $PgoDir "HedgeEdgeLicense.pgd"
+    $pgcFiles = Get-ChildItem -Path @($binDir, $PgoDir) -Filter "HedgeEdgeLicense!*.pgc" -ErrorAction SilentlyContinue
+    if ($pgcFiles.Count -eq 0) {
+        Write-Error-Custom "The instrumented DLL wrote no profile (.pgc)"
+        return $false
+    }
+    Write-Step "Merging $($pgcFiles.Count) profile(s) into $pgd"
+    foreach ($pgc in $pgcFiles) {
+        & (Join-Path $pgoTools "pgomgr.exe") /merge $pgc.FullName $pgd | Out-Null
+        Remove-Item -Path $pgc.FullName -Force
+    }
+    
+    # 4. Optimized DLL
+    return (@(Build-DLL -ExtraArgs @("-DHEDGEEDGE_PGO=USE", "-DHEDGEEDGE_PGO_DIR=$PgoDir"))[-1] -eq $true)
+}
+
 function Deploy-ToMT5 {
     Write-Banner "Deploying to MT5 Terminals"
     
@@ -366,7 +482,8 @@ Write-Host "  Version 1.0.0" -ForegroundColor Gray
 Write-Host ""
 
 # Build the DLL
-$buildSuccess = Build-DLL
+# (a plain build after -Pgo in the same directory drops the profile again)
+$buildSuccess = if ($Pgo) { Build-Pgo } else { Build-DLL -ExtraArgs @("-DHEDGEEDGE_PGO=OFF") }
 
 if (-not $buildSuccess) {
     exit 1
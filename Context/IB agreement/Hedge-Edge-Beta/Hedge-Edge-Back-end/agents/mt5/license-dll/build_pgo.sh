@@ -0,0 +1,133 @@
+#!/usr/bin/env bash
+# ============================================================================
+# Hedge Edge Profile-Guided Build (Linux, GCC or Clang)
+# ============================================================================
+# Builds HedgeEdgeCore instrumented, trains it with the project's own
+# workloads, then rebuilds it optimized for that profile:
+#
+#   format     HedgeEdgeFormatBench (number and timestamp formatting)
+#   alloc      HedgeEdgeAllocCheck (event encoding, batching, compression)
+#   exposure   HedgeEdgeExposureBench (exposure book recompute per tick)
+#   stream     HedgeEdgeLoadGen into HedgeEdgeSubBench and HedgeEdgeRecorder,
+#              plain + compressed and batched (needs libzmq, zstd)
+#   replay     HedgeEdgeReplay over the recording just made and any
+#              --recording files (decode, parse, copy decisions)
+#
+# Usage:
+#   ./build_pgo.sh [--build-dir DIR] [--seconds N] [--port N]
+#                  [--recording FILE]...
+#
+# The tools in DIR/bin are left built with the profile. Set HEDGEEDGE_LIBZMQ
+# if libzmq is not on the library path.
+# ============================================================================
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+BUILD_DIR="$SCRIPT_DIR/build-pgo"
+SECONDS_PER_RUN=20
+PORT=51830
+RECORDINGS=()
+
+usage() {
+    echo "usage: $0 [--build-dir DIR] [--seconds N] [--port N] [--recording FILE]..." >&2
+}
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+        --build-dir) BUILD_DIR="$2"; shift 2 ;;
+        --seconds)   SECONDS_PER_RUN="$2"; shift 2 ;;
+        --port)      PORT="$2"; shift 2 ;;
+        --recording) RECORDINGS+=("$(realpath "$2")"); shift 2 ;;
+        -h|--help)   usage; exit 0 ;;
+        *)           usage; exit 2 ;;
+    esac
+done
+
+PGO_DIR="$BUILD_DIR/pgo"
+BIN="$BUILD_DIR/bin"
+JOBS="$(nproc 2>/dev/null || echo 4)"
+
+step() {
+    echo "[*] $*"
+}
+
+configure_and_build() {
+    cmake -S "$SCRIPT_DIR" -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release \
+          -DHEDGEEDGE_PGO="$1" -DHEDGEEDGE_PGO_DIR="$PGO_DIR" > /dev/null
+    cmake --build "$BUILD_DIR" -j"$JOBS"
+}
+
+# Run a master and its consumers for one pass; false if the master fails
+stream_pass() {
+    local label="$1"; shift
+    local generator=("$@")
+    local endpoint="tcp://127.0.0.1:$PORT"
+    local consumer_seconds=$((SECONDS_PER_RUN - 2))
+
+    step "stream: $label"
+    "$BIN/HedgeEdgeLoadGen" --port "$PORT" --seconds "$SECONDS_PER_RUN" "${generator[@]}" > /dev/null &
+    local master=$!
+    sleep 1
+    "$BIN/HedgeEdgeSubBench" --connect "$endpoint" --seconds "$consumer_seconds" \
+        "${CONSUMER_FLAGS[@]}" > /dev/null &
+    local bench=$!
+    "$BIN/HedgeEdgeRecorder" --connect "$endpoint" --seconds "$consumer_seconds" \
+        --out "$PGO_DIR/$label.herec" "${CONSUMER_FLAGS[@]}" > /dev/null
+    wait "$bench"
+    wait "$master"
+}
+
+# ============================================================================
+# Instrumented Build
+# ============================================================================
+
+step "Building instrumented core in $BUILD_DIR"
+rm -rf "$PGO_DIR"
+mkdir -p "$PGO_DIR"
+configure_and_build GENERATE
+
+# ============================================================================
+# Training
+# ============================================================================
+
+step "format"
+"$BIN/HedgeEdgeFormatBench" --check 200000 --bench 2000000 > /dev/null
+
+step "alloc"
+"$BIN/HedgeEdgeAllocCheck" --batches 20000 > /dev/null
+
+step "exposure"
+"$BIN/HedgeEdgeExposureBench" --positions 300 --symbols 8 --ticks 20000 > /dev/null
+
+CONSUMER_FLAGS=()
+if stream_pass plain --rate 2000 --snapshot-ms 250; then
+    RECORDINGS+=("$PGO_DIR/plain.herec")
+    CONSUMER_FLAGS=(--compressed)
+    stream_pass compressed --rate 2000 --snapshot-ms 250 --compress zstd && \
+        RECORDINGS+=("$PGO_DIR/compressed.herec")
+    CONSUMER_FLAGS=(--batched)
+    stream_pass batched --rate 2000 --shape burst --burst 50 --batch-ms 5 && \
+        RECORDINGS+=("$PGO_DIR/batched.herec")
+else
+    echo "[!] WARNING: HedgeEdgeLoadGen failed (libzmq missing?); the profile lacks the stream paths" >&2
+fi
+
+for recording in "${RECORDINGS[@]}"; do
+    step "replay: $(basename "$recording")"
+    "$BIN/HedgeEdgeReplay" "$recording" --max --repeat 5 > /dev/null
+done
+
+# Clang leaves raw profiles to merge; GCC's .gcda files are used as they are
+if compgen -G "$PGO_DIR/*.profraw" > /dev/null; then
+    step "Merging raw profiles"
+    llvm-profdata merge -output="$PGO_DIR/hedgeedge.profdata" "$PGO_DIR"/*.profraw
+fi
+
+# ============================================================================
+# Optimized Build
+# ============================================================================
+
+step "Rebuilding with the profile"
+configure_and_build USE
+step "Done: $BIN (profile in $PGO_DIR)"
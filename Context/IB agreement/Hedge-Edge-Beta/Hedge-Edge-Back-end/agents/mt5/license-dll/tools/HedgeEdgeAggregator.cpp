@@ -0,0 +1,506 @@
+// ============================================================================
+// Hedge Edge Aggregation Daemon
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Subscribes to the EVENT and SNAPSHOT streams of many master EAs, keeps the
+// state of every account in one table and answers queries on a local REP
+// socket, so the dashboard asks one process instead of parsing every
+// master's stream itself. All masters share one ZMQ context and are served
+// by a single zmq_poll loop.
+//
+// Usage:
+//   HedgeEdgeAggregator [--bind ENDPOINT] [--master ENDPOINT[@SERVERKEY]]...
+//                       [--masters FILE] [--registry]
+//                       [--curve-public KEY --curve-secret KEY]
+//                       [--dict FILE] [--compressed] [--batched] [--stale-ms N]
+//                       [--series DIR]
+//
+//   --masters FILE  one ENDPOINT[@SERVERKEY] per line (# comments)
+//   --registry      follow the master EAs in the host agent registry
+//   --batched       take EVENT.B instead of EVENT (masters with batching on)
+//   --series DIR    record every heartbeat into the equity time series in DIR
+//
+// Queries (JSON, like the EA command sockets):
+//   {"action":"SUMMARY"}   totals across accounts, worst drawdown
+//   {"action":"ACCOUNTS"}  every account without positions
+//   {"action":"ACCOUNT","accountId":"..."}
+//   {"action":"EXPOSURE"}  net / gross lots per symbol
+//   {"action":"SERIES","accountId":"...","from":MS,"to":MS,"maxPoints":N}
+//                          equity curve, downsampled (needs --series)
+//   {"action":"STATS"}     per-master transport statistics
+//   {"action":"PING"}
+// ============================================================================
+
+#include <climits>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "HedgeEdgeAccounts.h"
+#include "HedgeEdgeArena.h"
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeJson.h"
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeRegistry.h"
+#include "HedgeEdgeSeries.h"
+#include "HedgeEdgeTransport.h"
+#include "HedgeEdgeZmq.h"
+
+namespace {
+
+    const char DEFAULT_BIND[] = "tcp://127.0.0.1:51900";
+    const int  POLL_INTERVAL_MS = 500;
+    const int  RECEIVE_HWM = 100000;
+    const int  MAX_DRAIN = 1000;           // Messages per master per poll, for fairness
+    const uint64_t SERIES_FLUSH_US = 300000000;
+    const size_t DEFAULT_SERIES_POINTS = 500;
+
+    volatile std::sig_atomic_t g_stop = 0;
+
+    void OnSignal(int)
+    {
+        g_stop = 1;
+    }
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgeAggregator [--bind ENDPOINT] [--master ENDPOINT[@SERVERKEY]]...\n"
+            "                           [--masters FILE] [--registry]\n"
+            "                           [--curve-public KEY --curve-secret KEY]\n"
+            "                           [--dict FILE] [--compressed] [--batched] [--stale-ms N]\n"
+            "                           [--series DIR]\n");
+    }
+
+    struct Options
+    {
+        std::string bind = DEFAULT_BIND;
+        std::vector<std::string> masters;
+        bool        registry = false;
+        std::string curvePublic;
+        std::string curveSecret;
+        std::string dictionary;
+        bool        compressed = false;
+        bool        batched = false;
+        uint64_t    staleUs = 10000000;
+        std::string seriesDirectory;
+    };
+
+    struct Master
+    {
+        std::string endpoint;
+        std::string serverKey;
+        bool        fromRegistry = false;
+        std::unique_ptr<hedgeedge::Subscriber> subscriber;
+    };
+
+    bool ReadMastersFile(const std::string& path, std::vector<std::string>& out)
+    {
+        std::string text;
+        if (!hedgeedge::ReadFileBytes(path, text)) return false;
+
+        size_t pos = 0;
+        while (pos < text.size())
+        {
+            size_t end = text.find('\n', pos);
+            if (end == std::string::npos) end = text.size();
+            std::string line = text.substr(pos, end - pos);
+            pos = end + 1;
+
+            size_t first = line.find_first_not_of(" \t\r");
+            size_t last = line.find_last_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') continue;
+            out.push_back(line.substr(first, last - first + 1));
+        }
+        return true;
+    }
+
+    class Aggregator
+    {
+    public:
+        explicit Aggregator(const Options& options) : m_options(options) {}
+        ~Aggregator()
+        {
+            m_masters.clear();
+            if (m_rep) hedgeedge::Zmq()->close(m_rep);
+            if (m_context) hedgeedge::Zmq()->ctx_term(m_context);
+        }
+
+        bool Start()
+        {
+            const hedgeedge::ZmqApi* zmq = hedgeedge::Zmq();
+            if (!zmq)
+            {
+                std::fprintf(stderr, "libzmq not available\n");
+                return false;
+            }
+
+            m_context = zmq->ctx_new();
+            m_rep = m_context ? zmq->socket(m_context, hedgeedge::ZMQ_REP) : nullptr;
+            if (!m_rep || zmq->bind(m_rep, m_options.bind.c_str()) != 0)
+            {
+                std::fprintf(stderr, "cannot bind %s: %s\n", m_options.bind.c_str(),
+                             hedgeedge::ZmqLastError().c_str());
+                return false;
+            }
+            hedgeedge::ZmqSetInt(m_rep, hedgeedge::ZMQ_LINGER, 0);
+
+            for (const std::string& spec : m_options.masters)
+            {
+                size_t at = spec.find('@');
+                AddMaster(spec.substr(0, at), at == std::string::npos ? std::string() : spec.substr(at + 1), false);
+            }
+
+            if (m_options.registry)
+            {
+                if (!m_registry.Open())
+                {
+                    std::fprintf(stderr, "cannot open the agent registry\n");
+                    return false;
+                }
+                SyncRegistry();
+            }
+
+            if (m_masters.empty() && !m_options.registry)
+            {
+                std::fprintf(stderr, "no masters given\n");
+                return false;
+            }
+
+            if (!m_options.seriesDirectory.empty())
+            {
+                m_series.reset(new hedgeedge::SeriesStore(m_options.seriesDirectory));
+                m_seriesFlushUs = hedgeedge::NowMicros();
+            }
+            std::fprintf(stderr, "serving %s, %zu master(s)\n", m_options.bind.c_str(), m_masters.size());
+            return true;
+        }
+
+        void Run()
+        {
+            const hedgeedge::ZmqApi* zmq = hedgeedge::Zmq();
+            std::vector<hedgeedge::ZmqPollItem> items;
+
+            while (!g_stop)
+            {
+                if (m_options.registry && m_registry.Generation() != m_registryGeneration) SyncRegistry();
+                if (m_series && hedgeedge::NowMicros() - m_seriesFlushUs >= SERIES_FLUSH_US)
+                {
+                    m_series->Flush();
+                    m_seriesFlushUs = hedgeedge::NowMicros();
+                }
+
+                items.clear();
+                items.push_back({ m_rep, 0, hedgeedge::ZMQ_POLLIN, 0 });
+                for (const Master& master : m_masters)
+                {
+                    items.push_back({ master.subscriber->Socket(), 0, hedgeedge::ZMQ_POLLIN, 0 });
+                }
+
+                int ready = zmq->poll(items.data(), static_cast<int>(items.size()), POLL_INTERVAL_MS);
+                if (ready <= 0) continue;
+
+                for (size_t i = 0; i < m_masters.size(); i++)
+                {
+                    if (items[i + 1].revents & hedgeedge::ZMQ_POLLIN) Drain(m_masters[i]);
+                }
+                if (items[0].revents & hedgeedge::ZMQ_POLLIN) ServeQuery();
+            }
+
+            if (m_series) m_series->Flush();
+        }
+
+    private:
+        void AddMaster(const std::string& endpoint, const std::string& serverKey, bool fromRegistry)
+        {
+            Master master;
+            master.endpoint = endpoint;
+            master.serverKey = serverKey;
+            master.fromRegistry = fromRegistry;
+            master.subscriber.reset(new hedgeedge::Subscriber(m_context));
+
+            std::string error;
+            hedgeedge::Subscriber& subscriber = *master.subscriber;
+            if (!subscriber.Connect(endpoint, serverKey, serverKey.empty() ? std::string() : m_options.curvePublic,
+                                    serverKey.empty() ? std::string() : m_options.curveSecret, RECEIVE_HWM, &error))
+            {
+                std::fprintf(stderr, "cannot connect %s: %s\n", endpoint.c_str(), error.c_str());
+                return;
+            }
+            if (!m_options.dictionary.empty()) subscriber.LoadDictionary(m_options.dictionary);
+
+            // A master sends every event on EVENT and, with batching on, on EVENT.B as well
+            std::string events = std::string("EVENT") + (m_options.batched ? hedgeedge::BATCH_TOPIC_SUFFIX : "");
+            subscriber.Subscribe(events, m_options.compressed);
+            subscriber.Subscribe("SNAPSHOT", m_options.compressed);
+
+            std::fprintf(stderr, "master %s%s\n", endpoint.c_str(), fromRegistry ? " (registry)" : "");
+            m_masters.push_back(std::move(master));
+        }
+
+        // Follow the master entries of the registry; accounts of removed
+        // masters stay in the table and turn stale
+        void SyncRegistry()
+        {
+            m_registry.Reap();
+            m_registryGeneration = m_registry.Generation();
+
+            std::vector<hedgeedge::AgentInfo> agents;
+            m_registry.List(agents);
+
+            std::vector<std::string> wanted;
+            for (const hedgeedge::AgentInfo& agent : agents)
+            {
+                if (agent.role != "master" || agent.dataPort <= 0) continue;
+                std::string endpoint = "tcp://127.0.0.1:" + std::to_string(agent.dataPort);
+                wanted.push_back(endpoint);
+
+                bool known = false;
+                for (const Master& master : m_masters) known = known || master.endpoint == endpoint;
+                if (!known) AddMaster(endpoint, agent.publicKey, true);
+            }
+
+            for (size_t i = 0; i < m_masters.size();)
+            {
+                bool keep = !m_masters[i].fromRegistry;
+                for (const std::string& endpoint : wanted) keep = keep || m_masters[i].endpoint == endpoint;
+                if (keep)
+                {
+                    i++;
+                    continue;
+                }
+                std::fprintf(stderr, "master %s left the registry\n", m_masters[i].endpoint.c_str());
+                m_masters.erase(m_masters.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+
+        void Drain(Master& master)
+        {
+            std::string batchTopic = std::string("EVENT") + hedgeedge::BATCH_TOPIC_SUFFIX;
+            uint64_t now = hedgeedge::NowMicros();
+
+            for (int n = 0; n < MAX_DRAIN; n++)
+            {
+                int rc = master.subscriber->Receive(m_topic, m_data, 0);
+                if (rc == -4) continue;   // Subscriber fell back to the plain topic
+                if (rc <= 0) return;
+
+                if (m_topic != batchTopic)
+                {
+                    if (m_table.Apply(m_topic, m_data, now, master.endpoint)) Record(m_data);
+                    continue;
+                }
+
+                hedgeedge::ArenaScope scope(m_arena);
+                if (!hedgeedge::UnpackBatch(m_data.data(), m_data.size(), m_arena, m_events))
+                {
+                    m_badBatches++;
+                    continue;
+                }
+                for (std::string_view event : m_events)
+                {
+                    if (m_table.Apply("EVENT", event, now, master.endpoint)) Record(event);
+                }
+            }
+        }
+
+        // Heartbeats become equity curve samples, stamped with the arrival time
+        void Record(std::string_view event)
+        {
+            if (!m_series || hedgeedge::JsonStringView(event, "type") != "HEARTBEAT") return;
+            const hedgeedge::AccountState* account = m_table.Find(hedgeedge::JsonString(event, "accountId"));
+            if (!account) return;
+
+            hedgeedge::SeriesSample sample;
+            sample.timeMs = static_cast<int64_t>(hedgeedge::WallMicros() / 1000);
+            sample.balance = account->balance;
+            sample.equity = account->equity;
+            sample.margin = account->margin;
+            sample.floatingPnL = account->floatingPnL;
+            if (!m_series->Append(account->accountId, sample)) m_seriesErrors++;
+        }
+
+        void ServeQuery()
+        {
+            const hedgeedge::ZmqApi* zmq = hedgeedge::Zmq();
+            hedgeedge::ZmqFrame frame;
+            if (frame.Receive(m_rep, hedgeedge::ZMQ_DONTWAIT) < 0) return;
+
+            std::string response = Handle(std::string_view(frame.Data(), frame.Size()));
+            zmq->send(m_rep, response.data(), response.size(), 0);
+            m_queries++;
+        }
+
+        std::string Handle(std::string_view request)
+        {
+            uint64_t now = hedgeedge::NowMicros();
+            std::string action = hedgeedge::JsonString(request, "action");
+
+            std::string json = "{\"success\":true,\"action\":";
+            hedgeedge::AppendJsonString(json, action);
+            if (action == "SUMMARY")
+            {
+                json += ",\"summary\":" + m_table.SummaryJson(now, m_options.staleUs);
+            }
+            else if (action == "ACCOUNTS")
+            {
+                json += ",\"accounts\":" + m_table.AccountsJson(now, m_options.staleUs);
+            }
+            else if (action == "ACCOUNT")
+            {
+                std::string account = m_table.AccountJson(hedgeedge::JsonString(request, "accountId"), now,
+                                                          m_options.staleUs);
+                if (account.empty()) return Error(action, "Unknown account");
+                json += ",\"account\":" + account;
+            }
+            else if (action == "EXPOSURE")
+            {
+                json += ",\"exposure\":" + m_table.ExposureJson();
+            }
+            else if (action == "SERIES")
+            {
+                if (!m_series) return Error(action, "Series store not enabled (--series)");
+                int64_t maxPoints = hedgeedge::JsonInt(request, "maxPoints", static_cast<int64_t>(DEFAULT_SERIES_POINTS));
+                json += ",\"series\":" + m_series->QueryJson(hedgeedge::JsonString(request, "accountId"),
+                                                            hedgeedge::JsonInt(request, "from", 0),
+                                                            hedgeedge::JsonInt(request, "to", INT64_MAX),
+                                                            maxPoints > 0 ? static_cast<size_t>(maxPoints) : 0);
+            }
+            else if (action == "STATS")
+            {
+                json += ",\"stats\":" + StatsJson();
+            }
+            else if (action == "PING")
+            {
+                json += ",\"pong\":true,\"role\":\"aggregator\"";
+            }
+            else
+            {
+                return Error(action.empty() ? "UNKNOWN" : action, "Aggregator does not handle: " + action);
+            }
+
+            json += ",\"timestamp\":\"";
+            hedgeedge::AppendIsoTime(json, static_cast<int64_t>(hedgeedge::WallMicros()), 3);
+            json += "\"}";
+            return json;
+        }
+
+        std::string Error(const std::string& action, const std::string& message)
+        {
+            std::string json = "{\"success\":false,\"action\":";
+            hedgeedge::AppendJsonString(json, action);
+            json += ",\"error\":";
+            hedgeedge::AppendJsonString(json, message);
+            json += ",\"timestamp\":\"";
+            hedgeedge::AppendIsoTime(json, static_cast<int64_t>(hedgeedge::WallMicros()), 3);
+            json += "\"}";
+            return json;
+        }
+
+        std::string StatsJson()
+        {
+            std::string json = "{\"accounts\":";
+            hedgeedge::AppendUInt(json, m_table.Size());
+            json += ",\"applied\":";
+            hedgeedge::AppendUInt(json, m_table.Applied());
+            json += ",\"ignored\":";
+            hedgeedge::AppendUInt(json, m_table.Ignored());
+            json += ",\"badBatches\":";
+            hedgeedge::AppendUInt(json, m_badBatches);
+            json += ",\"queries\":";
+            hedgeedge::AppendUInt(json, m_queries);
+            if (m_series)
+            {
+                json += ",\"seriesErrors\":";
+                hedgeedge::AppendUInt(json, m_seriesErrors);
+                json += ",\"series\":" + m_series->StatsJson();
+            }
+            json += ",\"masters\":[";
+            for (size_t i = 0; i < m_masters.size(); i++)
+            {
+                if (i > 0) json += ",";
+                json += "{\"endpoint\":";
+                hedgeedge::AppendJsonString(json, m_masters[i].endpoint);
+                json += ",\"registry\":";
+                json += m_masters[i].fromRegistry ? "true" : "false";
+                json += ",\"transport\":" + m_masters[i].subscriber->StatsJson() + "}";
+            }
+            json += "]}";
+            return json;
+        }
+
+        const Options&              m_options;
+        void*                       m_context = nullptr;
+        void*                       m_rep = nullptr;
+        std::vector<Master>         m_masters;
+        hedgeedge::AgentRegistry    m_registry;
+        uint64_t                    m_registryGeneration = 0;
+        hedgeedge::AccountTable     m_table;
+        hedgeedge::Arena            m_arena;
+        std::vector<std::string_view> m_events;
+        std::string                 m_topic;
+        std::string                 m_data;
+        std::unique_ptr<hedgeedge::SeriesStore> m_series;
+        uint64_t                    m_seriesFlushUs = 0;
+        uint64_t                    m_seriesErrors = 0;
+        uint64_t                    m_badBatches = 0;
+        uint64_t                    m_queries = 0;
+    };
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--bind" && hasValue) options.bind = argv[++i];
+        else if (arg == "--master" && hasValue) options.masters.push_back(argv[++i]);
+        else if (arg == "--masters" && hasValue)
+        {
+            std::string path = argv[++i];
+            if (!ReadMastersFile(path, options.masters))
+            {
+                std::fprintf(stderr, "cannot read %s\n", path.c_str());
+                return 1;
+            }
+        }
+        else if (arg == "--registry") options.registry = true;
+        else if (arg == "--curve-public" && hasValue) options.curvePublic = argv[++i];
+        else if (arg == "--curve-secret" && hasValue) options.curveSecret = argv[++i];
+        else if (arg == "--dict" && hasValue)
+        {
+            std::string path = argv[++i];
+            if (!hedgeedge::ReadFileBytes(path, options.dictionary))
+            {
+                std::fprintf(stderr, "cannot read %s\n", path.c_str());
+                return 1;
+            }
+        }
+        else if (arg == "--compressed") options.compressed = true;
+        else if (arg == "--batched") options.batched = true;
+        else if (arg == "--stale-ms" && hasValue) options.staleUs = std::strtoull(argv[++i], nullptr, 10) * 1000;
+        else if (arg == "--series" && hasValue) options.seriesDirectory = argv[++i];
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+
+    Aggregator aggregator(options);
+    if (!aggregator.Start()) return 1;
+    aggregator.Run();
+    return 0;
+}
@@ -0,0 +1,214 @@
+// ============================================================================
+// Hedge Edge Allocation Check
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Runs the native event path (event encoding, batching, compression,
+// unpacking and the BatchUnpack export) and counts general-heap allocations
+// with a replaced global operator new. After one warm-up pass over the
+// largest messages, every batch must be served by the scratch arenas and
+// reused buffers alone.
+//
+// Usage:
+//   HedgeEdgeAllocCheck [--batches N]
+//
+// Exits with 1 if the steady state allocates or an event does not survive
+// the round trip.
+// ============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "HedgeEdgeArena.h"
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgeCompress.h"
+#include "HedgeEdgeFixed.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgePlatform.h"
+
+// ============================================================================
+// Heap Accounting
+// ============================================================================
+
+namespace {
+    uint64_t g_heapAllocations = 0;
+}
+
+void* operator new(size_t size)
+{
+    g_heapAllocations++;
+    if (void* pointer = std::malloc(size ? size : 1)) return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { std::free(pointer); }
+
+namespace {
+
+    const char ENVELOPE[] = "\"platform\":\"MT5\",\"accountId\":\"51234567\",\"role\":\"master\"";
+    const size_t POOL_SIZE = 64;
+    const size_t MAX_BATCH = 8;
+
+    const char* const SYMBOLS[] = { "EURUSD", "XAUUSD", "US30.cash", "BTCUSD", "GBPJPY", "NAS100" };
+
+    void Usage()
+    {
+        std::fprintf(stderr, "usage: HedgeEdgeAllocCheck [--batches N]\n");
+    }
+
+    // POSITION_OPENED events as HE_Prop publishes them, comments of varying length
+    std::vector<std::string> MakeEvents(uint64_t seed)
+    {
+        std::mt19937_64 random(seed);
+        std::vector<std::string> events;
+        for (size_t i = 0; i < POOL_SIZE; i++)
+        {
+            hedgeedge::PositionMessage message;
+            message.ticket = 900000000 + i;
+            message.symbol = SYMBOLS[i % (sizeof(SYMBOLS) / sizeof(SYMBOLS[0]))];
+            message.digits = static_cast<int32_t>(2 + random() % 4);
+            message.price = static_cast<int64_t>(100000 + random() % 10000000);
+            message.stopLoss = i % 3 ? message.price - 500 : 0;
+            message.takeProfit = i % 4 ? message.price + 900 : 0;
+            message.lotStepUnits = 1000000;
+            message.volumeSteps = static_cast<int64_t>(1 + random() % 500);
+
+            std::string event = "{\"type\":\"POSITION_OPENED\",\"eventIndex\":";
+            hedgeedge::AppendUInt(event, i + 1);
+            event += ",\"timestamp\":\"";
+            hedgeedge::AppendServerTime(event, 1767225600 + static_cast<int64_t>(i));
+            event += "\",";
+            event += ENVELOPE;
+            event += ",\"data\":{\"position\":";
+            hedgeedge::AppendUInt(event, message.ticket);
+            event += ",\"symbol\":\"" + message.symbol + "\",";
+            hedgeedge::AppendPositionFields(event, message);
+            event += ",\"comment\":\"" + std::string(random() % 48, 'c') + "\"}}";
+            events.push_back(event);
+        }
+        return events;
+    }
+
+    struct Pipeline
+    {
+        hedgeedge::EventBatch              batch;
+        hedgeedge::Arena                   publisherArena;
+        hedgeedge::Arena                   subscriberArena;
+        hedgeedge::Compressor              compressor;
+        hedgeedge::Compressor              decompressor;
+        bool                               compress = false;
+        std::string                        wire;
+        std::string                        raw;
+        std::vector<std::string_view>      unpacked;
+        std::vector<char>                  exported;
+        size_t                             failures = 0;
+
+        // One batch publisher -> wire -> subscriber; `picks` index the pool
+        void Run(const std::vector<std::string>& pool, const size_t* picks, size_t count)
+        {
+            hedgeedge::ArenaScope publisherScope(publisherArena);
+            for (size_t i = 0; i < count; i++) batch.Add(pool[picks[i]].data(), pool[picks[i]].size());
+            std::string_view frame = batch.Take(publisherArena);
+
+            const char* received = frame.data();
+            size_t receivedSize = frame.size();
+            if (compress)
+            {
+                wire.clear();
+                if (!compressor.Compress(frame.data(), frame.size(), wire) ||
+                    !decompressor.Decompress(wire.data(), wire.size(), raw))
+                {
+                    failures++;
+                    return;
+                }
+                received = raw.data();
+                receivedSize = raw.size();
+            }
+
+            hedgeedge::ArenaScope subscriberScope(subscriberArena);
+            if (!hedgeedge::UnpackBatch(received, receivedSize, subscriberArena, unpacked) ||
+                unpacked.size() != count)
+            {
+                failures++;
+                return;
+            }
+            for (size_t i = 0; i < count; i++)
+            {
+                if (unpacked[i] != pool[picks[i]]) failures++;
+            }
+
+            int events = BatchUnpack(received, static_cast<int>(receivedSize), exported.data(),
+                                     static_cast<int>(exported.size()));
+            if (events != static_cast<int>(count)) failures++;
+        }
+    };
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    size_t batches = 200000;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--batches" && i + 1 < argc) batches = std::strtoull(argv[++i], nullptr, 10);
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+
+    std::vector<std::string> pool = MakeEvents(42);
+    Pipeline pipeline;
+    pipeline.batch.SetEnvelope(ENVELOPE);
+    pipeline.exported.resize(64 * 1024);
+    pipeline.compress = hedgeedge::CodecAvailable(hedgeedge::Codec::Zstd) &&
+                        pipeline.compressor.Configure(hedgeedge::Codec::Zstd, std::string(), 3) &&
+                        pipeline.decompressor.Configure(hedgeedge::Codec::Zstd, std::string(), 3);
+
+    // Warm-up: the largest batch possible sizes every reused buffer and arena
+    std::vector<size_t> order(POOL_SIZE);
+    for (size_t i = 0; i < POOL_SIZE; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return pool[a].size() > pool[b].size(); });
+    for (int pass = 0; pass < 2; pass++) pipeline.Run(pool, order.data(), MAX_BATCH);
+    for (size_t i = 0; i < POOL_SIZE; i++) pipeline.Run(pool, &i, 1);
+
+    std::mt19937_64 random(43);
+    std::vector<size_t> picks(MAX_BATCH);
+    uint64_t heapBefore = g_heapAllocations;
+    uint64_t start = hedgeedge::NowMicros();
+    for (size_t b = 0; b < batches; b++)
+    {
+        size_t count = 1 + static_cast<size_t>(random() % MAX_BATCH);
+        for (size_t i = 0; i < count; i++) picks[i] = static_cast<size_t>(random() % POOL_SIZE);
+        pipeline.Run(pool, picks.data(), count);
+    }
+    uint64_t elapsed = hedgeedge::NowMicros() - start;
+    uint64_t heapAllocations = g_heapAllocations - heapBefore;
+
+    std::printf("batches:           %zu (%s)\n", batches, pipeline.compress ? "zstd" : "uncompressed");
+    std::printf("per batch:         %.2f us\n", batches ? static_cast<double>(elapsed) / batches : 0.0);
+    std::printf("heap allocations:  %llu\n", static_cast<unsigned long long>(heapAllocations));
+    std::printf("round-trip errors: %zu\n", pipeline.failures);
+    std::printf("publisher arena:   %s\n", pipeline.publisherArena.StatsJson().c_str());
+    std::printf("subscriber arena:  %s\n", pipeline.subscriberArena.StatsJson().c_str());
+    std::printf("thread arena:      %s\n", hedgeedge::ThreadArena().StatsJson().c_str());
+
+    return heapAllocations == 0 && pipeline.failures == 0 ? 0 : 1;
+}
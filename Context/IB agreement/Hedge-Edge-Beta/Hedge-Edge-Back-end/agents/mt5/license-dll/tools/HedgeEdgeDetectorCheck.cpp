@@ -0,0 +1,129 @@
+// ============================================================================
+// Hedge Edge Failure Detector Check
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Drives the phi-accrual detector on a simulated clock with the hedge's
+// settings (100 samples, 5 s bootstrap, phi 3 / 8) and checks three cases:
+//
+//   pause     master ticks stop; only the 5 s HEARTBEAT feeds the detector,
+//             as in HE_Hedge, so the gap between heartbeats is no outage
+//   rhythm    a detector trained on 500 ms arrivals sees 5 s arrivals; the
+//             first gaps may fail, then the slower rhythm must be learned
+//   outage    the master stops entirely and must still be declared failed
+//
+// Usage:
+//   HedgeEdgeDetectorCheck
+//
+// Exits with 1 if any case fails.
+// ============================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "HedgeEdgeFailureDetector.h"
+
+namespace {
+
+    const uint64_t MS = 1000;
+    const uint64_t HEARTBEAT_US = 5000 * MS;
+    const uint64_t SAMPLE_US = 100 * MS;         // How often CheckConnectionHealth looks
+
+    hedgeedge::DetectorConfig HedgeConfig()
+    {
+        hedgeedge::DetectorConfig config;
+        config.windowSize = 100;
+        config.minStdDevMs = 100.0;
+        config.acceptablePauseMs = 1000.0;
+        config.firstIntervalMs = 5000.0;
+        config.suspectPhi = 3.0;
+        config.failedPhi = 8.0;
+        return config;
+    }
+
+    // Feeds `count` arrivals spaced `intervalUs` (+/- jitter) and returns how
+    // many arrival gaps contained a Failed verdict
+    size_t Feed(hedgeedge::PhiAccrualDetector& detector, uint64_t& nowUs, size_t count,
+                uint64_t intervalUs, uint64_t jitterUs, std::mt19937_64& random)
+    {
+        size_t failedGaps = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t next = nowUs + intervalUs - jitterUs + (jitterUs ? random() % (2 * jitterUs) : 0);
+            bool failed = false;
+            for (uint64_t t = nowUs + SAMPLE_US; t < next; t += SAMPLE_US)
+            {
+                if (detector.State(t) == hedgeedge::DetectorState::Failed) failed = true;
+            }
+            if (failed) failedGaps++;
+            nowUs = next;
+            detector.Heartbeat(nowUs);
+        }
+        return failedGaps;
+    }
+
+    bool CheckPause()
+    {
+        std::mt19937_64 random(1);
+        hedgeedge::PhiAccrualDetector detector(HedgeConfig());
+        uint64_t nowUs = 1000 * MS;
+        detector.Heartbeat(nowUs);
+
+        // Snapshots every 500 ms while ticks flow are not fed, so 10 minutes
+        // without ticks look exactly like the busy period before them
+        size_t failedGaps = Feed(detector, nowUs, 120, HEARTBEAT_US, 50 * MS, random);
+
+        std::printf("pause:  %zu failed gaps over 120 heartbeats (mean %.0f ms)\n", failedGaps, detector.MeanMs());
+        return failedGaps == 0;
+    }
+
+    bool CheckRhythm()
+    {
+        std::mt19937_64 random(2);
+        hedgeedge::PhiAccrualDetector detector(HedgeConfig());
+        uint64_t nowUs = 1000 * MS;
+        detector.Heartbeat(nowUs);
+
+        Feed(detector, nowUs, 200, 500 * MS, 20 * MS, random);
+        size_t early = Feed(detector, nowUs, 10, HEARTBEAT_US, 50 * MS, random);
+        size_t late = Feed(detector, nowUs, 100, HEARTBEAT_US, 50 * MS, random);
+
+        std::printf("rhythm: %zu failed gaps while adapting, %zu after (mean %.0f ms)\n",
+                    early, late, detector.MeanMs());
+        return late == 0;
+    }
+
+    bool CheckOutage()
+    {
+        std::mt19937_64 random(3);
+        hedgeedge::PhiAccrualDetector detector(HedgeConfig());
+        uint64_t nowUs = 1000 * MS;
+        detector.Heartbeat(nowUs);
+
+        Feed(detector, nowUs, 50, HEARTBEAT_US, 50 * MS, random);
+        uint64_t lastUs = nowUs;
+        uint64_t failedAfterUs = 0;
+        for (uint64_t t = lastUs + SAMPLE_US; t < lastUs + 60000 * MS; t += SAMPLE_US)
+        {
+            if (detector.State(t) == hedgeedge::DetectorState::Failed)
+            {
+                failedAfterUs = t - lastUs;
+                break;
+            }
+        }
+
+        std::printf("outage: failed after %llu ms\n", static_cast<unsigned long long>(failedAfterUs / MS));
+        return failedAfterUs != 0;
+    }
+
+} // namespace
+
+int main()
+{
+    bool ok = CheckPause();
+    ok = CheckRhythm() && ok;
+    ok = CheckOutage() && ok;
+    std::printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+// ============================================================================
+// Hedge Edge Compression Dictionary Trainer
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Builds the zstd/LZ4 dictionary shared by HE_Prop and remote HE_Hedge EAs.
+// Samples are Hedge Edge messages, one per line ("TOPIC|{json}" or bare
+// JSON), read from files and/or captured live from a master data port.
+//
+// Usage:
+//   HedgeEdgeDictTrain --out hedgeedge.dict [--size 16384]
+//                      [--capture tcp://host:51810 --count 2000 [--save samples.txt]]
+//                      [samples.txt ...]
+//
+// Copy the dictionary to <Common Files>/HedgeEdge/hedgeedge.dict on the
+// master and on every remote hedge terminal.
+// ============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeCompress.h"
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeTransport.h"
+
+namespace {
+
+    const size_t DEFAULT_DICT_SIZE = 16 * 1024;
+    const int    CAPTURE_TIMEOUT_MS = 30000;
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgeDictTrain --out FILE [--size BYTES]\n"
+            "                          [--capture ENDPOINT --count N [--save FILE]]\n"
+            "                          [SAMPLES ...]\n");
+    }
+
+    // "TOPIC|{json}" -> "{json}"; the topic prefix never reaches the codec
+    std::string StripTopic(const std::string& line)
+    {
+        size_t bar = line.find('|');
+        if (bar != std::string::npos && bar < 32 && line.find('{') > bar) return line.substr(bar + 1);
+        return line;
+    }
+
+    bool ReadSamples(const std::string& path, std::vector<std::string>& samples)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return false;
+
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (!line.empty()) samples.push_back(StripTopic(line));
+        }
+        return true;
+    }
+
+    bool Capture(const std::string& endpoint, int count, std::vector<std::string>& samples,
+                 std::vector<std::string>& lines)
+    {
+        hedgeedge::Subscriber subscriber;
+        std::string error;
+        if (!subscriber.Connect(endpoint, "", "", "", 10000, &error))
+        {
+            std::fprintf(stderr, "capture: %s\n", error.c_str());
+            return false;
+        }
+        subscriber.Subscribe("EVENT", false);
+        subscriber.Subscribe("SNAPSHOT", false);
+
+        std::string topic, data;
+        uint64_t deadline = hedgeedge::NowMicros() + static_cast<uint64_t>(CAPTURE_TIMEOUT_MS) * 1000;
+        int captured = 0;
+        while (captured < count && hedgeedge::NowMicros() < deadline)
+        {
+            if (subscriber.Receive(topic, data, 100) <= 0) continue;
+            samples.push_back(data);
+            lines.push_back(topic + "|" + data);
+            captured++;
+            deadline = hedgeedge::NowMicros() + static_cast<uint64_t>(CAPTURE_TIMEOUT_MS) * 1000;
+        }
+        std::printf("captured %d messages from %s\n", captured, endpoint.c_str());
+        return captured > 0;
+    }
+
+    // Wire size of all samples with one codec / dictionary
+    size_t Measure(hedgeedge::Codec codec, const std::string& dictionary,
+                   const std::vector<std::string>& samples)
+    {
+        hedgeedge::Compressor compressor;
+        if (!compressor.Configure(codec, dictionary, codec == hedgeedge::Codec::Lz4 ? 1 : 3)) return 0;
+
+        size_t total = 0;
+        std::string frame;
+        for (const std::string& sample : samples)
+        {
+            frame.clear();
+            if (!compressor.Compress(sample.data(), sample.size(), frame)) return 0;
+            total += frame.size();
+        }
+        return total;
+    }
+
+    void Report(const char* label, size_t raw, size_t wire)
+    {
+        if (wire == 0)
+        {
+            std::printf("  %-16s unavailable\n", label);
+            return;
+        }
+        std::printf("  %-16s %10zu bytes  ratio %.2fx\n", label, wire,
+                    static_cast<double>(raw) / static_cast<double>(wire));
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string outPath, capture, savePath;
+    size_t dictSize = DEFAULT_DICT_SIZE;
+    int count = 2000;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--out" && hasValue)          outPath = argv[++i];
+        else if (arg == "--size" && hasValue)    dictSize = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--capture" && hasValue) capture = argv[++i];
+        else if (arg == "--count" && hasValue)   count = std::atoi(argv[++i]);
+        else if (arg == "--save" && hasValue)    savePath = argv[++i];
+        else if (arg.compare(0, 2, "--") == 0)
+        {
+            Usage();
+            return 2;
+        }
+        else inputs.push_back(arg);
+    }
+    if (outPath.empty() || (inputs.empty() && capture.empty()) || dictSize < 1024)
+    {
+        Usage();
+        return 2;
+    }
+
+    std::vector<std::string> samples;
+    for (const std::string& path : inputs)
+    {
+        if (!ReadSamples(path, samples))
+        {
+            std::fprintf(stderr, "cannot read %s\n", path.c_str());
+            return 1;
+        }
+    }
+
+    if (!capture.empty())
+    {
+        std::vector<std::string> lines;
+        if (!Capture(capture, count, samples, lines)) return 1;
+        if (!savePath.empty())
+        {
+            std::string text;
+            for (const std::string& line : lines) text += line + "\n";
+            if (!hedgeedge::WriteFileBytes(savePath, text))
+            {
+                std::fprintf(stderr, "cannot write %s\n", savePath.c_str());
+                return 1;
+            }
+        }
+    }
+
+    std::string dictionary, error;
+    if (!hedgeedge::TrainDictionary(samples, dictSize, dictionary, &error))
+    {
+        std::fprintf(stderr, "training failed on %zu samples: %s\n", samples.size(), error.c_str());
+        return 1;
+    }
+    if (!hedgeedge::WriteFileBytes(outPath, dictionary))
+    {
+        std::fprintf(stderr, "cannot write %s\n", outPath.c_str());
+        return 1;
+    }
+
+    size_t raw = 0;
+    for (const std::string& sample : samples) raw += sample.size();
+
+    std::printf("dictionary %s: %zu bytes, dictId %u, %zu samples (%zu bytes)\n",
+                outPath.c_str(), dictionary.size(), hedgeedge::DictionaryId(dictionary),
+                samples.size(), raw);
+    Report("zstd", raw, Measure(hedgeedge::Codec::Zstd, "", samples));
+    Report("zstd + dict", raw, Measure(hedgeedge::Codec::Zstd, dictionary, samples));
+    Report("lz4", raw, Measure(hedgeedge::Codec::Lz4, "", samples));
+    Report("lz4 + dict", raw, Measure(hedgeedge::Codec::Lz4, dictionary, samples));
+    return 0;
+}
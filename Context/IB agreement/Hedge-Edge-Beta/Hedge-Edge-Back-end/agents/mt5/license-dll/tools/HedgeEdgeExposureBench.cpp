@@ -0,0 +1,256 @@
+// ============================================================================
+// Hedge Edge Exposure Benchmark
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Fills an ExposureBook with random master and hedge positions, checks its
+// per-symbol results against a plain array-of-structs loop (what the EA did
+// in MQL), then times a full recompute per simulated tick.
+//
+// Usage:
+//   HedgeEdgeExposureBench [--positions N] [--symbols N] [--ticks N]
+//
+// Exits with 1 if the book and the reference loop disagree.
+// ============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeExposure.h"
+#include "HedgeEdgePlatform.h"
+
+namespace {
+
+    struct Position
+    {
+        int      book;
+        uint64_t ticket;
+        int      symbol;
+        int      side;
+        double   lots;
+        double   open;
+    };
+
+    struct Quote
+    {
+        double bid;
+        double ask;
+        double valuePerPrice;
+    };
+
+    struct Totals
+    {
+        double netLots = 0.0;
+        double pnl = 0.0;
+    };
+
+    void Usage()
+    {
+        std::fprintf(stderr, "usage: HedgeEdgeExposureBench [--positions N] [--symbols N] [--ticks N]\n");
+    }
+
+    // Reference: one pass over structs, per-position price lookup
+    void Reference(const std::vector<Position>& positions, const std::vector<Quote>& quotes,
+                   std::vector<Totals>& out)
+    {
+        for (Totals& totals : out) totals = Totals();
+        for (const Position& position : positions)
+        {
+            const Quote& quote = quotes[position.symbol];
+            double mark = position.side > 0 ? quote.bid : quote.ask;
+            double lots = position.side > 0 ? position.lots : -position.lots;
+            Totals& totals = out[position.symbol * hedgeedge::EXPOSURE_BOOKS + position.book];
+            totals.netLots += lots;
+            totals.pnl += (mark - position.open) * lots * quote.valuePerPrice;
+        }
+    }
+
+    // Random walk of every quote by up to `spread` ticks
+    void Move(std::vector<Quote>& quotes, std::mt19937_64& random)
+    {
+        std::uniform_real_distribution<double> step(-1.0, 1.0);
+        for (Quote& quote : quotes)
+        {
+            double spread = quote.ask - quote.bid;
+            quote.bid += step(random) * spread;
+            quote.ask = quote.bid + spread;
+        }
+    }
+
+    // Best of five rounds: a shared or throttled core only ever adds time
+    template <typename F>
+    double NanosPerCall(size_t calls, F&& body)
+    {
+        double best = 0.0;
+        for (int round = 0; round < 5; round++)
+        {
+            uint64_t start = hedgeedge::NowNanos();
+            body();
+            double nanos = static_cast<double>(hedgeedge::NowNanos() - start) / static_cast<double>(calls);
+            if (round == 0 || nanos < best) best = nanos;
+        }
+        return best;
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    size_t positionCount = 500;
+    int    symbolCount = 8;
+    size_t ticks = 50000;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--positions" && i + 1 < argc)    positionCount = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--symbols" && i + 1 < argc) symbolCount = std::atoi(argv[++i]);
+        else if (arg == "--ticks" && i + 1 < argc)   ticks = std::strtoull(argv[++i], nullptr, 10);
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+    if (symbolCount <= 0 || ticks == 0)
+    {
+        Usage();
+        return 2;
+    }
+
+    std::mt19937_64 random(42);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    // FX-like, index-like and metal-like symbols
+    hedgeedge::ExposureBook book;
+    std::vector<Quote> quotes(symbolCount);
+    for (int s = 0; s < symbolCount; s++)
+    {
+        Quote& quote = quotes[s];
+        switch (s % 3)
+        {
+            case 0:  quote.bid = 0.8 + unit(random);      quote.ask = quote.bid + 0.00012; quote.valuePerPrice = 100000.0; break;
+            case 1:  quote.bid = 15000 + unit(random) * 25000; quote.ask = quote.bid + 1.5; quote.valuePerPrice = 1.0; break;
+            default: quote.bid = 1800 + unit(random) * 800; quote.ask = quote.bid + 0.25;  quote.valuePerPrice = 100.0; break;
+        }
+        book.AddSymbol("SYM" + std::to_string(s), 5, quote.valuePerPrice);
+    }
+
+    std::vector<Position> positions(positionCount);
+    for (size_t i = 0; i < positionCount; i++)
+    {
+        Position& position = positions[i];
+        position.book = static_cast<int>(i % hedgeedge::EXPOSURE_BOOKS);
+        position.ticket = 100000 + i;
+        position.symbol = static_cast<int>(random() % symbolCount);
+        position.side = (random() & 1) ? 1 : -1;
+        position.lots = static_cast<double>(1 + random() % 500) / 100.0;
+        const Quote& quote = quotes[position.symbol];
+        position.open = quote.bid + (unit(random) - 0.5) * 200.0 * (quote.ask - quote.bid);
+        book.Upsert(position.book, position.ticket, position.symbol, position.side, position.lots, position.open);
+    }
+
+    std::vector<double> bids(symbolCount), asks(symbolCount);
+    auto pushPrices = [&] {
+        for (int s = 0; s < symbolCount; s++)
+        {
+            bids[s] = quotes[s].bid;
+            asks[s] = quotes[s].ask;
+        }
+        book.SetPrices(bids.data(), asks.data(), bids.size());
+    };
+
+    // Check over a few hundred moves
+    std::vector<Totals> expected(static_cast<size_t>(symbolCount) * hedgeedge::EXPOSURE_BOOKS);
+    size_t mismatches = 0;
+    for (int round = 0; round < 200; round++)
+    {
+        Move(quotes, random);
+        pushPrices();
+        book.Compute();
+        Reference(positions, quotes, expected);
+
+        for (int s = 0; s < symbolCount; s++)
+        {
+            for (int b = 0; b < hedgeedge::EXPOSURE_BOOKS; b++)
+            {
+                const Totals& want = expected[s * hedgeedge::EXPOSURE_BOOKS + b];
+                const hedgeedge::BookExposure& got = book.Symbol(s).books[b];
+                double pnlTolerance = 1e-9 * (1.0 + std::fabs(want.pnl));
+                if (std::fabs(got.netLots - want.netLots) <= 1e-9 && std::fabs(got.pnl - want.pnl) <= pnlTolerance)
+                    continue;
+                if (++mismatches <= 10)
+                {
+                    std::printf("  MISMATCH symbol %d book %d: lots %.8f vs %.8f, pnl %.6f vs %.6f\n",
+                                s, b, got.netLots, want.netLots, got.pnl, want.pnl);
+                }
+            }
+        }
+    }
+    std::printf("checked %zu positions x %d symbols over 200 moves: %zu mismatches\n",
+                positionCount, symbolCount, mismatches);
+
+    // Per-tick cost: new prices and a full recompute
+    double sink = 0.0;
+    double soa = NanosPerCall(ticks, [&] {
+        for (size_t t = 0; t < ticks; t++)
+        {
+            Quote& quote = quotes[t % symbolCount];
+            double spread = quote.ask - quote.bid;
+            quote.bid += (t & 1) ? spread : -spread;
+            quote.ask = quote.bid + spread;
+            bids[t % symbolCount] = quote.bid;
+            asks[t % symbolCount] = quote.ask;
+            book.SetPrices(bids.data(), asks.data(), bids.size());
+            book.Compute();
+            sink += book.Symbol(0).books[0].pnl;
+        }
+    });
+    double aos = NanosPerCall(ticks, [&] {
+        for (size_t t = 0; t < ticks; t++)
+        {
+            Quote& quote = quotes[t % symbolCount];
+            double spread = quote.ask - quote.bid;
+            quote.bid += (t & 1) ? spread : -spread;
+            quote.ask = quote.bid + spread;
+            Reference(positions, quotes, expected);
+            sink += expected[0].pnl;
+        }
+    });
+
+    // Kernel alone over every position as one run
+    std::vector<double> lots(positionCount), open(positionCount), pnl(positionCount);
+    for (size_t i = 0; i < positionCount; i++)
+    {
+        lots[i] = positions[i].side * positions[i].lots;
+        open[i] = positions[i].open;
+    }
+    double simd = NanosPerCall(ticks, [&] {
+        for (size_t t = 0; t < ticks; t++)
+        {
+            double bid = 1.1 + static_cast<double>(t & 7) * 1e-5;
+            sink += hedgeedge::ExposureKernel(lots.data(), open.data(), pnl.data(), positionCount,
+                                              bid, bid + 0.0001, 100000.0);
+        }
+    });
+    double scalar = NanosPerCall(ticks, [&] {
+        for (size_t t = 0; t < ticks; t++)
+        {
+            double bid = 1.1 + static_cast<double>(t & 7) * 1e-5;
+            sink += hedgeedge::ExposureKernelScalar(lots.data(), open.data(), pnl.data(), positionCount,
+                                                    bid, bid + 0.0001, 100000.0);
+        }
+    });
+
+    std::printf("recompute per tick (%zu positions): %.1f ns  vs struct loop %.1f ns  (%.1fx)\n",
+                positionCount, soa, aos, aos / soa);
+    std::printf("kernel (%s):                      %.1f ns  vs scalar %.1f ns  (%.1fx)\n",
+                hedgeedge::ExposureKernelName(), simd, scalar, scalar / simd);
+    std::printf("stats: %s\n", book.StatsJson().c_str());
+    std::printf("(checksum %.3f)\n", sink);
+
+    return mismatches == 0 ? 0 : 1;
+}
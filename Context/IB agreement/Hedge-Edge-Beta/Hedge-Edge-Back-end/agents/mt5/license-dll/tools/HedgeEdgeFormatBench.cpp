@@ -0,0 +1,199 @@
+// ============================================================================
+// Hedge Edge Formatting Benchmark
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Checks HedgeEdgeFormat against snprintf on random prices, money amounts,
+// exact ties and arbitrary bit patterns, then times both.
+//
+// Usage:
+//   HedgeEdgeFormatBench [--check N] [--bench N]
+//
+// Exits with 1 if any output differs from snprintf.
+// ============================================================================
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgePlatform.h"
+
+namespace {
+
+    struct Sample
+    {
+        double value;
+        int    digits;
+    };
+
+    void Usage()
+    {
+        std::fprintf(stderr, "usage: HedgeEdgeFormatBench [--check N] [--bench N]\n");
+    }
+
+    // What the EAs actually format: prices, lots, money, plus edge cases
+    std::vector<Sample> MakeSamples(size_t count, uint64_t seed)
+    {
+        std::mt19937_64 random(seed);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        std::vector<Sample> samples;
+        samples.reserve(count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Sample sample;
+            switch (i % 5)
+            {
+                case 0:     // Price with symbol digits (0.5 .. 200000)
+                    sample.digits = static_cast<int>(random() % 6);
+                    sample.value = 0.5 + unit(random) * 200000.0;
+                    break;
+                case 1:     // Money, signed
+                    sample.digits = 2;
+                    sample.value = (unit(random) - 0.5) * 2e7;
+                    break;
+                case 2:     // Lots
+                    sample.digits = 2;
+                    sample.value = static_cast<double>(random() % 10000) / 100.0;
+                    break;
+                case 3:     // Exact binary ties (k / 2^m)
+                    sample.digits = static_cast<int>(random() % 8);
+                    sample.value = std::ldexp(static_cast<double>(random() % 1000000),
+                                              -static_cast<int>(random() % 12));
+                    break;
+                default:    // Arbitrary finite bit patterns and digit counts
+                {
+                    uint64_t bits = random();
+                    std::memcpy(&sample.value, &bits, sizeof(bits));
+                    if (!std::isfinite(sample.value)) sample.value = 0.0;
+                    sample.digits = static_cast<int>(random() % (hedgeedge::FORMAT_MAX_DIGITS + 1));
+                    break;
+                }
+            }
+            samples.push_back(sample);
+        }
+        return samples;
+    }
+
+    size_t Check(const std::vector<Sample>& samples)
+    {
+        size_t mismatches = 0;
+        std::vector<char> expected(512), actual(512);
+        for (const Sample& sample : samples)
+        {
+            std::snprintf(expected.data(), expected.size(), "%.*f", sample.digits, sample.value);
+            std::string text = hedgeedge::FixedString(sample.value, sample.digits);
+            if (text == expected.data()) continue;
+
+            if (++mismatches <= 10)
+            {
+                std::printf("  MISMATCH %.17g digits %d: %s vs %s\n",
+                            sample.value, sample.digits, text.c_str(), expected.data());
+            }
+        }
+
+        // Integers and timestamps
+        std::mt19937_64 random(7);
+        for (int i = 0; i < 100000; i++)
+        {
+            int64_t value = static_cast<int64_t>(random());
+            char mine[hedgeedge::FORMAT_INT_CHARS], theirs[32];
+            size_t length = hedgeedge::FormatInt(mine, value);
+            std::snprintf(theirs, sizeof(theirs), "%" PRId64, value);
+            if (std::string(mine, length) != theirs) mismatches++;
+
+            time_t seconds = static_cast<time_t>(random() % 4102444800ull);   // 1970 .. 2100
+            std::tm utc = {};
+#ifdef _WIN32
+            gmtime_s(&utc, &seconds);
+#else
+            gmtime_r(&seconds, &utc);
+#endif
+            std::strftime(theirs, sizeof(theirs), "%Y.%m.%d %H:%M:%S", &utc);
+            if (hedgeedge::ServerTimeString(static_cast<int64_t>(seconds)) != theirs) mismatches++;
+        }
+        return mismatches;
+    }
+
+    template <typename F>
+    double NanosPerCall(size_t calls, F&& body)
+    {
+        uint64_t start = hedgeedge::NowMicros();
+        body();
+        return static_cast<double>(hedgeedge::NowMicros() - start) * 1000.0 / static_cast<double>(calls);
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    size_t checkCount = 2000000;
+    size_t benchCount = 2000000;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--check" && i + 1 < argc)      checkCount = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--bench" && i + 1 < argc) benchCount = std::strtoull(argv[++i], nullptr, 10);
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+
+    std::printf("checking %zu doubles against snprintf...\n", checkCount);
+    size_t mismatches = Check(MakeSamples(checkCount, 42));
+    std::printf("  %zu mismatches\n", mismatches);
+
+    // Benchmark on the EA mix only (prices, money, lots)
+    std::vector<Sample> samples = MakeSamples(benchCount, 43);
+    std::vector<Sample> typical;
+    for (const Sample& sample : samples)
+    {
+        if (std::fabs(sample.value) < 1e9) typical.push_back(sample);
+    }
+
+    char buffer[512];
+    size_t sink = 0;
+    double fast = NanosPerCall(typical.size(), [&] {
+        for (const Sample& sample : typical)
+            sink += hedgeedge::FormatFixed(buffer, sizeof(buffer), sample.value, sample.digits);
+    });
+    double libc = NanosPerCall(typical.size(), [&] {
+        for (const Sample& sample : typical)
+            sink += static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%.*f", sample.digits, sample.value));
+    });
+
+    double fastTime = NanosPerCall(typical.size(), [&] {
+        for (size_t i = 0; i < typical.size(); i++)
+            sink += hedgeedge::FormatServerTime(buffer, 1700000000 + static_cast<int64_t>(i));
+    });
+    double libcTime = NanosPerCall(typical.size(), [&] {
+        for (size_t i = 0; i < typical.size(); i++)
+        {
+            time_t seconds = static_cast<time_t>(1700000000 + i);
+            std::tm utc = {};
+#ifdef _WIN32
+            gmtime_s(&utc, &seconds);
+#else
+            gmtime_r(&seconds, &utc);
+#endif
+            sink += std::strftime(buffer, sizeof(buffer), "%Y.%m.%d %H:%M:%S", &utc);
+        }
+    });
+
+    std::printf("fixed-point (%zu values): %.1f ns  vs snprintf %.1f ns  (%.1fx)\n",
+                typical.size(), fast, libc, libc / fast);
+    std::printf("server time:              %.1f ns  vs gmtime+strftime %.1f ns  (%.1fx)\n",
+                fastTime, libcTime, libcTime / fastTime);
+    std::printf("(checksum %zu)\n", sink);
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,758 @@
+// ============================================================================
+// Hedge Edge Synthetic Master
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Publishes what HE_Prop publishes, without a terminal: CONNECTED, POSITION_*
+// (from a simulated book), the deferred ACCOUNT_UPDATE, HEARTBEAT and the
+// periodic SNAPSHOT, in HE_Prop's formats, topics and ports. Consumers can
+// be loaded well past what a live account produces.
+//
+// Every message carries "genUs" (wall clock, microseconds, in the event's
+// data object and at the top of a SNAPSHOT), so HedgeEdgeSubBench can
+// measure end-to-end latency on the same host.
+//
+// Usage:
+//   HedgeEdgeLoadGen [--port 51810] [--account ID] [--positions N]
+//                    [--rate EV/S] [--shape steady|poisson|burst] [--burst N]
+//                    [--ramp STEP:SECS] [--symbols EURUSD:5,XAUUSD:2,...]
+//                    [--modify-pct N] [--snapshot-ms N] [--heartbeat-ms N]
+//                    [--update-ms N] [--batch-ms N] [--compress zstd|lz4]
+//                    [--dict FILE] [--lane PORT] [--curve-secret KEY]
+//                    [--hwm N] [--seed N] [--seconds N]
+//
+//   --positions N    book size the generator holds (opens and closes keep
+//                    it around N; the book starts full)
+//   --rate EV/S      POSITION_* events per second (default 50)
+//   --shape          steady: evenly spaced; poisson: random arrivals;
+//                    burst: --burst events back to back ("close all"),
+//                    groups spaced to keep the average rate
+//   --ramp STEP:SECS raise the rate by STEP every SECS seconds
+//   --symbols        symbol mix with weights (default EURUSD:4,GBPUSD:2,
+//                    USDJPY:2,XAUUSD:2,US30:1,BTCUSD:1)
+//   --modify-pct N   share of events that are POSITION_MODIFIED (default 20)
+//   --update-ms N    deferred ACCOUNT_UPDATE at most every N ms (default 100,
+//                    the EA's timer; 0 = none)
+//   --batch-ms N     EVENT.B batching window (0 = off, default)
+//
+// Prints the target and sent rates every second, and how far the generator
+// itself fell behind its schedule (a result is only meaningful while that
+// stays small).
+// ============================================================================
+
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "HedgeEdgeCompress.h"
+#include "HedgeEdgeFixed.h"
+#include "HedgeEdgeFormat.h"
+#include "HedgeEdgeHistogram.h"
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeTransport.h"
+#include "HedgeEdgeZmq.h"
+
+namespace {
+
+    const uint64_t SPIN_US = 200;               // Sleep until this close to the next send, then spin
+    const int64_t  LOT_STEP_UNITS = hedgeedge::LOT_UNITS_PER_LOT / 100;
+    const int      BATCH_MAX_EVENTS = 64;       // InpBatchMaxEvents
+    const size_t   BATCH_MAX_BYTES = 65536;
+
+    volatile std::sig_atomic_t g_stop = 0;
+
+    void OnSignal(int)
+    {
+        g_stop = 1;
+    }
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgeLoadGen [--port 51810] [--account ID] [--positions N]\n"
+            "                        [--rate EV/S] [--shape steady|poisson|burst] [--burst N]\n"
+            "                        [--ramp STEP:SECS] [--symbols EURUSD:5,XAUUSD:2,...]\n"
+            "                        [--modify-pct N] [--snapshot-ms N] [--heartbeat-ms N]\n"
+            "                        [--update-ms N] [--batch-ms N] [--compress zstd|lz4]\n"
+            "                        [--dict FILE] [--lane PORT] [--curve-secret KEY]\n"
+            "                        [--hwm N] [--seed N] [--seconds N]\n");
+    }
+
+    struct Instrument
+    {
+        std::string name;
+        int         digits = 5;
+        double      price = 1.0;
+        double      contractSize = 100000.0;
+        double      weight = 1.0;
+    };
+
+    // Starting quotes of the symbols a prop account typically trades
+    Instrument KnownInstrument(const std::string& name, double weight)
+    {
+        struct Known { const char* name; int digits; double price; double contractSize; };
+        static const Known KNOWN[] = {
+            { "EURUSD", 5, 1.08500,  100000.0 },
+            { "GBPUSD", 5, 1.27000,  100000.0 },
+            { "USDJPY", 3, 151.500,  100000.0 },
+            { "XAUUSD", 2, 2350.00,  100.0 },
+            { "US30",   1, 39000.0,  1.0 },
+            { "NAS100", 1, 18000.0,  1.0 },
+            { "BTCUSD", 2, 65000.00, 1.0 },
+        };
+
+        Instrument instrument;
+        instrument.name = name;
+        instrument.weight = weight;
+        for (const Known& known : KNOWN)
+        {
+            if (name != known.name) continue;
+            instrument.digits = known.digits;
+            instrument.price = known.price;
+            instrument.contractSize = known.contractSize;
+        }
+        return instrument;
+    }
+
+    // "EURUSD:5,XAUUSD:2" (weight defaults to 1)
+    bool ParseSymbols(const std::string& csv, std::vector<Instrument>& instruments)
+    {
+        instruments.clear();
+        for (const std::string& item : hedgeedge::SplitTopics(csv))
+        {
+            size_t colon = item.find(':');
+            double weight = colon == std::string::npos ? 1.0 : std::atof(item.c_str() + colon + 1);
+            if (weight <= 0.0) return false;
+            instruments.push_back(KnownInstrument(item.substr(0, colon), weight));
+        }
+        return !instruments.empty();
+    }
+
+    struct Position
+    {
+        uint64_t ticket = 0;
+        size_t   instrument = 0;
+        int      side = 1;                      // +1 BUY, -1 SELL
+        int64_t  volumeSteps = 0;
+        int64_t  entry = 0;                     // Scaled prices
+        int64_t  stopLoss = 0;
+        int64_t  takeProfit = 0;
+        int64_t  openTime = 0;
+    };
+
+    struct Options
+    {
+        int         port = 51810;
+        std::string account = "900000001";
+        size_t      positions = 20;
+        double      rate = 50.0;
+        std::string shape = "steady";
+        int         burst = 10;
+        double      rampStep = 0.0;
+        double      rampSeconds = 0.0;
+        std::string symbols = "EURUSD:4,GBPUSD:2,USDJPY:2,XAUUSD:2,US30:1,BTCUSD:1";
+        int         modifyPct = 20;
+        int         snapshotMs = 500;           // InpPublishIntervalMs
+        int         heartbeatMs = 5000;         // InpHeartbeatIntervalSec
+        int         updateMs = 100;
+        int         batchMs = 0;
+        std::string codec;
+        std::string dictionary;
+        int         lanePort = 0;
+        std::string curveSecret;
+        int         hwm = 1000;
+        uint64_t    seed = 1;
+        uint64_t    seconds = 0;
+    };
+
+    // ========================================================================
+    // Master
+    // ========================================================================
+    // The simulated account and its message builders
+
+    class Master
+    {
+    public:
+        Master(const Options& options, std::vector<Instrument> instruments, hedgeedge::Publisher& publisher)
+            : m_options(options), m_instruments(std::move(instruments)), m_publisher(publisher),
+              m_random(options.seed)
+        {
+            for (const Instrument& instrument : m_instruments) m_totalWeight += instrument.weight;
+            m_quotes.reserve(m_instruments.size());
+            for (const Instrument& instrument : m_instruments)
+            {
+                m_quotes.push_back(hedgeedge::ScalePrice(instrument.price, instrument.digits));
+            }
+            for (size_t i = 0; i < options.positions; i++) m_book.push_back(NewPosition());
+        }
+
+        std::string Envelope() const
+        {
+            return "\"platform\":\"MT5\",\"accountId\":\"" + m_options.account + "\",\"role\":\"master\"";
+        }
+
+        size_t BookSize() const { return m_book.size(); }
+
+        void Connected()
+        {
+            Event("CONNECTED", AccountData());
+        }
+
+        // One POSITION_* event; opens and closes hold the book around its target
+        void TradeEvent()
+        {
+            Walk();
+            size_t target = m_options.positions;
+            int roll = static_cast<int>(m_random() % 100);
+
+            if (!m_book.empty() && roll < m_options.modifyPct)
+            {
+                Modify(m_book[m_random() % m_book.size()]);
+                return;
+            }
+
+            bool open = m_book.empty() || (m_book.size() < target ? m_random() % 4 != 0 : m_random() % 4 == 0);
+            if (m_book.size() > target + target / 10 + 1) open = false;
+            if (open) Open();
+            else Close(m_random() % m_book.size());
+            m_updatePending = true;
+        }
+
+        // The EA's deferred ACCOUNT_UPDATE, once per burst of deals
+        void FlushAccountUpdate()
+        {
+            if (!m_updatePending) return;
+            m_updatePending = false;
+            Event("ACCOUNT_UPDATE", AccountData());
+        }
+
+        void Heartbeat()
+        {
+            int64_t now = ServerTime();
+            std::string data = "{\"balance\":";
+            hedgeedge::AppendFixed(data, m_balance, 2);
+            data += ",\"equity\":";
+            hedgeedge::AppendFixed(data, m_balance + FloatingPnL(), 2);
+            data += ",\"profit\":";
+            hedgeedge::AppendFixed(data, FloatingPnL(), 2);
+            data += ",\"margin\":0.00,\"freeMargin\":";
+            hedgeedge::AppendFixed(data, m_balance + FloatingPnL(), 2);
+            data += ",\"positionCount\":";
+            hedgeedge::AppendUInt(data, m_book.size());
+            data += ",\"isLicenseValid\":true,\"isPaused\":false,\"serverTime\":\"";
+            hedgeedge::AppendServerTime(data, now);
+            data += "\",\"serverTimeUnix\":";
+            hedgeedge::AppendInt(data, now);
+            AppendGenerated(data);
+            data += "}";
+            Event("HEARTBEAT", data);
+        }
+
+        void Snapshot()
+        {
+            int64_t now = ServerTime();
+            m_json.clear();
+            m_json += "{\"type\":\"SNAPSHOT\",\"timestamp\":\"";
+            hedgeedge::AppendServerTime(m_json, now);
+            m_json += "\",\"serverTime\":\"";
+            hedgeedge::AppendServerTime(m_json, now);
+            m_json += "\",\"serverTimeUnix\":";
+            hedgeedge::AppendInt(m_json, now);
+            m_json += ",\"platform\":\"MT5\",\"role\":\"master\",\"accountId\":\"";
+            m_json += m_options.account;
+            m_json += "\",";
+            AppendAccountFields(m_json);
+            m_json += ",\"zmqMode\":true,\"eventDriven\":true,\"snapshotIndex\":";
+            hedgeedge::AppendInt(m_json, m_eventIndex);
+            m_json += ",\"avgLatencyUs\":0.00,\"latency\":null";
+            AppendGenerated(m_json);
+            m_json += ",\"positions\":";
+            AppendPositions(m_json);
+            m_json += "}";
+            Send("SNAPSHOT", m_json);
+        }
+
+        uint64_t Messages() const { return m_messages; }
+        uint64_t Bytes() const { return m_bytes; }
+        uint64_t SendFailures() const { return m_sendFailures; }
+
+    private:
+        int64_t ServerTime() const
+        {
+            return static_cast<int64_t>(hedgeedge::WallMicros() / 1000000);
+        }
+
+        size_t PickInstrument()
+        {
+            double pick = std::uniform_real_distribution<double>(0.0, m_totalWeight)(m_random);
+            for (size_t i = 0; i < m_instruments.size(); i++)
+            {
+                pick -= m_instruments[i].weight;
+                if (pick < 0.0) return i;
+            }
+            return m_instruments.size() - 1;
+        }
+
+        // Every quote moves a little between events
+        void Walk()
+        {
+            std::normal_distribution<double> move(0.0, 0.0002);
+            for (int64_t& quote : m_quotes)
+            {
+                int64_t next = static_cast<int64_t>(std::llround(static_cast<double>(quote) * (1.0 + move(m_random))));
+                if (next > 0) quote = next;
+            }
+        }
+
+        int64_t Offset(size_t instrument, double fraction)
+        {
+            return static_cast<int64_t>(std::llround(static_cast<double>(m_quotes[instrument]) * fraction));
+        }
+
+        // Half the positions trade with stops, 0.2% - 1% away
+        void RandomStops(Position& position)
+        {
+            position.stopLoss = 0;
+            position.takeProfit = 0;
+            if (m_random() % 2 == 0) return;
+            std::uniform_real_distribution<double> distance(0.002, 0.01);
+            position.stopLoss = position.entry - position.side * Offset(position.instrument, distance(m_random));
+            position.takeProfit = position.entry + position.side * Offset(position.instrument, distance(m_random));
+        }
+
+        Position NewPosition()
+        {
+            Position position;
+            position.ticket = m_nextTicket++;
+            position.instrument = PickInstrument();
+            position.side = m_random() % 2 == 0 ? 1 : -1;
+            position.volumeSteps = 1 + static_cast<int64_t>(m_random() % 100);
+            position.entry = m_quotes[position.instrument];
+            position.openTime = ServerTime();
+            RandomStops(position);
+            return position;
+        }
+
+        double Profit(const Position& position) const
+        {
+            const Instrument& instrument = m_instruments[position.instrument];
+            double move = hedgeedge::UnscalePrice(m_quotes[position.instrument] - position.entry, instrument.digits);
+            double lots = hedgeedge::UnitsToLots(position.volumeSteps * LOT_STEP_UNITS);
+            return position.side * move * lots * instrument.contractSize;
+        }
+
+        double FloatingPnL() const
+        {
+            double total = 0.0;
+            for (const Position& position : m_book) total += Profit(position);
+            return total;
+        }
+
+        void Open()
+        {
+            m_book.push_back(NewPosition());
+            Deal("POSITION_OPENED", m_book.back(), m_book.back().side, 0.0, "IN");
+        }
+
+        void Close(size_t index)
+        {
+            Position position = m_book[index];
+            m_book[index] = m_book.back();
+            m_book.pop_back();
+
+            double profit = Profit(position);
+            m_balance += profit;
+            Deal("POSITION_CLOSED", position, -position.side, profit, "OUT");
+        }
+
+        void Modify(Position& position)
+        {
+            Position previous = position;
+            RandomStops(position);
+            int digits = m_instruments[position.instrument].digits;
+
+            std::string data = "{\"position\":";
+            hedgeedge::AppendUInt(data, position.ticket);
+            data += ",\"symbol\":\"";
+            data += m_instruments[position.instrument].name;
+            data += position.side > 0 ? "\",\"type\":\"BUY\"" : "\",\"type\":\"SELL\"";
+            AppendPrice(data, "stopLoss", position.stopLoss, digits);
+            AppendPrice(data, "takeProfit", position.takeProfit, digits);
+            AppendPrice(data, "prevStopLoss", previous.stopLoss, digits);
+            AppendPrice(data, "prevTakeProfit", previous.takeProfit, digits);
+            data += ",\"digits\":";
+            hedgeedge::AppendInt(data, digits);
+            data += ",\"stopLossScaled\":";
+            hedgeedge::AppendInt(data, position.stopLoss);
+            data += ",\"takeProfitScaled\":";
+            hedgeedge::AppendInt(data, position.takeProfit);
+            AppendGenerated(data);
+            data += "}";
+            Event("POSITION_MODIFIED", data);
+        }
+
+        // The DEAL_ADD event: `dealSide` is the deal's direction
+        void Deal(const char* type, const Position& position, int dealSide, double profit, const char* entry)
+        {
+            const Instrument& instrument = m_instruments[position.instrument];
+            int64_t price = entry[0] == 'I' ? position.entry : m_quotes[position.instrument];
+
+            std::string data = "{\"deal\":";
+            hedgeedge::AppendUInt(data, m_nextDeal++);
+            data += ",\"position\":";
+            hedgeedge::AppendUInt(data, position.ticket);
+            data += ",\"symbol\":\"";
+            data += instrument.name;
+            data += "\",\"volume\":";
+            hedgeedge::AppendFixed(data, hedgeedge::UnitsToLots(position.volumeSteps * LOT_STEP_UNITS), 2);
+            data += ",\"price\":";
+            hedgeedge::AppendScaledPrice(data, price, instrument.digits);
+            data += ",\"profit\":";
+            hedgeedge::AppendFixed(data, profit, 2);
+            data += ",\"swap\":0.00,\"commission\":0.00";
+            data += dealSide > 0 ? ",\"type\":\"BUY\"" : ",\"type\":\"SELL\"";
+            AppendPrice(data, "stopLoss", entry[0] == 'I' ? position.stopLoss : 0, instrument.digits);
+            AppendPrice(data, "takeProfit", entry[0] == 'I' ? position.takeProfit : 0, instrument.digits);
+            data += ",\"comment\":\"\",\"digits\":";
+            hedgeedge::AppendInt(data, instrument.digits);
+            data += ",\"priceScaled\":";
+            hedgeedge::AppendInt(data, price);
+            data += ",\"stopLossScaled\":";
+            hedgeedge::AppendInt(data, entry[0] == 'I' ? position.stopLoss : 0);
+            data += ",\"takeProfitScaled\":";
+            hedgeedge::AppendInt(data, entry[0] == 'I' ? position.takeProfit : 0);
+            data += ",\"volumeSteps\":";
+            hedgeedge::AppendInt(data, position.volumeSteps);
+            data += ",\"lotStepE8\":";
+            hedgeedge::AppendInt(data, LOT_STEP_UNITS);
+            data += ",\"entry\":\"";
+            data += entry;
+            data += "\"";
+            AppendGenerated(data);
+            data += "}";
+            Event(type, data);
+        }
+
+        // "key":price, or null without one (as DoubleToString / "null")
+        static void AppendPrice(std::string& out, const char* key, int64_t scaled, int digits)
+        {
+            out += ",\"";
+            out += key;
+            out += "\":";
+            if (scaled > 0) hedgeedge::AppendScaledPrice(out, scaled, digits);
+            else out += "null";
+        }
+
+        static void AppendGenerated(std::string& out)
+        {
+            out += ",\"genUs\":";
+            hedgeedge::AppendUInt(out, hedgeedge::WallMicros());
+        }
+
+        // balance ... lastError, shared by SNAPSHOT and the account data
+        void AppendAccountFields(std::string& out) const
+        {
+            double floating = FloatingPnL();
+            out += "\"broker\":\"Hedge Edge Synthetic\",\"server\":\"Synthetic-Load\",\"balance\":";
+            hedgeedge::AppendFixed(out, m_balance, 2);
+            out += ",\"equity\":";
+            hedgeedge::AppendFixed(out, m_balance + floating, 2);
+            out += ",\"margin\":0.00,\"freeMargin\":";
+            hedgeedge::AppendFixed(out, m_balance + floating, 2);
+            out += ",\"marginLevel\":null,\"floatingPnL\":";
+            hedgeedge::AppendFixed(out, floating, 2);
+            out += ",\"currency\":\"USD\",\"leverage\":100,\"status\":\"Active\",\"isLicenseValid\":true,"
+                   "\"isPaused\":false,\"lastError\":null";
+        }
+
+        std::string AccountData() const
+        {
+            std::string data = "{\"accountId\":\"" + m_options.account + "\",";
+            AppendAccountFields(data);
+            data += ",\"eventDriven\":true";
+            AppendGenerated(data);
+            data += ",\"positions\":";
+            AppendPositions(data);
+            data += "}";
+            return data;
+        }
+
+        // BuildPositionsJson
+        void AppendPositions(std::string& out) const
+        {
+            out += "[";
+            for (size_t i = 0; i < m_book.size(); i++)
+            {
+                const Position& position = m_book[i];
+                const Instrument& instrument = m_instruments[position.instrument];
+                double lots = hedgeedge::UnitsToLots(position.volumeSteps * LOT_STEP_UNITS);
+
+                if (i > 0) out += ",";
+                out += "{\"id\":\"";
+                hedgeedge::AppendUInt(out, position.ticket);
+                out += "\",\"symbol\":\"";
+                out += instrument.name;
+                out += "\",\"volume\":";
+                hedgeedge::AppendFixed(out, lots * 100000.0, 0);
+                out += ",\"volumeLots\":";
+                hedgeedge::AppendFixed(out, lots, 2);
+                out += position.side > 0 ? ",\"side\":\"BUY\"" : ",\"side\":\"SELL\"";
+                out += ",\"entryPrice\":";
+                hedgeedge::AppendScaledPrice(out, position.entry, instrument.digits);
+                out += ",\"currentPrice\":";
+                hedgeedge::AppendScaledPrice(out, m_quotes[position.instrument], instrument.digits);
+                AppendPrice(out, "stopLoss", position.stopLoss, instrument.digits);
+                AppendPrice(out, "takeProfit", position.takeProfit, instrument.digits);
+                out += ",\"profit\":";
+                hedgeedge::AppendFixed(out, Profit(position), 2);
+                out += ",\"swap\":0.00,\"commission\":0.00,\"openTime\":\"";
+                hedgeedge::AppendServerTime(out, position.openTime);
+                out += "\",\"comment\":\"\",\"digits\":";
+                hedgeedge::AppendInt(out, instrument.digits);
+                out += ",\"entryPriceScaled\":";
+                hedgeedge::AppendInt(out, position.entry);
+                out += ",\"stopLossScaled\":";
+                hedgeedge::AppendInt(out, position.stopLoss);
+                out += ",\"takeProfitScaled\":";
+                hedgeedge::AppendInt(out, position.takeProfit);
+                out += ",\"volumeSteps\":";
+                hedgeedge::AppendInt(out, position.volumeSteps);
+                out += ",\"lotStepE8\":";
+                hedgeedge::AppendInt(out, LOT_STEP_UNITS);
+                out += "}";
+            }
+            out += "]";
+        }
+
+        // PublishEvent
+        void Event(const char* type, const std::string& data)
+        {
+            m_eventIndex++;
+            m_json.clear();
+            m_json += "{\"type\":\"";
+            m_json += type;
+            m_json += "\",\"eventIndex\":";
+            hedgeedge::AppendInt(m_json, m_eventIndex);
+            m_json += ",\"timestamp\":\"";
+            hedgeedge::AppendServerTime(m_json, ServerTime());
+            m_json += "\",";
+            m_json += Envelope();
+            m_json += ",\"data\":";
+            m_json += data;
+            m_json += "}";
+            Send("EVENT", m_json);
+        }
+
+        void Send(const std::string& topic, const std::string& json)
+        {
+            if (!m_publisher.Publish(topic, json.data(), json.size())) m_sendFailures++;
+            m_messages++;
+            m_bytes += json.size();
+        }
+
+        const Options&          m_options;
+        std::vector<Instrument> m_instruments;
+        hedgeedge::Publisher&   m_publisher;
+        std::mt19937_64         m_random;
+        double                  m_totalWeight = 0.0;
+        std::vector<int64_t>    m_quotes;           // Scaled, per instrument
+        std::vector<Position>   m_book;
+        double                  m_balance = 100000.0;
+        uint64_t                m_nextTicket = 500000000;
+        uint64_t                m_nextDeal = 700000000;
+        int64_t                 m_eventIndex = 0;
+        bool                    m_updatePending = false;
+        std::string             m_json;
+        uint64_t                m_messages = 0;
+        uint64_t                m_bytes = 0;
+        uint64_t                m_sendFailures = 0;
+    };
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    std::string dictPath;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--port" && hasValue) options.port = std::atoi(argv[++i]);
+        else if (arg == "--account" && hasValue) options.account = argv[++i];
+        else if (arg == "--positions" && hasValue) options.positions = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--rate" && hasValue) options.rate = std::atof(argv[++i]);
+        else if (arg == "--shape" && hasValue) options.shape = argv[++i];
+        else if (arg == "--burst" && hasValue) options.burst = std::atoi(argv[++i]);
+        else if (arg == "--ramp" && hasValue)
+        {
+            std::string ramp = argv[++i];
+            size_t colon = ramp.find(':');
+            options.rampStep = std::atof(ramp.c_str());
+            options.rampSeconds = colon == std::string::npos ? 1.0 : std::atof(ramp.c_str() + colon + 1);
+        }
+        else if (arg == "--symbols" && hasValue) options.symbols = argv[++i];
+        else if (arg == "--modify-pct" && hasValue) options.modifyPct = std::atoi(argv[++i]);
+        else if (arg == "--snapshot-ms" && hasValue) options.snapshotMs = std::atoi(argv[++i]);
+        else if (arg == "--heartbeat-ms" && hasValue) options.heartbeatMs = std::atoi(argv[++i]);
+        else if (arg == "--update-ms" && hasValue) options.updateMs = std::atoi(argv[++i]);
+        else if (arg == "--batch-ms" && hasValue) options.batchMs = std::atoi(argv[++i]);
+        else if (arg == "--compress" && hasValue) options.codec = argv[++i];
+        else if (arg == "--dict" && hasValue) dictPath = argv[++i];
+        else if (arg == "--lane" && hasValue) options.lanePort = std::atoi(argv[++i]);
+        else if (arg == "--curve-secret" && hasValue) options.curveSecret = argv[++i];
+        else if (arg == "--hwm" && hasValue) options.hwm = std::atoi(argv[++i]);
+        else if (arg == "--seed" && hasValue) options.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--seconds" && hasValue) options.seconds = std::strtoull(argv[++i], nullptr, 10);
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+
+    std::vector<Instrument> instruments;
+    bool validShape = options.shape == "steady" || options.shape == "poisson" || options.shape == "burst";
+    if (!ParseSymbols(options.symbols, instruments) || !validShape || options.rate <= 0.0 ||
+        options.burst < 1 || options.rampSeconds < 0.0 || options.modifyPct < 0 || options.modifyPct > 100)
+    {
+        Usage();
+        return 2;
+    }
+    if (!dictPath.empty() && !hedgeedge::ReadFileBytes(dictPath, options.dictionary))
+    {
+        std::fprintf(stderr, "cannot read %s\n", dictPath.c_str());
+        return 1;
+    }
+
+    if (!hedgeedge::Zmq())
+    {
+        std::fprintf(stderr, "libzmq not available\n");
+        return 1;
+    }
+
+    std::string error;
+    hedgeedge::Publisher publisher;
+    if (!publisher.Bind(options.port, options.curveSecret, options.hwm, &error))
+    {
+        std::fprintf(stderr, "cannot bind port %d: %s\n", options.port, error.c_str());
+        return 1;
+    }
+
+    Master master(options, std::move(instruments), publisher);
+    if (!options.codec.empty())
+    {
+        hedgeedge::Codec codec = options.codec == "lz4" ? hedgeedge::Codec::Lz4 : hedgeedge::Codec::Zstd;
+        if (!publisher.SetCompression(codec, options.dictionary, codec == hedgeedge::Codec::Lz4 ? 1 : 3,
+                                      { "EVENT", "SNAPSHOT" }))
+        {
+            std::fprintf(stderr, "%s not available\n", options.codec.c_str());
+            return 1;
+        }
+    }
+    if (options.batchMs > 0)
+    {
+        publisher.SetBatching("EVENT", options.batchMs, BATCH_MAX_EVENTS, BATCH_MAX_BYTES, master.Envelope());
+    }
+    if (options.lanePort > 0 && !publisher.SetPriorityLane(options.lanePort, options.hwm, &error))
+    {
+        std::fprintf(stderr, "cannot bind priority lane %d: %s\n", options.lanePort, error.c_str());
+        return 1;
+    }
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+    std::fprintf(stderr, "synthetic master %s on port %d: %zu positions, %.0f ev/s %s\n",
+                 options.account.c_str(), options.port, options.positions, options.rate, options.shape.c_str());
+
+    std::mt19937_64 arrivals(options.seed ^ 0x9E3779B97F4A7C15ULL);
+    hedgeedge::Histogram behind;
+    double rate = options.rate;
+    int group = options.shape == "burst" ? options.burst : 1;
+
+    uint64_t start = hedgeedge::NowMicros();
+    uint64_t nextEvent = start;
+    uint64_t nextSnapshot = start;
+    uint64_t nextHeartbeat = start + static_cast<uint64_t>(options.heartbeatMs) * 1000;
+    uint64_t nextUpdate = start;
+    uint64_t nextRamp = start + static_cast<uint64_t>(options.rampSeconds * 1e6);
+    uint64_t nextReport = start + 1000000;
+    uint64_t sentEvents = 0;
+    uint64_t reportedEvents = 0;
+    uint64_t reportedMessages = 0;
+    uint64_t reportedBytes = 0;
+
+    master.Connected();
+    while (!g_stop)
+    {
+        uint64_t now = hedgeedge::NowMicros();
+        if (options.seconds > 0 && now - start >= options.seconds * 1000000) break;
+
+        if (options.rampStep > 0.0 && options.rampSeconds > 0.0 && now >= nextRamp)
+        {
+            rate += options.rampStep;
+            nextRamp += static_cast<uint64_t>(options.rampSeconds * 1e6);
+        }
+
+        if (now >= nextEvent)
+        {
+            behind.Record(now - nextEvent);
+            for (int i = 0; i < group; i++) master.TradeEvent();
+            sentEvents += static_cast<uint64_t>(group);
+
+            double gapUs = 1e6 * group / rate;
+            if (options.shape == "poisson") gapUs = std::exponential_distribution<double>(1.0 / gapUs)(arrivals);
+            nextEvent += static_cast<uint64_t>(gapUs);
+        }
+        if (options.updateMs > 0 && now >= nextUpdate)
+        {
+            master.FlushAccountUpdate();
+            nextUpdate = now + static_cast<uint64_t>(options.updateMs) * 1000;
+        }
+        if (options.snapshotMs > 0 && now >= nextSnapshot)
+        {
+            master.Snapshot();
+            nextSnapshot = now + static_cast<uint64_t>(options.snapshotMs) * 1000;
+        }
+        if (options.heartbeatMs > 0 && now >= nextHeartbeat)
+        {
+            master.Heartbeat();
+            nextHeartbeat = now + static_cast<uint64_t>(options.heartbeatMs) * 1000;
+        }
+        if (now >= nextReport)
+        {
+            std::fprintf(stderr, "t=%3llus  target %7.0f ev/s  sent %7llu ev/s  %7llu msg/s  %8.1f KB/s  book %zu  behind p99 %llu us\n",
+                         static_cast<unsigned long long>((now - start) / 1000000), rate,
+                         static_cast<unsigned long long>(sentEvents - reportedEvents),
+                         static_cast<unsigned long long>(master.Messages() - reportedMessages),
+                         static_cast<double>(master.Bytes() - reportedBytes) / 1024.0, master.BookSize(),
+                         static_cast<unsigned long long>(behind.Percentile(99.0)));
+            reportedEvents = sentEvents;
+            reportedMessages = master.Messages();
+            reportedBytes = master.Bytes();
+            behind.Reset();
+            nextReport += 1000000;
+        }
+
+        uint64_t due = nextEvent;
+        if (options.snapshotMs > 0 && nextSnapshot < due) due = nextSnapshot;
+        if (options.heartbeatMs > 0 && nextHeartbeat < due) due = nextHeartbeat;
+        if (nextReport < due) due = nextReport;
+        now = hedgeedge::NowMicros();
+        if (now + SPIN_US < due) std::this_thread::sleep_for(std::chrono::microseconds(due - now - SPIN_US));
+    }
+
+    std::fprintf(stderr, "%llu events, %llu messages, %llu bytes, %llu send failures\n",
+                 static_cast<unsigned long long>(sentEvents), static_cast<unsigned long long>(master.Messages()),
+                 static_cast<unsigned long long>(master.Bytes()),
+                 static_cast<unsigned long long>(master.SendFailures()));
+    std::fprintf(stderr, "publisher: %s\n", publisher.StatsJson().c_str());
+    return 0;
+}
@@ -0,0 +1,342 @@
+// ============================================================================
+// Hedge Edge PGO Training Driver
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Exercises HedgeEdgeLicense.dll through its exports while the DLL is built
+// with HEDGEEDGE_PGO=GENERATE. MSVC keeps one profile per image, so the
+// command-line tools (which link the core statically) cannot train the DLL;
+// this driver makes the same calls the EAs make:
+//
+//   relay   receive a master stream (HedgeEdgeLoadGen) on a native subscriber,
+//           publish every message again through a compressing, batching
+//           publisher and drain that on a second subscriber: compression,
+//           batching, decompression and batch unpacking
+//   table   shared position table upserts, removes and reader snapshots
+//   rules   prop rule evaluation over a random equity walk
+//   stages  stage timers and latency windows
+//   license cached-token lookups (the EA's per-tick license check)
+//
+// Usage:
+//   HedgeEdgePgoTrain [--connect ENDPOINT] [--compressed] [--batched]
+//                     [--dict FILE] [--port N] [--seconds N] [--rounds N]
+//
+//   --connect    master data port to relay (no relay phase without it)
+//   --port       port for the relay publisher and the position table
+//                (default 51820)
+//   --seconds    length of the relay phase (default 30)
+//   --rounds     iterations of the local phases (default 200000)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgeLicense.h"
+#include "HedgeEdgePositionTable.h"
+#include "HedgeEdgeRules.h"
+#include "HedgeEdgeStages.h"
+#include "HedgeEdgeTransport.h"
+
+namespace {
+
+    const int  RECEIVE_TIMEOUT_MS = 100;
+    const int  RELAY_HWM = 100000;
+    const int  DATA_BUFFER = 4 * 1024 * 1024;
+    const int  TABLE_POSITIONS = 200;
+    const char RULES_CONFIG[] =
+        "{\"initialBalance\":100000,\"dailyLossPct\":5,\"maxDrawdownPct\":10,"
+        "\"trailingDrawdownPct\":6,\"profitTargetPct\":10,\"warnAtPct\":80}";
+    const char RELAY_ENVELOPE[] = "\"platform\":\"MT5\",\"accountId\":\"PGO\",\"role\":\"master\"";
+    const char* SYMBOLS[] = { "EURUSD", "GBPUSD", "USDJPY", "XAUUSD", "US30", "BTCUSD" };
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgePgoTrain [--connect ENDPOINT] [--compressed] [--batched]\n"
+            "                         [--dict FILE] [--port N] [--seconds N] [--rounds N]\n");
+    }
+
+    bool ReadFile(const std::string& path, std::string& out)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+        out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    long long NowMs()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Drain a subscriber, unpacking batches as HE_Hedge does; returns the
+    // number of events and snapshots taken
+    unsigned long long Drain(int subscriber, std::vector<char>& data, std::vector<char>& events,
+                             int timeoutMs)
+    {
+        char topic[64];
+        unsigned long long messages = 0;
+        int length;
+        while ((length = TransportReceive(subscriber, topic, sizeof(topic), data.data(),
+                                          static_cast<int>(data.size()), timeoutMs)) > 0)
+        {
+            timeoutMs = 0;
+            if (std::strcmp(topic, "EVENT.B") != 0)
+            {
+                messages++;
+                continue;
+            }
+            int count = BatchUnpack(data.data(), length, events.data(), static_cast<int>(events.size()));
+            if (count > 0) messages += static_cast<unsigned long long>(count);
+        }
+        return messages;
+    }
+
+    bool Relay(const std::string& endpoint, bool compressed, bool batched, const std::string& dict,
+               int port, int seconds)
+    {
+        int source = TransportSubscriberCreate(endpoint.c_str(), "", "", "", RELAY_HWM);
+        if (source <= 0)
+        {
+            std::fprintf(stderr, "relay: cannot connect %s (%d)\n", endpoint.c_str(), source);
+            return false;
+        }
+        TransportLoadDictionary(source, dict.data(), static_cast<int>(dict.size()));
+        TransportSubscribe(source, batched ? "EVENT.B" : "EVENT", compressed ? 1 : 0);
+        TransportSubscribe(source, "SNAPSHOT", compressed ? 1 : 0);
+
+        int publisher = TransportPublisherCreate(port, "", RELAY_HWM);
+        if (publisher <= 0)
+        {
+            std::fprintf(stderr, "relay: cannot bind port %d (%d)\n", port, publisher);
+            TransportClose(source);
+            return false;
+        }
+        unsigned int dictId = 0;
+        TransportSetCompression(publisher, 1, dict.data(), static_cast<int>(dict.size()), 3,
+                                "SNAPSHOT,EVENT,EVENT.B", &dictId);
+        TransportSetBatching(publisher, 5, 64, 65536, RELAY_ENVELOPE);
+
+        std::string relayEndpoint = "tcp://127.0.0.1:" + std::to_string(port);
+        int sink = TransportSubscriberCreate(relayEndpoint.c_str(), "", "", "", RELAY_HWM);
+        if (sink <= 0)
+        {
+            std::fprintf(stderr, "relay: cannot connect %s (%d)\n", relayEndpoint.c_str(), sink);
+            TransportClose(publisher);
+            TransportClose(source);
+            return false;
+        }
+        TransportLoadDictionary(sink, dict.data(), static_cast<int>(dict.size()));
+        TransportSubscribe(sink, "EVENT.B", 1);
+        TransportSubscribe(sink, "SNAPSHOT", 1);
+
+        std::vector<char> data(DATA_BUFFER);
+        std::vector<char> events(2 * DATA_BUFFER);
+        char topic[64];
+        unsigned long long received = 0;
+        unsigned long long relayed = 0;
+        long long endMs = NowMs() + static_cast<long long>(seconds) * 1000;
+        while (NowMs() < endMs)
+        {
+            int length = TransportReceive(source, topic, sizeof(topic), data.data(),
+                                          static_cast<int>(data.size()), RECEIVE_TIMEOUT_MS);
+            if (length < 0)
+            {
+                std::fprintf(stderr, "relay: receive failed (%d)\n", length);
+                break;
+            }
+            if (length > 0)
+            {
+                received++;
+                TransportPublish(publisher, topic, static_cast<int>(std::strlen(topic)), data.data(), length);
+            }
+            relayed += Drain(sink, data, events, 0);
+        }
+        relayed += Drain(sink, data, events, RECEIVE_TIMEOUT_MS);
+
+        std::vector<char> stats(64 * 1024);
+        if (TransportStats(publisher, stats.data(), static_cast<int>(stats.size())) > 0)
+            std::printf("relay publisher: %s\n", stats.data());
+        std::printf("relay: %llu received, %llu relayed\n", received, relayed);
+
+        TransportClose(sink);
+        TransportClose(publisher);
+        TransportClose(source);
+        return received > 0;
+    }
+
+    void Table(int port, int rounds, std::mt19937_64& random)
+    {
+        int writer = PositionTableCreate(port, TABLE_POSITIONS * 2);
+        int reader = writer > 0 ? PositionTableAttach(port) : -1;
+        if (writer <= 0 || reader <= 0)
+        {
+            std::fprintf(stderr, "table: unavailable on port %d (%d, %d)\n", port, writer, reader);
+            if (writer > 0) PositionTableClose(writer);
+            return;
+        }
+
+        std::uniform_int_distribution<int> pick(0, TABLE_POSITIONS - 1);
+        std::uniform_real_distribution<double> price(1.0, 2.0);
+        char symbol[32];
+        long long ticket;
+        int type;
+        double volume, entry, stopLoss, takeProfit;
+        for (int i = 0; i < rounds; i++)
+        {
+            long long id = 1000 + pick(random);
+            if (i % 5 == 4)
+                PositionTableRemove(writer, id);
+            else
+                PositionTableUpsert(writer, id, SYMBOLS[id % 6], static_cast<int>(id & 1),
+                                    0.01 * static_cast<double>(1 + id % 100), price(random), 0.0, 0.0,
+                                    1700000000 + i);
+
+            if (i % 16 == 0)
+            {
+                int count = PositionTableSnapshot(reader);
+                for (int entryIndex = 0; entryIndex < count; entryIndex++)
+                    PositionTableGetEntry(reader, entryIndex, &ticket, symbol, sizeof(symbol), &type,
+                                          &volume, &entry, &stopLoss, &takeProfit);
+            }
+        }
+        PositionTableClose(reader);
+        PositionTableClose(writer);
+    }
+
+    void Rules(int rounds, std::mt19937_64& random)
+    {
+        int rules = RulesCreate(RULES_CONFIG);
+        if (rules <= 0)
+        {
+            std::fprintf(stderr, "rules: config rejected (%d)\n", rules);
+            return;
+        }
+
+        std::normal_distribution<double> step(0.0, 150.0);
+        char type[32];
+        std::vector<char> json(4096);
+        std::vector<char> stats(16 * 1024);
+        long long serverTime = 1700000000;
+        double balance = 100000.0;
+        double equity = balance;
+        for (int i = 0; i < rounds; i++)
+        {
+            serverTime += 7;
+            equity += step(random);
+            if (i % 50 == 0) balance = equity;
+            // Keep the walk around the account so every rule changes state now and then
+            if (equity < 88000.0 || equity > 112000.0) equity = balance = 100000.0;
+
+            if (RulesUpdate(rules, serverTime, balance, equity) > 0)
+            {
+                while (RulesNextEvent(rules, type, sizeof(type), json.data(), static_cast<int>(json.size())) > 0) {}
+            }
+            if (i % 1000 == 0) RulesStats(rules, stats.data(), static_cast<int>(stats.size()));
+        }
+        RulesClose(rules);
+    }
+
+    void Stages(int rounds)
+    {
+        int timers = StageTimersCreate("PgoTrain");
+        if (timers <= 0) return;
+
+        int outer = StageTimersAdd(timers, "outer", 50000);
+        int inner = StageTimersAdd(timers, "inner", 1000);
+        std::vector<char> json(64 * 1024);
+        for (int i = 0; i < rounds; i++)
+        {
+            StageBegin(timers, outer);
+            StageBegin(timers, inner);
+            StageEnd(timers, inner);
+            StageEnd(timers, outer);
+            if (i % 1000 == 0)
+            {
+                StageWindowMean(timers, outer, 60);
+                StageTimersWindows(timers, json.data(), static_cast<int>(json.size()));
+            }
+        }
+        StageTimersStats(timers, json.data(), static_cast<int>(json.size()));
+        StageTimersClose(timers);
+    }
+
+    void License(int rounds)
+    {
+        char token[512];
+        for (int i = 0; i < rounds; i++)
+        {
+            if (IsTokenValid()) GetCachedToken(token, sizeof(token));
+            GetTokenTTL();
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string endpoint;
+    std::string dictionary;
+    bool compressed = false;
+    bool batched = false;
+    int port = 51820;
+    int seconds = 30;
+    int rounds = 200000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--connect" && hasValue) endpoint = argv[++i];
+        else if (arg == "--compressed") compressed = true;
+        else if (arg == "--batched") batched = true;
+        else if (arg == "--dict" && hasValue)
+        {
+            std::string dictPath = argv[++i];
+            if (!ReadFile(dictPath, dictionary))
+            {
+                std::fprintf(stderr, "cannot read %s\n", dictPath.c_str());
+                return 1;
+            }
+        }
+        else if (arg == "--port" && hasValue) port = std::atoi(argv[++i]);
+        else if (arg == "--seconds" && hasValue) seconds = std::atoi(argv[++i]);
+        else if (arg == "--rounds" && hasValue) rounds = std::atoi(argv[++i]);
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+    if (port <= 0 || port > 65535 || seconds <= 0 || rounds <= 0)
+    {
+        Usage();
+        return 2;
+    }
+
+    InitializeLibrary();
+    std::mt19937_64 random(42);
+
+    bool relayed = endpoint.empty() || Relay(endpoint, compressed, batched, dictionary, port, seconds);
+    Table(port, rounds, random);
+    Rules(rounds, random);
+    Stages(rounds);
+    License(rounds);
+
+    ShutdownLibrary();
+    if (!relayed)
+    {
+        std::fprintf(stderr, "relay phase received nothing: the profile lacks the stream paths\n");
+        return 1;
+    }
+    std::printf("training done\n");
+    return 0;
+}
@@ -0,0 +1,167 @@
+// ============================================================================
+// Hedge Edge Stream Recorder
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Records a master data port into a HedgeEdgeRecording.h file: every frame
+// as it arrived on the wire (compressed and batched variants stay encoded,
+// so a replay exercises the decoder too), with its receive time.
+//
+// Usage:
+//   HedgeEdgeRecorder --connect ENDPOINT --out FILE
+//                     [--server-key KEY --curve-public KEY --curve-secret KEY]
+//                     [--topics EVENT,SNAPSHOT] [--compressed] [--batched]
+//                     [--seconds N]
+//
+//   --compressed  subscribe to the .Z variants (master with compression on)
+//   --batched     take EVENT.B instead of EVENT (master with batching on)
+//
+// Stops after --seconds or on Ctrl+C.
+// ============================================================================
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeRecording.h"
+#include "HedgeEdgeTransport.h"
+#include "HedgeEdgeZmq.h"
+
+namespace {
+
+    const int POLL_INTERVAL_MS = 200;
+    const int RECEIVE_HWM = 1000000;
+    const uint64_t FLUSH_INTERVAL_US = 1000000;
+
+    volatile std::sig_atomic_t g_stop = 0;
+
+    void OnSignal(int)
+    {
+        g_stop = 1;
+    }
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgeRecorder --connect ENDPOINT --out FILE\n"
+            "                         [--server-key KEY --curve-public KEY --curve-secret KEY]\n"
+            "                         [--topics EVENT,SNAPSHOT] [--compressed] [--batched]\n"
+            "                         [--seconds N]\n");
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string endpoint;
+    std::string output;
+    std::string serverKey;
+    std::string curvePublic;
+    std::string curveSecret;
+    std::string topics = "EVENT,SNAPSHOT";
+    bool compressed = false;
+    bool batched = false;
+    uint64_t seconds = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--connect" && hasValue) endpoint = argv[++i];
+        else if (arg == "--out" && hasValue) output = argv[++i];
+        else if (arg == "--server-key" && hasValue) serverKey = argv[++i];
+        else if (arg == "--curve-public" && hasValue) curvePublic = argv[++i];
+        else if (arg == "--curve-secret" && hasValue) curveSecret = argv[++i];
+        else if (arg == "--topics" && hasValue) topics = argv[++i];
+        else if (arg == "--compressed") compressed = true;
+        else if (arg == "--batched") batched = true;
+        else if (arg == "--seconds" && hasValue) seconds = std::strtoull(argv[++i], nullptr, 10);
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+    if (endpoint.empty() || output.empty())
+    {
+        Usage();
+        return 2;
+    }
+
+    const hedgeedge::ZmqApi* zmq = hedgeedge::Zmq();
+    if (!zmq)
+    {
+        std::fprintf(stderr, "libzmq not available\n");
+        return 1;
+    }
+
+    std::string error;
+    hedgeedge::Subscriber subscriber;
+    if (!subscriber.Connect(endpoint, serverKey, curvePublic, curveSecret, RECEIVE_HWM, &error))
+    {
+        std::fprintf(stderr, "cannot connect %s: %s\n", endpoint.c_str(), error.c_str());
+        return 1;
+    }
+    for (std::string topic : hedgeedge::SplitTopics(topics))
+    {
+        if (batched && topic == "EVENT") topic += hedgeedge::BATCH_TOPIC_SUFFIX;
+        subscriber.Subscribe(topic, compressed);
+    }
+
+    hedgeedge::RecordingWriter writer;
+    uint64_t startUs = hedgeedge::NowMicros();
+    if (!writer.Open(output, hedgeedge::WallMicros()))
+    {
+        std::fprintf(stderr, "cannot create %s\n", output.c_str());
+        return 1;
+    }
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+    std::fprintf(stderr, "recording %s -> %s\n", endpoint.c_str(), output.c_str());
+
+    // Raw frames straight off the socket: the subscriber only sets up the
+    // connection and the topic filters
+    hedgeedge::ZmqFrame frame;
+    uint64_t lastFlushUs = startUs;
+    bool failed = false;
+    while (!g_stop && !failed)
+    {
+        uint64_t now = hedgeedge::NowMicros();
+        if (seconds > 0 && now - startUs >= seconds * 1000000) break;
+
+        hedgeedge::ZmqPollItem item = { subscriber.Socket(), 0, hedgeedge::ZMQ_POLLIN, 0 };
+        if (zmq->poll(&item, 1, POLL_INTERVAL_MS) > 0)
+        {
+            while (frame.Receive(subscriber.Socket(), hedgeedge::ZMQ_DONTWAIT) >= 0)
+            {
+                uint64_t receivedUs = hedgeedge::NowMicros();
+                std::string_view bytes(frame.Data(), frame.Size());
+                size_t bar = bytes.find('|');
+                std::string_view topic = bar == std::string_view::npos ? std::string_view() : bytes.substr(0, bar);
+                std::string_view payload = bar == std::string_view::npos ? bytes : bytes.substr(bar + 1);
+                if (!writer.Append(receivedUs - startUs, topic, payload))
+                {
+                    failed = true;
+                    break;
+                }
+            }
+        }
+
+        if (hedgeedge::NowMicros() - lastFlushUs >= FLUSH_INTERVAL_US)
+        {
+            failed = failed || !writer.Flush();
+            lastFlushUs = hedgeedge::NowMicros();
+        }
+    }
+
+    writer.Close();
+    std::fprintf(stderr, "%llu frames, %llu bytes%s\n", static_cast<unsigned long long>(writer.Frames()),
+                 static_cast<unsigned long long>(writer.Bytes()), failed ? " (write failed)" : "");
+    return failed ? 1 : 0;
+}
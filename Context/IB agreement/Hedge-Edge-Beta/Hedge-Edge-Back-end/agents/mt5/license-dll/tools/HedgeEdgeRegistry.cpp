@@ -0,0 +1,121 @@
+// ============================================================================
+// Hedge Edge Agent Registry Watcher
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Prints the agents registered on this host. In watch mode it prints one
+// JSON line per registry change, so the desktop app can run it as a child
+// process and track terminals from its stdout without polling files.
+//
+// Usage:
+//   HedgeEdgeRegistry list
+//   HedgeEdgeRegistry watch [--license-key-file FILE]
+//
+// Watch output: {"generation":N,"agents":[...]} (agent fields as RegistryList)
+// ============================================================================
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeRegistry.h"
+
+namespace {
+
+    // Wake up now and then to reap agents whose terminal was killed
+    const int REAP_INTERVAL_MS = 2000;
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgeRegistry list\n"
+            "       HedgeEdgeRegistry watch [--license-key-file FILE]\n");
+    }
+
+    void PrintAgents(hedgeedge::AgentRegistry& registry, uint64_t generation)
+    {
+        std::vector<hedgeedge::AgentInfo> agents;
+        registry.List(agents);
+        std::printf("{\"generation\":%llu,\"agents\":%s}\n",
+                    static_cast<unsigned long long>(generation),
+                    hedgeedge::AgentsJson(agents).c_str());
+        std::fflush(stdout);
+    }
+
+    bool PublishLicenseKey(hedgeedge::AgentRegistry& registry, const std::string& path)
+    {
+        std::string key;
+        if (!hedgeedge::ReadFileBytes(path, key))
+        {
+            std::fprintf(stderr, "cannot read %s\n", path.c_str());
+            return false;
+        }
+        while (!key.empty() && (key.back() == '\n' || key.back() == '\r' || key.back() == ' ')) key.pop_back();
+        if (!registry.SetLicenseKey(key))
+        {
+            std::fprintf(stderr, "license key too long\n");
+            return false;
+        }
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        Usage();
+        return 2;
+    }
+
+    std::string command = argv[1];
+    std::string keyFile;
+    for (int i = 2; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--license-key-file" && i + 1 < argc) keyFile = argv[++i];
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+    if (command != "list" && command != "watch")
+    {
+        Usage();
+        return 2;
+    }
+
+    hedgeedge::AgentRegistry registry;
+    if (!registry.Open())
+    {
+        std::fprintf(stderr, "cannot open the agent registry\n");
+        return 1;
+    }
+
+    if (command == "list")
+    {
+        PrintAgents(registry, registry.Generation());
+        return 0;
+    }
+
+    if (!keyFile.empty() && !PublishLicenseKey(registry, keyFile)) return 1;
+
+    registry.Reap();
+    uint64_t seen = registry.Generation();
+    PrintAgents(registry, seen);
+    for (;;)
+    {
+        uint64_t generation = registry.Wait(seen, REAP_INTERVAL_MS);
+        if (generation == seen)
+        {
+            registry.Reap();
+            generation = registry.Generation();
+            if (generation == seen) continue;
+        }
+        seen = generation;
+        PrintAgents(registry, seen);
+    }
+}
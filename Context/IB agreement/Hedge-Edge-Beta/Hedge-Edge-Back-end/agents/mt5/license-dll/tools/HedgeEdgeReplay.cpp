@@ -0,0 +1,290 @@
+// ============================================================================
+// Hedge Edge Stream Replay
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// Feeds a recording (HedgeEdgeRecorder) through the hedge's native pipeline
+// and reports throughput and per-stage latency:
+//
+//   decode     .Z decompression and EVENT.B unpacking, per frame
+//   parse      JSON extraction of what copying needs, per message
+//   decide     copy decision for a POSITION_* event
+//   reconcile  position reconciliation for a state message
+//   lag        how late a frame was delivered against its schedule (paced)
+//
+// Stages are timed in nanoseconds, the lag in microseconds.
+//
+// The decisions are hashed into a digest: a performance change that leaves
+// the copy behavior alone replays a recorded day to the same digest.
+//
+// Usage:
+//   HedgeEdgeReplay FILE [--speed X | --max] [--repeat N] [--dict FILE]
+//                        [--multiplier X] [--fixed-lots X] [--max-lots X]
+//                        [--no-invert] [--decisions]
+//
+//   --speed X     replay at X times the recorded pace (default 1)
+//   --max         no pacing: as fast as the pipeline goes
+//   --repeat N    replay N times, each pass from an empty hedge
+//   --decisions   print every decision with its recorded offset
+// ============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "HedgeEdgeArena.h"
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgeCompress.h"
+#include "HedgeEdgeCopy.h"
+#include "HedgeEdgeHistogram.h"
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeRecording.h"
+
+namespace {
+
+    const uint64_t SPIN_US = 200;            // Sleep until this close to a frame's time, then spin
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgeReplay FILE [--speed X | --max] [--repeat N] [--dict FILE]\n"
+            "                            [--multiplier X] [--fixed-lots X] [--max-lots X]\n"
+            "                            [--no-invert] [--decisions]\n");
+    }
+
+    bool EndsWith(std::string_view text, std::string_view suffix)
+    {
+        return text.size() >= suffix.size() && text.substr(text.size() - suffix.size()) == suffix;
+    }
+
+    struct Stages
+    {
+        hedgeedge::Histogram decode;
+        hedgeedge::Histogram parse;
+        hedgeedge::Histogram decide;
+        hedgeedge::Histogram reconcile;
+        hedgeedge::Histogram lag;
+    };
+
+    class Replay
+    {
+    public:
+        Replay(const hedgeedge::CopyConfig& config, bool printDecisions)
+            : m_config(config), m_engine(config), m_printDecisions(printDecisions) {}
+
+        // Each pass starts from an empty hedge, so every pass decides the same
+        void NewPass()
+        {
+            m_engine = hedgeedge::CopyEngine(m_config);
+        }
+
+        bool Configure(const std::string& dictionary)
+        {
+            bool zstd = hedgeedge::CodecAvailable(hedgeedge::Codec::Zstd) &&
+                        m_zstd.Configure(hedgeedge::Codec::Zstd, dictionary, 3);
+            bool lz4 = hedgeedge::CodecAvailable(hedgeedge::Codec::Lz4) &&
+                       m_lz4.Configure(hedgeedge::Codec::Lz4, dictionary, 1);
+            return zstd || lz4;
+        }
+
+        void Frame(const hedgeedge::RecordedFrame& frame)
+        {
+            m_frames++;
+            uint64_t start = hedgeedge::NowNanos();
+
+            std::string_view topic = frame.topic;
+            std::string_view payload = frame.payload;
+            if (EndsWith(topic, hedgeedge::COMPRESSED_TOPIC_SUFFIX))
+            {
+                topic.remove_suffix(sizeof(hedgeedge::COMPRESSED_TOPIC_SUFFIX) - 1);
+                hedgeedge::Codec codec = payload.empty() ? hedgeedge::Codec::None
+                    : static_cast<hedgeedge::Codec>(static_cast<unsigned char>(payload[0]));
+                hedgeedge::Compressor& compressor = codec == hedgeedge::Codec::Lz4 ? m_lz4 : m_zstd;
+                if (!compressor.Decompress(payload.data(), payload.size(), m_raw))
+                {
+                    m_decodeErrors++;
+                    return;
+                }
+                payload = m_raw;
+            }
+
+            hedgeedge::ArenaScope scope(m_arena);
+            m_messages.clear();
+            if (EndsWith(topic, hedgeedge::BATCH_TOPIC_SUFFIX))
+            {
+                topic.remove_suffix(sizeof(hedgeedge::BATCH_TOPIC_SUFFIX) - 1);
+                if (!hedgeedge::UnpackBatch(payload.data(), payload.size(), m_arena, m_messages))
+                {
+                    m_decodeErrors++;
+                    return;
+                }
+            }
+            else
+            {
+                m_messages.push_back(payload);
+            }
+            uint64_t decoded = hedgeedge::NowNanos();
+            m_stages.decode.Record(decoded - start);
+
+            for (std::string_view message : m_messages) Message(topic, message, frame.offsetUs);
+        }
+
+        void Message(std::string_view topic, std::string_view message, uint64_t offsetUs)
+        {
+            m_messageCount++;
+            uint64_t start = hedgeedge::NowNanos();
+            if (!m_engine.Parse(topic, message, m_signal))
+            {
+                m_parseErrors++;
+                return;
+            }
+            uint64_t parsed = hedgeedge::NowNanos();
+            m_stages.parse.Record(parsed - start);
+            if (m_signal.kind == hedgeedge::CopySignal::None) return;
+
+            m_decisions.clear();
+            m_engine.Decide(m_signal, m_decisions);
+            uint64_t decided = hedgeedge::NowNanos();
+            (m_signal.kind == hedgeedge::CopySignal::State ? m_stages.reconcile : m_stages.decide)
+                .Record(decided - parsed);
+
+            for (const hedgeedge::CopyDecision& decision : m_decisions)
+            {
+                m_line.clear();
+                hedgeedge::AppendDecision(m_line, decision);
+                for (char c : m_line) m_digest = (m_digest ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+                m_digest = (m_digest ^ '\n') * 1099511628211ULL;
+                m_decisionCount++;
+                if (m_printDecisions)
+                {
+                    std::printf("%12.6f %s\n", static_cast<double>(offsetUs) / 1e6, m_line.c_str());
+                }
+            }
+        }
+
+        Stages& StageHistograms() { return m_stages; }
+
+        void Report(uint64_t elapsedUs, bool truncated)
+        {
+            double seconds = elapsedUs > 0 ? static_cast<double>(elapsedUs) / 1e6 : 1e-6;
+            std::printf("frames:        %llu (%.0f/s)%s\n", static_cast<unsigned long long>(m_frames),
+                        m_frames / seconds, truncated ? ", recording truncated" : "");
+            std::printf("messages:      %llu (%.0f/s)\n", static_cast<unsigned long long>(m_messageCount),
+                        m_messageCount / seconds);
+            std::printf("decisions:     %llu, digest %016llx\n", static_cast<unsigned long long>(m_decisionCount),
+                        static_cast<unsigned long long>(m_digest));
+            std::printf("errors:        decode %llu, parse %llu\n", static_cast<unsigned long long>(m_decodeErrors),
+                        static_cast<unsigned long long>(m_parseErrors));
+            std::printf("elapsed:       %.3f s\n", seconds);
+            std::printf("decode ns:     %s\n", m_stages.decode.Json().c_str());
+            std::printf("parse ns:      %s\n", m_stages.parse.Json().c_str());
+            std::printf("decide ns:     %s\n", m_stages.decide.Json().c_str());
+            std::printf("reconcile ns:  %s\n", m_stages.reconcile.Json().c_str());
+            if (m_stages.lag.Count()) std::printf("lag us:        %s\n", m_stages.lag.Json().c_str());
+            std::printf("copy:          %s\n", m_engine.StatsJson().c_str());
+        }
+
+    private:
+        hedgeedge::CopyConfig                    m_config;
+        hedgeedge::CopyEngine                    m_engine;
+        bool                                     m_printDecisions;
+        hedgeedge::Compressor                    m_zstd;
+        hedgeedge::Compressor                    m_lz4;
+        hedgeedge::Arena                         m_arena;
+        std::string                              m_raw;
+        std::vector<std::string_view>            m_messages;
+        hedgeedge::CopySignal                    m_signal;
+        std::vector<hedgeedge::CopyDecision>     m_decisions;
+        std::string                              m_line;
+        Stages                                   m_stages;
+        uint64_t m_frames = 0;
+        uint64_t m_messageCount = 0;
+        uint64_t m_decisionCount = 0;
+        uint64_t m_decodeErrors = 0;
+        uint64_t m_parseErrors = 0;
+        uint64_t m_digest = 14695981039346656037ULL;
+    };
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string path;
+    double speed = 1.0;
+    int repeat = 1;
+    std::string dictionary;
+    bool printDecisions = false;
+    hedgeedge::CopyConfig config;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--speed" && hasValue) speed = std::atof(argv[++i]);
+        else if (arg == "--max") speed = 0.0;
+        else if (arg == "--repeat" && hasValue) repeat = std::atoi(argv[++i]);
+        else if (arg == "--dict" && hasValue)
+        {
+            std::string dictPath = argv[++i];
+            if (!hedgeedge::ReadFileBytes(dictPath, dictionary))
+            {
+                std::fprintf(stderr, "cannot read %s\n", dictPath.c_str());
+                return 1;
+            }
+        }
+        else if (arg == "--multiplier" && hasValue) config.lotMultiplier = std::atof(argv[++i]);
+        else if (arg == "--fixed-lots" && hasValue) config.fixedLots = std::atof(argv[++i]);
+        else if (arg == "--max-lots" && hasValue) config.maxLots = std::atof(argv[++i]);
+        else if (arg == "--no-invert") config.invert = false;
+        else if (arg == "--decisions") printDecisions = true;
+        else if (path.empty() && arg.compare(0, 2, "--") != 0) path = arg;
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+    if (path.empty() || speed < 0.0 || repeat < 1)
+    {
+        Usage();
+        return 2;
+    }
+
+    hedgeedge::RecordingReader reader;
+    if (!reader.Open(path))
+    {
+        std::fprintf(stderr, "cannot read recording %s\n", path.c_str());
+        return 1;
+    }
+
+    Replay replay(config, printDecisions);
+    if (!replay.Configure(dictionary)) std::fprintf(stderr, "no codec available: compressed frames will fail\n");
+
+    hedgeedge::RecordedFrame frame;
+    uint64_t start = hedgeedge::NowMicros();
+    for (int pass = 0; pass < repeat; pass++)
+    {
+        reader.Rewind();
+        replay.NewPass();
+        uint64_t passStart = hedgeedge::NowMicros();
+        while (reader.Next(frame))
+        {
+            if (speed > 0.0)
+            {
+                uint64_t due = passStart + static_cast<uint64_t>(static_cast<double>(frame.offsetUs) / speed);
+                uint64_t now = hedgeedge::NowMicros();
+                if (now + SPIN_US < due) std::this_thread::sleep_for(std::chrono::microseconds(due - now - SPIN_US));
+                while ((now = hedgeedge::NowMicros()) < due) {}
+                replay.StageHistograms().lag.Record(now - due);
+            }
+            replay.Frame(frame);
+        }
+    }
+
+    replay.Report(hedgeedge::NowMicros() - start, reader.Truncated());
+    return 0;
+}
@@ -0,0 +1,372 @@
+// ============================================================================
+// Hedge Edge Subscriber Benchmark
+// Version: 1.0.0
+// Copyright (c) 2026 Hedge Edge
+// ============================================================================
+// The hedge's side of a load test: subscribes to a master (typically
+// HedgeEdgeLoadGen) the way HE_Hedge does, runs every message through the
+// native copy pipeline and reports, per one-second window:
+//
+//   events     POSITION_* / other events and snapshots received
+//   missing    eventIndex values never delivered (high-water-mark drops)
+//   e2e        generation to handling, from the messages' "genUs" (us)
+//   receive    Subscriber::Receive, decompression and batch unpacking (ns)
+//   trade      parse and decide of a POSITION_* event (ns)
+//   state      parse and reconcile of a position list: CONNECTED,
+//              ACCOUNT_UPDATE, SNAPSHOT (ns)
+//   busy       share of the window the consumer thread spent in the above
+//
+// A stage breaks in the first window where it can no longer keep up:
+//
+//   delivery   messages go missing, or e2e p99 exceeds --slo-ms (queueing
+//              anywhere between the generator and the handler)
+//   consumer   busy above 90%: the hedge thread is saturated
+//
+// With the generator ramping its rate (--ramp), the report names the event
+// rate at which each stage broke and the best rate sustained before it.
+//
+// Usage:
+//   HedgeEdgeSubBench --connect ENDPOINT [--lane ENDPOINT]
+//                     [--server-key KEY --curve-public KEY --curve-secret KEY]
+//                     [--compressed] [--batched] [--dict FILE] [--hwm N]
+//                     [--slo-ms N] [--seconds N]
+// ============================================================================
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "HedgeEdgeArena.h"
+#include "HedgeEdgeBatch.h"
+#include "HedgeEdgeCopy.h"
+#include "HedgeEdgeHistogram.h"
+#include "HedgeEdgeJson.h"
+#include "HedgeEdgePlatform.h"
+#include "HedgeEdgeTransport.h"
+#include "HedgeEdgeZmq.h"
+
+namespace {
+
+    const int      RECEIVE_TIMEOUT_MS = 100;
+    const uint64_t WINDOW_US = 1000000;
+    const double   SATURATED_BUSY = 0.9;
+
+    volatile std::sig_atomic_t g_stop = 0;
+
+    void OnSignal(int)
+    {
+        g_stop = 1;
+    }
+
+    void Usage()
+    {
+        std::fprintf(stderr,
+            "usage: HedgeEdgeSubBench --connect ENDPOINT [--lane ENDPOINT]\n"
+            "                         [--server-key KEY --curve-public KEY --curve-secret KEY]\n"
+            "                         [--compressed] [--batched] [--dict FILE] [--hwm N]\n"
+            "                         [--slo-ms N] [--seconds N]\n");
+    }
+
+    struct Window
+    {
+        uint64_t             trades = 0;         // POSITION_* events
+        uint64_t             others = 0;         // Other events
+        uint64_t             snapshots = 0;
+        uint64_t             missing = 0;
+        uint64_t             busyNs = 0;
+        hedgeedge::Histogram e2e;
+        hedgeedge::Histogram receive;
+        hedgeedge::Histogram trade;
+        hedgeedge::Histogram state;
+
+        void Reset() { *this = Window(); }
+    };
+
+    struct Breaking
+    {
+        bool     broken = false;
+        uint64_t second = 0;
+        uint64_t rate = 0;                       // Trade events/s in the breaking window
+        uint64_t bestRate = 0;                   // Best window before it
+        const char* reason = "";
+    };
+
+    class Bench
+    {
+    public:
+        Bench(uint64_t sloUs) : m_engine(hedgeedge::CopyConfig()), m_sloUs(sloUs) {}
+
+        void Message(std::string_view topic, std::string_view message, uint64_t receiveNs)
+        {
+            uint64_t start = hedgeedge::NowNanos();
+            if (!m_engine.Parse(topic, message, m_signal))
+            {
+                m_parseErrors++;
+                return;
+            }
+            m_decisions.clear();
+            m_engine.Decide(m_signal, m_decisions);
+            uint64_t handled = hedgeedge::NowNanos();
+
+            bool trade = m_signal.kind == hedgeedge::CopySignal::Opened || m_signal.kind == hedgeedge::CopySignal::Closed ||
+                         m_signal.kind == hedgeedge::CopySignal::Modified;
+            m_window.receive.Record(receiveNs);
+            if (trade) m_window.trade.Record(handled - start);
+            else if (m_signal.kind == hedgeedge::CopySignal::State) m_window.state.Record(handled - start);
+            m_window.busyNs += receiveNs + handled - start;
+
+            // Where the message was generated: data.genUs for events
+            std::string_view data = message;
+            if (topic == "EVENT")
+            {
+                hedgeedge::JsonMember(message, "data", data);
+                Sequence(hedgeedge::JsonInt(message, "eventIndex"));
+                if (trade) m_window.trades++;
+                else m_window.others++;
+            }
+            else
+            {
+                m_window.snapshots++;
+            }
+            uint64_t generated = static_cast<uint64_t>(hedgeedge::JsonInt(data, "genUs"));
+            uint64_t now = hedgeedge::WallMicros();
+            if (generated > 0) m_window.e2e.Record(now > generated ? now - generated : 0);
+        }
+
+        void CloseWindow(uint64_t second)
+        {
+            double busy = static_cast<double>(m_window.busyNs) / (WINDOW_US * 1000.0);
+            uint64_t p99 = m_window.e2e.Percentile(99.0);
+            std::printf("t=%3llus  trades %7llu/s  events %5llu  snaps %4llu  missing %6llu  e2e p50 %7llu p99 %7llu max %7llu us"
+                        "  receive p99 %6llu  trade p99 %7llu  state p99 %9llu ns  busy %5.1f%%\n",
+                        static_cast<unsigned long long>(second), static_cast<unsigned long long>(m_window.trades),
+                        static_cast<unsigned long long>(m_window.others),
+                        static_cast<unsigned long long>(m_window.snapshots),
+                        static_cast<unsigned long long>(m_window.missing),
+                        static_cast<unsigned long long>(m_window.e2e.Percentile(50.0)),
+                        static_cast<unsigned long long>(p99), static_cast<unsigned long long>(m_window.e2e.Max()),
+                        static_cast<unsigned long long>(m_window.receive.Percentile(99.0)),
+                        static_cast<unsigned long long>(m_window.trade.Percentile(99.0)),
+                        static_cast<unsigned long long>(m_window.state.Percentile(99.0)), busy * 100.0);
+            std::fflush(stdout);
+
+            bool active = m_window.trades + m_window.others + m_window.snapshots > 0;
+            if (active)
+            {
+                const char* delivery = m_window.missing > 0 ? "messages missing"
+                                     : (p99 > m_sloUs ? "e2e p99 over the SLO" : nullptr);
+                Check(m_delivery, delivery, second);
+                Check(m_consumer, busy > SATURATED_BUSY ? "consumer thread saturated" : nullptr, second);
+            }
+            m_window.Reset();
+        }
+
+        void Report(uint64_t seconds)
+        {
+            std::printf("\n%llu s, %llu missing, %llu parse errors\n", static_cast<unsigned long long>(seconds),
+                        static_cast<unsigned long long>(m_missingTotal),
+                        static_cast<unsigned long long>(m_parseErrors));
+            Print("delivery", m_delivery);
+            Print("consumer", m_consumer);
+            std::printf("copy:      %s\n", m_engine.StatsJson().c_str());
+        }
+
+    private:
+        // Events arrive in eventIndex order per socket; the priority lane may
+        // deliver ahead of the data port, which later fills the gap
+        void Sequence(int64_t index)
+        {
+            if (index <= 0) return;
+            if (m_lastIndex == 0 || index == m_lastIndex + 1)
+            {
+                m_lastIndex = index;
+                return;
+            }
+            if (index > m_lastIndex)
+            {
+                uint64_t gap = static_cast<uint64_t>(index - m_lastIndex - 1);
+                m_window.missing += gap;
+                m_missingTotal += gap;
+                m_lastIndex = index;
+            }
+            else if (m_missingTotal > 0)
+            {
+                m_missingTotal--;
+                if (m_window.missing > 0) m_window.missing--;
+            }
+        }
+
+        void Check(Breaking& stage, const char* reason, uint64_t second)
+        {
+            if (stage.broken) return;
+            if (!reason)
+            {
+                if (m_window.trades > stage.bestRate) stage.bestRate = m_window.trades;
+                return;
+            }
+            stage.broken = true;
+            stage.second = second;
+            stage.rate = m_window.trades;
+            stage.reason = reason;
+        }
+
+        static void Print(const char* name, const Breaking& stage)
+        {
+            if (!stage.broken)
+            {
+                std::printf("%-9s held: best %llu trades/s\n", name, static_cast<unsigned long long>(stage.bestRate));
+                return;
+            }
+            std::printf("%-9s broke at t=%llus, %llu trades/s (%s); best before: %llu trades/s\n", name,
+                        static_cast<unsigned long long>(stage.second), static_cast<unsigned long long>(stage.rate),
+                        stage.reason, static_cast<unsigned long long>(stage.bestRate));
+        }
+
+        hedgeedge::CopyEngine               m_engine;
+        hedgeedge::CopySignal               m_signal;
+        std::vector<hedgeedge::CopyDecision> m_decisions;
+        uint64_t                            m_sloUs;
+        Window                              m_window;
+        Breaking                            m_delivery;
+        Breaking                            m_consumer;
+        int64_t                             m_lastIndex = 0;
+        uint64_t                            m_missingTotal = 0;
+        uint64_t                            m_parseErrors = 0;
+    };
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string endpoint;
+    std::string laneEndpoint;
+    std::string serverKey;
+    std::string curvePublic;
+    std::string curveSecret;
+    std::string dictionary;
+    bool compressed = false;
+    bool batched = false;
+    int hwm = 1000;
+    uint64_t sloMs = 100;
+    uint64_t seconds = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--connect" && hasValue) endpoint = argv[++i];
+        else if (arg == "--lane" && hasValue) laneEndpoint = argv[++i];
+        else if (arg == "--server-key" && hasValue) serverKey = argv[++i];
+        else if (arg == "--curve-public" && hasValue) curvePublic = argv[++i];
+        else if (arg == "--curve-secret" && hasValue) curveSecret = argv[++i];
+        else if (arg == "--compressed") compressed = true;
+        else if (arg == "--batched") batched = true;
+        else if (arg == "--dict" && hasValue)
+        {
+            std::string dictPath = argv[++i];
+            if (!hedgeedge::ReadFileBytes(dictPath, dictionary))
+            {
+                std::fprintf(stderr, "cannot read %s\n", dictPath.c_str());
+                return 1;
+            }
+        }
+        else if (arg == "--hwm" && hasValue) hwm = std::atoi(argv[++i]);
+        else if (arg == "--slo-ms" && hasValue) sloMs = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--seconds" && hasValue) seconds = std::strtoull(argv[++i], nullptr, 10);
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+    if (endpoint.empty())
+    {
+        Usage();
+        return 2;
+    }
+
+    const hedgeedge::ZmqApi* zmq = hedgeedge::Zmq();
+    if (!zmq)
+    {
+        std::fprintf(stderr, "libzmq not available\n");
+        return 1;
+    }
+
+    std::string error;
+    hedgeedge::Subscriber subscriber;
+    if (!subscriber.Connect(endpoint, serverKey, curvePublic, curveSecret, hwm, &error))
+    {
+        std::fprintf(stderr, "cannot connect %s: %s\n", endpoint.c_str(), error.c_str());
+        return 1;
+    }
+    if (!dictionary.empty()) subscriber.LoadDictionary(dictionary);
+    std::string batchTopic = std::string("EVENT") + hedgeedge::BATCH_TOPIC_SUFFIX;
+    subscriber.Subscribe(batched ? batchTopic : "EVENT", compressed);
+    subscriber.Subscribe("SNAPSHOT", compressed);
+    if (!laneEndpoint.empty() && !subscriber.ConnectPriorityLane(laneEndpoint, compressed, hwm, &error))
+    {
+        std::fprintf(stderr, "cannot connect priority lane %s: %s\n", laneEndpoint.c_str(), error.c_str());
+        return 1;
+    }
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+    std::fprintf(stderr, "benchmarking %s (e2e SLO %llu ms)\n", endpoint.c_str(), static_cast<unsigned long long>(sloMs));
+
+    Bench bench(sloMs * 1000);
+    hedgeedge::Arena arena;
+    std::vector<std::string_view> events;
+    std::string topic;
+    std::string data;
+
+    uint64_t start = hedgeedge::NowMicros();
+    uint64_t windowEnd = start + WINDOW_US;
+    uint64_t second = 1;
+    while (!g_stop)
+    {
+        uint64_t now = hedgeedge::NowMicros();
+        if (seconds > 0 && now - start >= seconds * 1000000) break;
+        while (now >= windowEnd)
+        {
+            bench.CloseWindow(second++);
+            windowEnd += WINDOW_US;
+        }
+
+        // Wait outside the timed section, so receive is decoding work only
+        uint64_t received = hedgeedge::NowNanos();
+        int rc = subscriber.Receive(topic, data, 0);
+        if (rc == 0)
+        {
+            hedgeedge::ZmqPollItem items[2] = {
+                { subscriber.Socket(), 0, hedgeedge::ZMQ_POLLIN, 0 },
+                { subscriber.LaneSocket(), 0, hedgeedge::ZMQ_POLLIN, 0 },
+            };
+            zmq->poll(items, subscriber.LaneSocket() ? 2 : 1, RECEIVE_TIMEOUT_MS);
+            continue;
+        }
+        if (rc < 0) continue;
+
+        hedgeedge::ArenaScope scope(arena);
+        events.clear();
+        if (topic == batchTopic)
+        {
+            if (!hedgeedge::UnpackBatch(data.data(), data.size(), arena, events)) continue;
+            topic = "EVENT";
+        }
+        else
+        {
+            events.push_back(data);
+        }
+
+        // Receive time (decode and unpack included) is spread over the batch
+        uint64_t receiveNs = (hedgeedge::NowNanos() - received) / events.size();
+        for (std::string_view event : events) bench.Message(topic, event, receiveNs);
+    }
+
+    bench.Report(second - 1);
+    std::printf("subscriber: %s\n", subscriber.StatsJson().c_str());
+    return 0;
+}